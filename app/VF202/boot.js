@@ -0,0 +1,22 @@
+// 启动引导：打包后为 /app/index.js，app 本体打包为 /app/main.js
+//
+// 优先从字节码镜像加载 app，跳过源码解析；镜像不存在或已失效（升级、开发模式下推送了新的 main.js、
+// 引擎更新）时加载源码，并在启动完成后于后台重新生成镜像，下次启动生效
+import { bytecodeBuild, bytecodeRun } from 'dxDriver/lib/bytecode/index.js';
+
+const BYTECODE_IMAGE = '/app/app.qjsc';
+const MAIN_MODULE = '/app/main.js';
+// 生成镜像要完整编译一遍 app，放在启动和首屏绘制之后
+const BUILD_DELAY_MS = 30000;
+
+const loaded = bytecodeRun(BYTECODE_IMAGE);
+if (loaded) {
+    await loaded;
+} else {
+    await import(MAIN_MODULE);
+    setTimeout(() => {
+        if (!bytecodeBuild(BYTECODE_IMAGE, [MAIN_MODULE])) {
+            console.log('字节码镜像未生成，继续使用源码启动');
+        }
+    }, BUILD_DELAY_MS);
+}
@@ -1,30 +1,58 @@
 import path from "tjs:path";
-import { capturer, face, pwm, mqtt, display, common, audio } from "dxDriver";
-import { config, mqttAccess } from "dxAccess";
+import { capturer, face, pwm, mqtt, display, common, audio, metrics, lvgl } from "dxDriver";
+import { config, mqttAccess, access } from "dxAccess";
 import configJson from './config.json';
-import { uiInit } from './src/ui/index.js';
+import { uiInit, trackStart } from './src/ui/index.js';
+import { prewarmFonts } from './src/ui/assets.js';
+import { Startup, sinceStart, afterFirstFrame } from './src/startup.js';
+import { cardInit } from './src/card.js';
 
 async function main() {
-    const configManager = await config.initConfigManager();
+    const startup = new Startup();
+    // 异步阶段先声明，文件IO与后面的同步驱动初始化并行
+    startup.stage('config', [], () => config.initConfigManager());
+    startup.stage('db', [], () => access.dbReady);
+    // 初始化显示
+    startup.stage('display', [], displayInit);
+    // 初始化PWM（红外补光灯需在人脸检测前打开）
+    startup.stage('pwm', [], pwmInit);
     // 初始化摄像头
-    const { rgbCapturer, nirCapturer } = capturer.capturerInit();
+    startup.stage('capturer', [], () => capturer.capturerInit());
     // 初始化人脸识别
-    faceInit1(rgbCapturer, nirCapturer, configManager);
-    // 初始化PWM
-    pwmInit();
-    // 初始化音频
-    audioInit1();
-    // 初始化MQTT
-    mqttInit1(configManager);
+    startup.stage('face', ['capturer', 'config'], ({ capturer, config }) => {
+        faceInit1(capturer.rgbCapturer, capturer.nirCapturer, config);
+    });
     // 初始化UI
-    uiInit();
-    // 初始化显示
-    displayInit();
+    startup.stage('ui', ['config'], ({ config }) => uiInit(config));
+    // 初始化音频
+    startup.stage('audio', [], audioInit1);
+    // 开始轮询识别结果，识别后查库校验权限
+    startup.stage('track', ['face', 'ui', 'db'], trackStart);
+    // 初始化刷卡（读卡和开门在驱动线程中完成，结果提示依赖界面）
+    startup.stage('nfc', ['db', 'ui'], () => cardInit());
+    startup.stage('ready', ['track'], () => {
+        console.log(`[启动] 可以识别，距启动 ${sinceStart()}ms`);
+    });
+    // 首帧刷新后分批预热常用字和最近通行用户姓名的字形，只查最近的通行记录，不随用户总数增长
+    startup.stage('fonts', ['db', 'ready'], async () => {
+        await afterFirstFrame();
+        prewarmFonts(access.db.getRecentUserNames());
+    });
+    // 刷新分析（调试用），首帧之后开始，避免把启动时的整屏绘制算进去
+    startup.stage('displayProfile', ['ready'], async () => {
+        await afterFirstFrame();
+        displayProfileInit();
+    });
+    // MQTT不影响本地识别，首帧刷新后再连接
+    startup.stage('mqtt', ['config', 'ready'], async ({ config }) => {
+        await afterFirstFrame();
+        mqttInit1(config);
+        metricsPublishInit();
+    });
+    await startup.run();
 
-    // 内存检测
-    setInterval(() => {
-        tjs.spawn(['free', '-m'])
-    }, 1000);
+    // 运行指标（内存、队列、识别等）由 webserver 的 /metrics 接口输出，这里只采样事件循环延迟
+    metrics.metricsWatchEventLoop(1000);
 }
 
 main().catch(console.error);
@@ -48,6 +76,34 @@ function mqttInit1(configManager) {
     mqttAccess.mqttAccessInit();
 }
 
+// 按配置周期性通过 MQTT 上报运行指标，间隔为0时不上报
+function metricsPublishInit() {
+    const { publishInterval, topic } = configJson.metrics || {};
+    if (!publishInterval || !topic) {
+        return;
+    }
+    setInterval(() => {
+        mqtt.publish(topic, metrics.metricsRender());
+    }, publishInterval);
+}
+
+// 按配置开启刷新分析，定期在日志中输出报告
+function displayProfileInit() {
+    const { enable, flash, trace, reportInterval } = configJson.displayProfile || {};
+    if (!enable) {
+        return;
+    }
+    if (lvgl.profStart({ objects: true, flash, trace }) !== 0) {
+        console.log('[刷新分析] 启动失败');
+        return;
+    }
+    if (reportInterval > 0) {
+        setInterval(() => {
+            console.log(`[刷新分析]\n${lvgl.profReport()}`);
+        }, reportInterval);
+    }
+}
+
 function displayInit() {
     // 不自动熄屏，状态常亮，亮度100
     display.setEnableStatus(1);
@@ -0,0 +1,42 @@
+import { nfc } from "dxDriver";
+import { accessAccess, accessFail } from "./ui/result.js";
+
+// 刷卡：判定和开门已在驱动中完成，这里只取结果做界面提示
+
+const { NFC_REASON } = nfc;
+const REASON_MESSAGE = {
+    [NFC_REASON.NOT_FOUND]: "凭证不存在或已失效",
+    [NFC_REASON.NO_PERMISSION]: "用户无任何权限",
+    [NFC_REASON.OUT_OF_TIME]: "当前时间无权限",
+};
+
+// 卡片凭证类型，与 AccessControlDB.CREDENTIAL_TYPES.CARD 一致
+const CARD_TYPE = 200;
+
+function pollCard() {
+    let card;
+    while ((card = nfc.nfcGetResult())) {
+        if (card.result === 1) {
+            console.log(`[刷卡验证成功] 卡号: ${card.code}, 用户ID: ${card.userId}, 开门耗时: ${card.latencyUs}us`);
+            accessAccess(CARD_TYPE);
+        } else {
+            console.log(`[刷卡验证失败] 卡号: ${card.code}, 失败原因: ${REASON_MESSAGE[card.reason]}`);
+            accessFail(CARD_TYPE);
+        }
+    }
+}
+
+/**
+ * 初始化刷卡，需在数据库打开（表已创建）和结果界面初始化之后调用
+ * @param {Object} options 参数同 nfc.nfcInit
+ * @returns {boolean} 是否成功
+ */
+export function cardInit(options = {}) {
+    if (nfc.nfcInit(options) !== 0) {
+        console.error('[刷卡] NFC初始化失败');
+        return false;
+    }
+    // 结果只用于提示，轮询间隔不影响开门速度
+    setInterval(pollCard, 50);
+    return true;
+}
@@ -0,0 +1,126 @@
+import { lvgl } from "dxDriver";
+
+// 启动编排：按依赖关系调度各初始化阶段，无依赖关系的阶段交叠执行，并统计每个阶段耗时
+//
+// 同步的驱动初始化（摄像头、NPU）会阻塞事件循环，异步阶段（读配置、打开数据库）
+// 应先声明，使其文件IO在线程池中与同步初始化并行
+
+const startTime = Date.now();
+
+export class Startup {
+    constructor() {
+        // 阶段名 -> { deps, fn, promise, start, end, error }
+        this.stages = new Map();
+    }
+
+    /**
+     * 声明一个启动阶段
+     * @param {string} name 阶段名
+     * @param {string[]} deps 依赖的阶段名，全部完成后才执行
+     * @param {Function} fn 阶段函数，参数为依赖阶段结果 { 阶段名: 结果 }，可返回Promise
+     */
+    stage(name, deps, fn) {
+        if (this.stages.has(name)) {
+            throw new Error(`启动阶段重复: ${name}`);
+        }
+        this.stages.set(name, { deps, fn, promise: null, start: 0, end: 0, error: null });
+        return this;
+    }
+
+    // 执行全部阶段，返回 { 阶段名: 结果 }，失败的阶段及其后续阶段结果为undefined
+    async run() {
+        for (const [name, stage] of this.stages) {
+            for (const dep of stage.deps) {
+                if (!this.stages.has(dep)) {
+                    throw new Error(`启动阶段 ${name} 依赖的阶段不存在: ${dep}`);
+                }
+            }
+        }
+        for (const name of this.stages.keys()) {
+            this._schedule(name);
+        }
+
+        const names = [...this.stages.keys()];
+        const settled = await Promise.allSettled(names.map((name) => this.stages.get(name).promise));
+        const results = {};
+        settled.forEach((item, i) => {
+            results[names[i]] = item.status === 'fulfilled' ? item.value : undefined;
+        });
+        this.report();
+        return results;
+    }
+
+    _schedule(name) {
+        const stage = this.stages.get(name);
+        if (stage.promise) {
+            return stage.promise;
+        }
+        const depPromises = stage.deps.map((dep) => this._schedule(dep));
+        const run = async () => {
+            const depResults = {};
+            const values = await Promise.all(depPromises);
+            stage.deps.forEach((dep, i) => {
+                depResults[dep] = values[i];
+            });
+            stage.start = Date.now();
+            try {
+                let result = stage.fn(depResults);
+                // 同步阶段立即记录结束时间，避免计入其他阶段的微任务
+                if (result && typeof result.then === 'function') {
+                    result = await result;
+                }
+                return result;
+            } catch (error) {
+                stage.error = error;
+                console.error(`[启动] 阶段 ${name} 失败:`, error);
+                throw error;
+            } finally {
+                stage.end = Date.now();
+            }
+        };
+        stage.promise = run();
+        return stage.promise;
+    }
+
+    // 打印每个阶段的开始时刻（相对应用启动）和耗时
+    report() {
+        const rows = [...this.stages.entries()]
+            .filter(([, stage]) => stage.start)
+            .sort((a, b) => a[1].start - b[1].start);
+        console.log('[启动] 阶段耗时:');
+        for (const [name, stage] of rows) {
+            const status = stage.error ? '失败' : '完成';
+            console.log(`[启动]   ${name.padEnd(10)} 开始 +${stage.start - startTime}ms  耗时 ${stage.end - stage.start}ms  ${status}`);
+        }
+        const skipped = [...this.stages.entries()].filter(([, stage]) => !stage.start).map(([name]) => name);
+        if (skipped.length > 0) {
+            console.log(`[启动]   依赖失败未执行: ${skipped.join(', ')}`);
+        }
+    }
+}
+
+// 距应用启动的毫秒数
+export function sinceStart() {
+    return Date.now() - startTime;
+}
+
+// 等待首帧检查间隔；驱动库不支持帧计数时改为固定延时，让出事件循环使LVGL先完成首帧刷新
+const FRAME_POLL_MS = 10;
+const FRAME_FALLBACK_MS = 50;
+
+// 等待界面首帧完成送显（uiInit 中开始帧计数）
+export function afterFirstFrame() {
+    return new Promise((resolve) => {
+        const check = () => {
+            const frames = lvgl.frameCount();
+            if (frames < 0) {
+                setTimeout(resolve, FRAME_FALLBACK_MS);
+            } else if (frames > 0) {
+                resolve();
+            } else {
+                setTimeout(check, FRAME_POLL_MS);
+            }
+        };
+        check();
+    });
+}
@@ -0,0 +1,135 @@
+import path from "tjs:path";
+import { lvgl } from "dxDriver";
+
+let resourcePath = path.join(import.meta.dirname, '/resource');
+
+// 界面用到的全部图片，启动时并行预读
+const IMAGE_LIST = [
+    'track_white.png', 'track_green.png', 'track_red.png',
+    'top.png', 'bottom.png', 'lock_circle.png', 'wifi.png', 'mqtt_icon.png', 'qrcode.png',
+    'success_side.png', 'fail_side.png', 'success.png', 'fail.png', 'success_circle.png', 'fail_circle.png',
+    'tip.png', 'face.png',
+];
+
+// 图片名 -> Promise<ArrayBuffer>，同一张图片只读一次，各控件共享同一份数据
+const imageCache = new Map();
+// 已读完的图片，设置时不再等待
+const loadedImages = new Map();
+
+// 读取图片（已读过的直接复用）
+export function loadImage(name) {
+    let image = imageCache.get(name);
+    if (!image) {
+        image = tjs.readFile(resourcePath + '/image/' + name, { encoding: "binary" }).then((data) => {
+            loadedImages.set(name, data.buffer);
+            return data.buffer;
+        });
+        imageCache.set(name, image);
+    }
+    return image;
+}
+
+// 预读全部图片，并把LVGL图片解码缓存扩大到图片数量，
+// 避免缓存只有1个槽位时多张PNG互相挤占、每次重绘或切换跟踪框都重新解码。
+// 界面图片仍以PNG交给 Image 控件，由LVGL解码后常驻缓存，每张只在首次显示时解码一次。
+// 驱动库也能自建 lv_img_dsc_t 并按控件句柄设置（跟踪叠加层即如此），但需要在驱动库中另做PNG解码，
+// 缓存常驻后省下的只是这一次解码，暂不这样做
+export function preloadImages() {
+    if (lvgl.imgCacheSetSize(IMAGE_LIST.length) !== 0) {
+        console.log('LVGL图片缓存设置失败，按默认缓存运行');
+    }
+    return Promise.all(IMAGE_LIST.map(loadImage));
+}
+
+// 给Image控件设置图片
+export function setImage(comp, name) {
+    const buffer = loadedImages.get(name);
+    if (buffer) {
+        comp.setImageBinary(buffer);
+        return Promise.resolve();
+    }
+    return loadImage(name).then((data) => {
+        comp.setImageBinary(data);
+    });
+}
+
+// ---------------- 字体 ----------------
+
+const FONT_FILE = resourcePath + '/font/AlibabaPuHuiTi-3-65-Medium.ttf';
+
+// 样式中使用的字体，"路径#字号#风格"，同一字号全界面共用一个字体
+export function fontSpec(size) {
+    return `${FONT_FILE}#${size}#0`;
+}
+
+export function fontPath() {
+    return FONT_FILE;
+}
+
+// 字形缓存：界面各字号同时在用的字形位图总量，中文40号字每字约2KB
+const FONT_CACHE_BYTES = 512 * 1024;
+// 常用字：数字、字母及界面提示语，启动后预先渲染
+const COMMON_CHARS = '0123456789:-/. ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz' +
+    '通行成功失败请重试无权限密码注册人脸识别';
+// 常见姓氏，排在最近通行用户的姓名之后，预热总量有余量时才预热
+const SURNAME_CHARS = '王李张刘陈杨黄赵吴周徐孙马朱胡郭何高林罗郑梁谢宋唐许韩冯邓曹彭曾肖田董袁潘于蒋蔡余杜叶程苏魏吕丁任沈姚卢姜崔钟谭陆汪范金石廖贾夏韦付方白邹孟熊秦邱江尹薛闫段雷侯龙史陶黎贺顾毛郝龚邵万钱严覃武戴莫孔向汤';
+// 显示姓名的字号
+const NAME_FONT_SIZES = [40, 25];
+// 只显示数字、时间、密码等的字号
+const DIGIT_FONT_SIZES = [20, 19, 15];
+// 每次预热的字数，分批执行不长时间阻塞事件循环
+const PREWARM_BATCH = 32;
+// 预热字形总量不超过字形缓存的3/4，留出空间给运行中首次显示的字，预热的字形也不会互相淘汰
+const PREWARM_BYTES = FONT_CACHE_BYTES * 3 / 4;
+
+// 单个字形位图的估算大小：8位灰度，约为字号的平方，40号字约2KB
+function glyphBytes(size) {
+    return Math.ceil(size * size * 1.25);
+}
+
+// 扩大FreeType字形缓存，需在创建任何界面字体之前调用
+export function initFonts() {
+    if (lvgl.fontCacheInit({ maxFaces: 2, maxSizes: NAME_FONT_SIZES.length + DIGIT_FONT_SIZES.length + 2, maxBytes: FONT_CACHE_BYTES }) !== 0) {
+        console.log('FreeType字形缓存设置失败，按默认缓存运行');
+    }
+}
+
+/**
+ * 预热数字、常用字、用户姓名和常见姓氏的字形，首次显示姓名时不再卡顿；总量按字形缓存大小截断，靠前的优先
+ * @param {string[]} names 用户姓名，按显示可能性从高到低排列
+ */
+export async function prewarmFonts(names = []) {
+    const digits = [...'0123456789:-/. '];
+    let budget = PREWARM_BYTES - DIGIT_FONT_SIZES.reduce((sum, size) => sum + digits.length * glyphBytes(size), 0);
+    // 每个姓名用字在各姓名字号下都要预热
+    const charBytes = NAME_FONT_SIZES.reduce((sum, size) => sum + glyphBytes(size), 0);
+    const nameChars = new Set();
+    for (const ch of [...COMMON_CHARS, ...names.join(''), ...SURNAME_CHARS]) {
+        if (nameChars.has(ch)) {
+            continue;
+        }
+        if (budget < charBytes) {
+            break;
+        }
+        nameChars.add(ch);
+        budget -= charBytes;
+    }
+    const jobs = [
+        ...DIGIT_FONT_SIZES.map((size) => [fontSpec(size), digits]),
+        ...NAME_FONT_SIZES.map((size) => [fontSpec(size), [...nameChars]]),
+    ];
+    const start = Date.now();
+    let glyphs = 0;
+    for (const [spec, chars] of jobs) {
+        for (let i = 0; i < chars.length; i += PREWARM_BATCH) {
+            const count = lvgl.fontPrewarm(spec, chars.slice(i, i + PREWARM_BATCH).join(''));
+            if (count < 0) {
+                console.log('字体预热不可用');
+                return;
+            }
+            glyphs += count;
+            await new Promise((resolve) => setTimeout(resolve, 0));
+        }
+    }
+    console.log(`[字体] 预热${glyphs}个字形，耗时${Date.now() - start}ms，字体数${lvgl.fontCount()}`);
+}
@@ -1,3 +1,5 @@
+import { lvgl } from "dxDriver";
+
 const EAlignType = {
     ALIGN_DEFAULT: 0,
     ALIGN_TOP_LEFT: 1,
@@ -96,12 +98,13 @@ const ETextOverflow = {
 
 let bridge = globalThis[Symbol.for("lvgljs")];
 const Window = bridge.NativeRender.dimensions.window;
-var View = bridge.NativeRender.NativeComponents.View;
-let Textarea = bridge.NativeRender.NativeComponents.Textarea;
-let Text = bridge.NativeRender.NativeComponents.Text;
-let Button = bridge.NativeRender.NativeComponents.Button;
-let Image = bridge.NativeRender.NativeComponents.Image;
-let Dropdownlist = bridge.NativeRender.NativeComponents.Dropdownlist;
-let Keyboard = bridge.NativeRender.NativeComponents.Keyboard;
+// 组件创建时记下原生对象句柄，动画和页面直接使用
+var View = lvgl.withHandle(bridge.NativeRender.NativeComponents.View);
+let Textarea = lvgl.withHandle(bridge.NativeRender.NativeComponents.Textarea);
+let Text = lvgl.withHandle(bridge.NativeRender.NativeComponents.Text);
+let Button = lvgl.withHandle(bridge.NativeRender.NativeComponents.Button);
+let Image = lvgl.withHandle(bridge.NativeRender.NativeComponents.Image);
+let Dropdownlist = lvgl.withHandle(bridge.NativeRender.NativeComponents.Dropdownlist);
+let Keyboard = lvgl.withHandle(bridge.NativeRender.NativeComponents.Keyboard);
 
 export { EAlignType, EVENTTYPE_MAP, View, Textarea, Text, Button, Image, Dropdownlist, Keyboard, Window, ETextOverflow };
@@ -1,12 +1,22 @@
-import { trackInit } from "./track.js";
+import { trackInit, trackStart } from "./track.js";
 import { initMain } from "./main.js";
 import { initResult } from "./result.js";
 import { initPasswordPass } from "./password.js";
 import { initRegister } from "./register.js";
+import { preloadImages, initFonts } from "./assets.js";
+import { lvgl } from "dxDriver";
 
-export function uiInit() {
+export { trackStart };
+
+export async function uiInit(configManager) {
+    // 并行预读全部图片，各界面共享
+    const images = preloadImages();
+    // 字形缓存需在各界面创建字体之前设置
+    initFonts();
+    // 图片读完再建界面，首帧中的图片直接设置，不在首帧之后再逐张补上
+    await images;
     // 初始化跟踪框
-    trackInit();
+    trackInit(configManager);
     // 初始化主界面
     initMain();
     // 初始化结果界面
@@ -15,6 +25,8 @@ export function uiInit() {
     initPasswordPass();
     // 初始化注册界面
     initRegister();
+    // 界面创建完成，之后送显的第一帧即首帧
+    lvgl.frameWatch();
 
 }
 
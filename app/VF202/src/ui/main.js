@@ -1,9 +1,8 @@
-import path from "tjs:path";
 import { EAlignType, EVENTTYPE_MAP, View, Textarea, Text, Button, Image, Dropdownlist, Keyboard, Window, ETextOverflow } from "./const.js";
-import { hide, show } from "./utils.js";
-import { mqtt, common, face } from "dxDriver";
-import { showPasswordPass, hidePasswordPass, confirmPassword } from "./password.js";
-import { confirmRegister } from "./register.js";
+import { hide, show, onEvent, setStyle } from "./utils.js";
+import { setImage, fontSpec } from "./assets.js";
+import { mqtt, common, face, lvgl } from "dxDriver";
+import { showPasswordPass } from "./password.js";
 
 // 顶部图片
 let topImg
@@ -27,7 +26,6 @@ let snText
 let ipText
 
 
-let resourcePath = path.join(import.meta.dirname, '/resource');
 
 // 格式化时间显示
 function formatTime() {
@@ -54,70 +52,48 @@ function updateTime() {
 }
 
 let flag = false;
-let mode = "password";
 
 export function initMain() {
     topImg = new Image({ uid: "topImg" });
     topImg.align(EAlignType.ALIGN_TOP_LEFT, [26, 12]);
-    tjs.readFile(resourcePath + '/image/top.png', { encoding: "binary" }).then((data) => {
-        topImg.setImageBinary(data.buffer);
-    });
+    setImage(topImg, 'top.png');
     bottomImg = new Image({ uid: "bottomImg" });
     bottomImg.align(EAlignType.ALIGN_BOTTOM_MID, [0, 0]);
-    tjs.readFile(resourcePath + '/image/bottom.png', { encoding: "binary" }).then((data) => {
-        bottomImg.setImageBinary(data.buffer);
-    });
+    setImage(bottomImg, 'bottom.png');
     passwordImg = new Image({ uid: "passwordImg" });
     passwordImg.align(EAlignType.ALIGN_TOP_LEFT, [202, 755]);
-    tjs.readFile(resourcePath + '/image/lock_circle.png', { encoding: "binary" }).then((data) => {
-        passwordImg.setImageBinary(data.buffer);
-    });
-    passwordImg.addEventListener(EVENTTYPE_MAP.EVENT_CLICKED);
-    passwordImg.addEventListener(EVENTTYPE_MAP.EVENT_LONG_PRESSED);
-    globalThis.FIRE_QEVENT_CALLBACK = (targetUid, currentTargetUid, eventType, e, point) => {
-        if (currentTargetUid == "passwordImg" && eventType == EVENTTYPE_MAP.EVENT_CLICKED) {
-            if (flag) {
-                flag = false;
-                return;
-            }
-            mode = "password";
-            showPasswordPass();
-            face.setFacePause(true);
-        } else if (currentTargetUid == "passwordImg" && eventType == EVENTTYPE_MAP.EVENT_LONG_PRESSED) {
-            mode = "register";
-            showPasswordPass("register");
-            flag = true;
-        } else if (targetUid == "mask" && eventType == EVENTTYPE_MAP.EVENT_CLICKED) {
-            hidePasswordPass();
-        } else if (currentTargetUid == "keyboard" && eventType == EVENTTYPE_MAP.EVENT_CANCEL) {
-            hidePasswordPass();
-        } else if (currentTargetUid == "keyboard" && eventType == EVENTTYPE_MAP.EVENT_READY) {
-            hidePasswordPass();
-            if (mode == "password") {
-                confirmPassword();
-            } else {
-                confirmRegister();
-            }
+    setImage(passwordImg, 'lock_circle.png');
+    onEvent(passwordImg, EVENTTYPE_MAP.EVENT_CLICKED, () => {
+        // 长按松开后还会收到一次点击，忽略
+        if (flag) {
+            flag = false;
+            return;
         }
-    }
+        showPasswordPass();
+        face.setFacePause(true);
+    });
+    onEvent(passwordImg, EVENTTYPE_MAP.EVENT_LONG_PRESSED, () => {
+        showPasswordPass("register");
+        flag = true;
+    });
 
     timeText = new Text({ uid: "timeText" });
     timeText.align(EAlignType.ALIGN_TOP_LEFT, [43, 17]);
     timeText.setText("00:00");
     let timeTextStyle = {
-        'font-size-1': resourcePath + "/font/AlibabaPuHuiTi-3-65-Medium.ttf#25#0",
+        'font-size-1': fontSpec(25),
         'text-color': 0xFFFFFFFF
     }
-    timeText.nativeSetStyle(timeTextStyle, Object.keys(timeTextStyle), Object.keys(timeTextStyle).length, 0, true)
+    setStyle(timeText, timeTextStyle);
 
     timeText1 = new Text({ uid: "timeText1" });
     timeText1.align(EAlignType.ALIGN_TOP_LEFT, [113, 22]);
     timeText1.setText(":00");
     let timeTextStyle1 = {
-        'font-size-1': resourcePath + "/font/AlibabaPuHuiTi-3-65-Medium.ttf#19#0",
+        'font-size-1': fontSpec(19),
         'text-color': 0xFFFFFFFF
     }
-    timeText1.nativeSetStyle(timeTextStyle1, Object.keys(timeTextStyle1), Object.keys(timeTextStyle1).length, 0, true)
+    setStyle(timeText1, timeTextStyle1);
 
     // 立即显示当前时间
     updateTime();
@@ -127,17 +103,19 @@ export function initMain() {
 
     networkImg = new Image({ uid: "networkImg" });
     networkImg.align(EAlignType.ALIGN_TOP_LEFT, [391, 27]);
-    tjs.readFile(resourcePath + '/image/wifi.png', { encoding: "binary" }).then((data) => {
-        networkImg.setImageBinary(data.buffer);
-    });
+    setImage(networkImg, 'wifi.png');
     // hide(networkImg);
     mqttImg = new Image({ uid: "mqttImg" });
     mqttImg.align(EAlignType.ALIGN_TOP_LEFT, [422, 22]);
-    tjs.readFile(resourcePath + '/image/mqtt_icon.png', { encoding: "binary" }).then((data) => {
-        mqttImg.setImageBinary(data.buffer);
-    });
+    setImage(mqttImg, 'mqtt_icon.png');
     hide(mqttImg);
 
+    // 顶栏在各页面（识别结果、密码、注册）上都显示，位于各页面的遮罩、提示之下；其余控件（开锁图标、二维码等）只属于主界面，
+    // 显示识别结果、密码键盘时不显示
+    for (const comp of [topImg, timeText, timeText1, networkImg, mqttImg]) {
+        lvgl.Page.share(comp);
+    }
+
     mqtt.setStatusCallback((status) => {
         if (status === 2) {
             show(mqttImg);
@@ -148,29 +126,27 @@ export function initMain() {
 
     qrcodeImg = new Image({ uid: "qrcodeImg" });
     qrcodeImg.align(EAlignType.ALIGN_TOP_LEFT, [21, 819]);
-    tjs.readFile(resourcePath + '/image/qrcode.png', { encoding: "binary" }).then((data) => {
-        qrcodeImg.setImageBinary(data.buffer);
-    });
+    setImage(qrcodeImg, 'qrcode.png');
 
     snText = new Text({ uid: "snText" });
     snText.align(EAlignType.ALIGN_TOP_LEFT, [61, 823]);
     snText.setText("SN: " + common.getUuid(19));
     let snTextStyle = {
-        'font-size-1': resourcePath + "/font/AlibabaPuHuiTi-3-65-Medium.ttf#15#0",
+        'font-size-1': fontSpec(15),
         'text-color': 0xFFFFFFFF,
         'text-overflow': ETextOverflow.LV_LABEL_LONG_SCROLL_CIRCULAR,
         'width': 118
     }
-    snText.nativeSetStyle(snTextStyle, Object.keys(snTextStyle), Object.keys(snTextStyle).length, 0, true)
+    setStyle(snText, snTextStyle);
 
 
     ipText = new Text({ uid: "ipText" });
     ipText.align(EAlignType.ALIGN_BOTTOM_RIGHT, [-20, -13]);
     let ipTextStyle = {
-        'font-size-1': resourcePath + "/font/AlibabaPuHuiTi-3-65-Medium.ttf#15#0",
+        'font-size-1': fontSpec(15),
         'text-color': 0xFFFFFFFF,
     }
-    ipText.nativeSetStyle(ipTextStyle, Object.keys(ipTextStyle), Object.keys(ipTextStyle).length, 0, true)
+    setStyle(ipText, ipTextStyle);
 
     let proc = tjs.spawn(['sh', '-c', `ifconfig | grep "inet " | grep -v "127.0.0.1" | awk '{print $2}' | head -1 | grep -oE '[0-9]{1,3}\.[0-9]{1,3}\.[0-9]{1,3}\.[0-9]{1,3}'`], { stdout: 'pipe', stderr: 'pipe' })
     // 创建缓冲区用于读取输出
@@ -1,21 +1,32 @@
 import { Window, View, Textarea, EAlignType, Keyboard } from "./const.js";
-import { hide, show } from "./utils.js";
+import { onEvent, setStyle } from "./utils.js";
 import { EVENTTYPE_MAP } from "./const.js";
-import { face } from "dxDriver";
+import { face, lvgl } from "dxDriver";
 import { access } from "dxAccess";
 import { accessAccess, accessFail } from "./result.js";
-import path from "tjs:path";
 import { setPasswordNow } from "./track.js";
+import { confirmRegister } from "./register.js";
+import { fontSpec } from "./assets.js";
 
 
 let mask
 
+// 遮罩、输入框和键盘单独一个页面，显示时主界面自身的控件隐藏，共享的顶栏、跟踪框在遮罩之下（被遮罩压暗）
+let passwordPage
+
 let textarea
 let keyboard
 
-let resourcePath = path.join(import.meta.dirname, '/resource');
+// 键盘确认后执行的操作：password 密码开门，register 录入姓名
+let mode = "password";
+
 
 export function initPasswordPass() {
+    passwordPage = new lvgl.Page({ build: buildPasswordPass });
+    passwordPage.preload();
+}
+
+function buildPasswordPass(page) {
     mask = new View({ uid: "mask" });
     let style = {
         'width': Window.width,
@@ -29,9 +40,14 @@ export function initPasswordPass() {
         'background-opacity': 125,
         'background-color': 0x00000000,
     }
-    mask.nativeSetStyle(style, Object.keys(style), Object.keys(style).length, 0, true);
-    hide(mask);
-    mask.addEventListener(EVENTTYPE_MAP.EVENT_CLICKED);
+    setStyle(mask, style);
+    page.add(mask);
+    onEvent(mask, EVENTTYPE_MAP.EVENT_CLICKED, (e, targetUid) => {
+        // 只响应遮罩本身，点到输入框、键盘上不关闭
+        if (targetUid == "mask") {
+            hidePasswordPass();
+        }
+    });
 
     textarea = new Textarea({ uid: "textarea" });
     mask.appendChild(textarea);
@@ -42,9 +58,9 @@ export function initPasswordPass() {
     textarea.setOneLine(true);
     textarea.setAutoKeyboard(false);
     style = {
-        'font-size-1': resourcePath + "/font/AlibabaPuHuiTi-3-65-Medium.ttf#20#0",
+        'font-size-1': fontSpec(20),
     }
-    textarea.nativeSetStyle(style, Object.keys(style), Object.keys(style).length, 0, true);
+    setStyle(textarea, style);
 
 
     keyboard = new Keyboard({ uid: "keyboard" });
@@ -54,12 +70,19 @@ export function initPasswordPass() {
         'height': Window.height / 3,
         'font-size': 8,
     }
-    keyboard.nativeSetStyle(style, Object.keys(style), Object.keys(style).length, 0, true);
+    setStyle(keyboard, style);
     keyboard.setMode(3);
     keyboard.setTextarea(textarea)
     mask.appendChild(keyboard);
-    keyboard.addEventListener(EVENTTYPE_MAP.EVENT_CANCEL)
-    keyboard.addEventListener(EVENTTYPE_MAP.EVENT_READY)
+    onEvent(keyboard, EVENTTYPE_MAP.EVENT_CANCEL, hidePasswordPass);
+    onEvent(keyboard, EVENTTYPE_MAP.EVENT_READY, () => {
+        hidePasswordPass();
+        if (mode == "password") {
+            confirmPassword();
+        } else {
+            confirmRegister();
+        }
+    });
 
 
 
@@ -69,6 +92,7 @@ export function initPasswordPass() {
 export function showPasswordPass(type) {
     face.setFacePause(true);
     textarea.setText("");
+    mode = type == "register" ? "register" : "password";
 
     if (type == "register") {
         textarea.setPlaceHolder("请输入姓名");
@@ -81,13 +105,12 @@ export function showPasswordPass(type) {
 
 
     console.log("showPasswordPass");
-    show(mask);
-    mask.moveToFront();
+    passwordPage.show();
 }
 
 export function hidePasswordPass() {
     console.log("hidePasswordPass");
-    hide(mask);
+    lvgl.Page.home.show();
     face.setFacePause(false);
 }
 
@@ -1,9 +1,9 @@
-import path from "tjs:path";
 import { EAlignType, Image, Text } from "./const.js";
 import { setRegisterNow } from "./track.js";
 import { getText } from "./password.js";
-import { hide, show } from "./utils.js";
-import { face } from "dxDriver";
+import { setImage, fontSpec } from "./assets.js";
+import { setStyle } from "./utils.js";
+import { face, lvgl } from "dxDriver";
 import { accessAccess, accessFail } from "./result.js";
 import { access } from "dxAccess";
 
@@ -12,33 +12,36 @@ let bar
 let tipIcon
 let tipText
 
-let resourcePath = path.join(import.meta.dirname, '/resource');
+// 注册倒计时提示页面
+let registerPage
+
 
 export function initRegister() {
+    registerPage = new lvgl.Page({ build: buildRegister });
+    registerPage.preload();
+}
+
+function buildRegister(page) {
     bar = new Image({ uid: "bar" });
     bar.align(EAlignType.ALIGN_TOP_MID, [0, 540]);
-    tjs.readFile(resourcePath + '/image/tip.png', { encoding: "binary" }).then((data) => {
-        bar.setImageBinary(data.buffer);
-    });
-    hide(bar);
+    setImage(bar, 'tip.png');
+    page.add(bar);
 
     tipText = new Text({ uid: "tipText" });
     tipText.align(EAlignType.ALIGN_TOP_MID, [10, 612]);
     tipText.setText("请将面部对准屏幕 3 秒后注册人脸");
     let style = {
-        'font-size-1': resourcePath + "/font/AlibabaPuHuiTi-3-65-Medium.ttf#25#0",
+        'font-size-1': fontSpec(25),
         'text-color': 0xFFFFFF
     }
-    tipText.nativeSetStyle(style, Object.keys(style), Object.keys(style).length, 0, true);
-    hide(tipText);
+    setStyle(tipText, style);
+    page.add(tipText);
 
 
     tipIcon = new Image({ uid: "tipIcon" });
     tipIcon.align(EAlignType.ALIGN_TOP_LEFT, [23, 613]);
-    tjs.readFile(resourcePath + '/image/face.png', { encoding: "binary" }).then((data) => {
-        tipIcon.setImageBinary(data.buffer);
-    });
-    hide(tipIcon);
+    setImage(tipIcon, 'face.png');
+    page.add(tipIcon);
 
 }
 
@@ -47,9 +50,7 @@ export function confirmRegister() {
     let userName = getText();
     setRegisterNow(true);
 
-    show(tipText);
-    show(tipIcon);
-    show(bar);
+    registerPage.show();
 
     let count = 3;
     let countInterval = setInterval(() => {
@@ -60,9 +61,7 @@ export function confirmRegister() {
         if (count <= 0) {
             count = 3
             tipText.setText("请将面部对准屏幕 " + count + " 秒后注册人脸");
-            hide(tipText);
-            hide(tipIcon);
-            hide(bar);
+            lvgl.Page.home.show();
             clearInterval(countInterval);
 
             face.faceRegister(userName).then((ret) => {
@@ -1,6 +1,7 @@
-import path from "tjs:path";
 import { Image, EAlignType, Text, Window } from "./const.js";
-import { hide, show } from "./utils.js";
+import { setImage, fontSpec } from "./assets.js";
+import { setStyle } from "./utils.js";
+import { lvgl } from "dxDriver";
 
 let successSideImg
 let failSideImg
@@ -14,8 +15,16 @@ let failCircleImg
 let successMsg
 let failMsg
 
+// 成功、失败提示各为一个页面，提示与回到原界面都只是一次屏幕切换。提示期间主界面自身的控件（开锁图标、二维码等）
+// 随主界面一起隐藏，只保留共享的顶栏和跟踪框（在提示图片之下）
+let successPage
+let failPage
+
+// 结果提示入场动画，由LVGL原生执行，不占用JS线程
+let successEnter
+let failEnter
+
 
-let resourcePath = path.join(import.meta.dirname, '/resource');
 
 
 let styleResult = {
@@ -25,123 +34,129 @@ let styleResult = {
 }
 
 function initResult() {
-    successSideImg = new Image({ uid: "successSideImg" });
-    successSideImg.nativeSetStyle(styleResult, Object.keys(styleResult), Object.keys(styleResult).length, 0, true)
-    tjs.readFile(resourcePath + '/image/success_side.png', { encoding: "binary" }).then((data) => {
-        successSideImg.setImageBinary(data.buffer);
-    });
-    successSideImg.moveToBackground();
-    hide(successSideImg);
-
-    failSideImg = new Image({ uid: "failSideImg" });
-    failSideImg.nativeSetStyle(styleResult, Object.keys(styleResult), Object.keys(styleResult).length, 0, true)
-    tjs.readFile(resourcePath + '/image/fail_side.png', { encoding: "binary" }).then((data) => {
-        failSideImg.setImageBinary(data.buffer);
-    });
-    failSideImg.moveToBackground();
-    hide(failSideImg);
-
-    successBarImg = new Image({ uid: "successBarImg" });
-    successBarImg.align(EAlignType.ALIGN_TOP_MID, [0, 580]);
-    tjs.readFile(resourcePath + '/image/success.png', { encoding: "binary" }).then((data) => {
-        successBarImg.setImageBinary(data.buffer);
-    });
-    hide(successBarImg);
+    let msgStyle = {
+        'font-size-1': fontSpec(25),
+        'text-color': 0xFFFFFFFF,
+    }
 
-    failBarImg = new Image({ uid: "failBarImg" });
-    failBarImg.align(EAlignType.ALIGN_TOP_MID, [0, 580]);
-    tjs.readFile(resourcePath + '/image/fail.png', { encoding: "binary" }).then((data) => {
-        failBarImg.setImageBinary(data.buffer);
+    successPage = new lvgl.Page({
+        build: (page) => {
+            successSideImg = new Image({ uid: "successSideImg" });
+            setStyle(successSideImg, styleResult);
+            setImage(successSideImg, 'success_side.png');
+            page.add(successSideImg, { background: true });
+
+            successBarImg = new Image({ uid: "successBarImg" });
+            successBarImg.align(EAlignType.ALIGN_TOP_MID, [0, 580]);
+            setImage(successBarImg, 'success.png');
+            page.add(successBarImg);
+
+            successCircleImg = new Image({ uid: "successCircleImg" });
+            successCircleImg.align(EAlignType.ALIGN_TOP_LEFT, [47, 636]);
+            setImage(successCircleImg, 'success_circle.png');
+            page.add(successCircleImg);
+
+            successMsg = new Text({ uid: "successMsg" });
+            successMsg.align(EAlignType.ALIGN_TOP_LEFT, [122, 643]);
+            successMsg.setText("人脸识别成功，请通行！");
+            setStyle(successMsg, msgStyle);
+            page.add(successMsg);
+
+            successEnter = createEnterAnimation([successBarImg, successCircleImg, successMsg]);
+        }
     });
-    hide(failBarImg);
-
-    successCircleImg = new Image({ uid: "successCircleImg" });
-    successCircleImg.align(EAlignType.ALIGN_TOP_LEFT, [47, 636]);
-    tjs.readFile(resourcePath + '/image/success_circle.png', { encoding: "binary" }).then((data) => {
-        successCircleImg.setImageBinary(data.buffer);
+    successPage.preload();
+
+    failPage = new lvgl.Page({
+        build: (page) => {
+            failSideImg = new Image({ uid: "failSideImg" });
+            setStyle(failSideImg, styleResult);
+            setImage(failSideImg, 'fail_side.png');
+            page.add(failSideImg, { background: true });
+
+            failBarImg = new Image({ uid: "failBarImg" });
+            failBarImg.align(EAlignType.ALIGN_TOP_MID, [0, 580]);
+            setImage(failBarImg, 'fail.png');
+            page.add(failBarImg);
+
+            failCircleImg = new Image({ uid: "failCircleImg" });
+            failCircleImg.align(EAlignType.ALIGN_TOP_LEFT, [47, 636]);
+            setImage(failCircleImg, 'fail_circle.png');
+            page.add(failCircleImg);
+
+            failMsg = new Text({ uid: "failMsg" });
+            failMsg.align(EAlignType.ALIGN_TOP_LEFT, [122, 643]);
+            failMsg.setText("人脸识别失败，请重试！");
+            setStyle(failMsg, msgStyle);
+            page.add(failMsg);
+
+            failEnter = createEnterAnimation([failBarImg, failCircleImg, failMsg]);
+        }
     });
-    hide(successCircleImg);
+    failPage.preload();
+}
 
-    failCircleImg = new Image({ uid: "failCircleImg" });
-    failCircleImg.align(EAlignType.ALIGN_TOP_LEFT, [47, 636]);
-    tjs.readFile(resourcePath + '/image/fail_circle.png', { encoding: "binary" }).then((data) => {
-        failCircleImg.setImageBinary(data.buffer);
+// 淡入并上移20像素
+function createEnterAnimation(comps) {
+    const tracks = [];
+    comps.forEach((comp) => {
+        tracks.push({ target: comp, prop: lvgl.ANIM_PROP.OPA, keyframes: [{ time: 0, value: 0, easing: 'ease-out' }, { time: 200, value: 255 }] });
+        tracks.push({ target: comp, prop: lvgl.ANIM_PROP.TRANSLATE_Y, keyframes: [{ time: 0, value: 20, easing: 'ease-out' }, { time: 200, value: 0 }] });
     });
+    return new lvgl.NativeAnimation({ tracks });
+}
 
-    hide(failCircleImg);
+// 提示结束后回到显示提示前的界面（主界面或密码输入）
+let resultTimer = null;
+let returnPage = null;
 
-    let msgStyle = {
-        'font-size-1': resourcePath + "/font/AlibabaPuHuiTi-3-65-Medium.ttf#25#0",
-        'text-color': 0xFFFFFFFF,
+function showResult(page, enter) {
+    if (!successPage.isCurrent() && !failPage.isCurrent()) {
+        returnPage = lvgl.Page.current() || lvgl.Page.home;
     }
-
-    successMsg = new Text({ uid: "successMsg" });
-    successMsg.align(EAlignType.ALIGN_TOP_LEFT, [122, 643]);
-    successMsg.setText("人脸识别成功，请通行！");
-    successMsg.nativeSetStyle(msgStyle, Object.keys(msgStyle), Object.keys(msgStyle).length, 0, true)
-    hide(successMsg);
-
-    failMsg = new Text({ uid: "failMsg" });
-    failMsg.align(EAlignType.ALIGN_TOP_LEFT, [122, 643]);
-    failMsg.setText("人脸识别失败，请重试！");
-    failMsg.nativeSetStyle(msgStyle, Object.keys(msgStyle), Object.keys(msgStyle).length, 0, true)
-    hide(failMsg);
+    page.show();
+    enter.start();
+    if (resultTimer) {
+        clearTimeout(resultTimer);
+    }
+    resultTimer = setTimeout(() => {
+        resultTimer = null;
+        returnPage.show();
+    }, 2000);
 }
 
-let accessAccessTimer = null;
 function accessAccess(type, message) {
     switch (type) {
         case 300:
             successMsg.setText(message || "人脸识别成功，请通行！");
             break;
+        case 200:
+            successMsg.setText(message || "刷卡开门成功，请通行！");
+            break;
         case 400:
             successMsg.setText(message || "密码开门成功，请通行！");
             break;
         default:
             break;
     }
-    show(successSideImg);
-    show(successBarImg);
-    show(successCircleImg);
-    show(successMsg);
-    if (accessAccessTimer) {
-        clearTimeout(accessAccessTimer);
-        accessAccessTimer = null;
-    }
-    accessAccessTimer = setTimeout(() => {
-        hide(successSideImg);
-        hide(successBarImg);
-        hide(successCircleImg);
-        hide(successMsg);
-    }, 2000);
+    showResult(successPage, successEnter);
 }
 
-let accessFailTimer = null;
 function accessFail(type, message) {
     switch (type) {
         case 300:
             failMsg.setText(message || "人脸识别失败，请重试！");
             break;
+        case 200:
+            failMsg.setText(message || "刷卡失败，请重试！");
+            break;
         case 400:
             failMsg.setText(message || "密码开门失败，请重试！");
             break;
         default:
             break;
     }
-    show(failSideImg);
-    show(failBarImg);
-    show(failCircleImg);
-    show(failMsg);
-    if (accessFailTimer) {
-        clearTimeout(accessFailTimer);
-        accessFailTimer = null;
-    }
-    accessFailTimer = setTimeout(() => {
-        hide(failSideImg);
-        hide(failBarImg);
-        hide(failCircleImg);
-        hide(failMsg);
-    }, 2000);
+    showResult(failPage, failEnter);
 }
 
 
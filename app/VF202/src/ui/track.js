@@ -1,23 +1,33 @@
-import path from "tjs:path";
 import { EAlignType, EVENTTYPE_MAP, View, Textarea, Text, Button, Image, Dropdownlist, Keyboard, Window } from "./const.js";
-import { face } from "dxDriver";
-const { getFaceRecognitionResult, getFaceTrackData, faceGetSavedPicturePath } = face;
-import { hide, show } from "./utils.js";
-import { access, config } from "dxAccess";
+import { face, lvgl } from "dxDriver";
+const { getFaceRecognitionResult, getFaceTrackData, faceGetSavedPicturePath, faceLatencyMark, FACE_LATENCY_STAGE } = face;
+import { hide, show, setStyleValue, setStyle } from "./utils.js";
+import { setImage, loadImage, fontSpec, fontPath } from "./assets.js";
+import { access } from "dxAccess";
 import { accessAccess, accessFail } from "./result.js";
 
-// 跟踪框白色
-let trackWhiteImg
-// 跟踪框绿色
-let trackGreenImg
-// 跟踪框红色
-let trackRedImg
+const { OVERLAY_STATE } = lvgl;
+// 跟踪框图片：白色检测中，绿色识别成功，红色识别失败
+const TRACK_IMAGES = {
+    [OVERLAY_STATE.IDLE]: { uid: 'trackWhiteImg', file: 'track_white.png' },
+    [OVERLAY_STATE.SUCCESS]: { uid: 'trackGreenImg', file: 'track_green.png' },
+    [OVERLAY_STATE.FAIL]: { uid: 'trackRedImg', file: 'track_red.png' },
+}
+// 叠加层不可用时用Image控件绘制，状态 -> 控件
+let trackImgs = {}
 // 当前跟踪框
 let trackBoxNow
+let trackStateNow = OVERLAY_STATE.IDLE
+// 原生叠加层是否可用，可用时跟踪框和姓名由叠加层直接绘制，JS只轮询识别结果
+let overlayActive = false
+// 叠加层已处理的人脸离开次数
+let overlayLost = 0
+// 轮询周期：叠加层绘制跟踪框时只需取识别结果，不必逐帧轮询
+const POLL_INTERVAL = 5
+const OVERLAY_POLL_INTERVAL = 20
 
 let userNameText
 
-let resourcePath = path.join(import.meta.dirname, '/resource');
 
 // 当前识别状态
 let statusNow = null;
@@ -37,12 +47,22 @@ export function setRegisterNow(now) {
 export function setPasswordNow(now) {
     passwordNow = now;
 }
-let configManager = await config.initConfigManager();
-setInterval(async () => {
-    let trackData = getFaceTrackData();
-    if (trackData) {
-        // console.log(trackData);
-        drawTrackBox(trackData.x1, trackData.y1, trackData.x2, trackData.y2);
+let configManager = null;
+// 轮询跟踪框和识别结果
+function pollFace() {
+    if (overlayActive) {
+        // 人脸离开时叠加层已隐藏跟踪框并复位为白色，这里只复位识别状态
+        let lost = lvgl.overlayLostCount();
+        if (lost !== overlayLost) {
+            overlayLost = lost;
+            resetTrackState();
+        }
+    } else {
+        let trackData = getFaceTrackData();
+        if (trackData) {
+            // console.log(trackData);
+            drawTrackBox(trackData.x1, trackData.y1, trackData.x2, trackData.y2);
+        }
     }
     getFaceRecognitionResult((recognitionData) => {
         // console.log(recognitionData);
@@ -51,6 +71,10 @@ setInterval(async () => {
         }
         if (recognitionData.score > 0.6) {
             userNameNow = recognitionData.userid;
+            if (overlayActive && userNameDrawn !== userNameNow) {
+                lvgl.overlaySetLabel(userNameNow);
+                userNameDrawn = userNameNow;
+            }
         } else {
             return
         }
@@ -73,23 +97,19 @@ setInterval(async () => {
             const result = access.accessByUserName(recognitionData.userid);
             success = result.success;
         }
+        faceLatencyMark(recognitionData.trace_id, FACE_LATENCY_STAGE.ACCESS);
 
         statusNow = success;
         if (success) {
-            if (trackBoxNow !== trackGreenImg) {
-                hide(trackBoxNow);
-                trackBoxNow = trackGreenImg;
-            }
+            switchTrackBox(OVERLAY_STATE.SUCCESS);
             accessAccess(300);
             save_image = true;
         } else {
-            if (trackBoxNow !== trackRedImg) {
-                hide(trackBoxNow);
-                trackBoxNow = trackRedImg;
-            }
+            switchTrackBox(OVERLAY_STATE.FAIL);
             accessFail(300);
             save_image = true;
         }
+        faceLatencyMark(recognitionData.trace_id, FACE_LATENCY_STAGE.RESULT);
         // setTimeout(() => {
             let savedPicturePath = faceGetSavedPicturePath();
             console.log(savedPicturePath);
@@ -100,76 +120,137 @@ setInterval(async () => {
         }, 5000);
         return save_image;
     });
-}, 5);
+}
 
 
+// 切换跟踪框颜色
+function switchTrackBox(state) {
+    if (trackStateNow === state) {
+        return;
+    }
+    trackStateNow = state;
+    if (overlayActive) {
+        lvgl.overlaySetState(state);
+        return;
+    }
+    hide(trackBoxNow);
+    trackBoxNow = trackImgs[state];
+}
+
 let trackBoxTimer = null;
 let picWidth = 367;
 let picHeight = 373;
+// 上一次下发的跟踪框位置，人脸静止时不再重复对齐
+let trackBoxDrawn = null;
+let trackBoxX = null;
+let trackBoxY = null;
+let userNameDrawn = null;
 function drawTrackBox(x1, y1, x2, y2) {
     show(trackBoxNow)
     let width = x2 - x1;
     let height = y2 - y1;
     // 中心坐标对齐
-    let centerX = x1 + width / 2 - picWidth / 2;
-    let centerY = y1 + height / 2 - picHeight / 2 + 20;
-    trackBoxNow.align(EAlignType.ALIGN_TOP_LEFT, [centerX, centerY]);
-    trackBoxNow.nativeSetStyle({ 'img-scale': 256 * width / picHeight * 1.2 }, ['img-scale'], 1, 0, true)
+    let centerX = Math.round(x1 + width / 2 - picWidth / 2);
+    let centerY = Math.round(y1 + height / 2 - picHeight / 2 + 20);
+    let moved = trackBoxDrawn !== trackBoxNow || centerX !== trackBoxX || centerY !== trackBoxY;
+    if (moved) {
+        trackBoxNow.align(EAlignType.ALIGN_TOP_LEFT, [centerX, centerY]);
+        trackBoxDrawn = trackBoxNow;
+        trackBoxX = centerX;
+        trackBoxY = centerY;
+    }
+    // img-scale为整数（256为原始大小），值不变时不下发
+    if (setStyleValue(trackBoxNow, 'img-scale', Math.round(256 * width / picHeight * 1.2))) {
+        moved = true;
+    }
 
 
     if (userNameNow) {
-        userNameText.setText(userNameNow);
+        if (userNameDrawn !== userNameNow) {
+            userNameText.setText(userNameNow);
+            userNameDrawn = userNameNow;
+            moved = true;
+        }
         show(userNameText);
-        userNameText.alignTo(EAlignType.ALIGN_CENTER, [0, 0], trackBoxNow);
+        if (moved) {
+            userNameText.alignTo(EAlignType.ALIGN_CENTER, [0, 0], trackBoxNow);
+        }
     }
 
 
+    resetTrackBoxTimer();
+}
+
+// 人脸离开400ms后复位跟踪框和识别状态
+function resetTrackBoxTimer() {
     if (trackBoxTimer) {
         clearTimeout(trackBoxTimer);
         trackBoxTimer = null;
     }
     trackBoxTimer = setTimeout(() => {
-        userNameNow = null;
         hide(trackBoxNow)
-        trackBoxNow = trackWhiteImg;
+        trackBoxNow = trackImgs[OVERLAY_STATE.IDLE];
+        trackStateNow = OVERLAY_STATE.IDLE;
         hide(userNameText);
-        statusNow = null
-        if (statusNowTimer) {
-            clearTimeout(statusNowTimer);
-            statusNowTimer = null;
-        }
+        resetTrackState();
     }, 400);
+}
 
+// 人脸离开后复位识别状态
+function resetTrackState() {
+    trackStateNow = OVERLAY_STATE.IDLE;
+    userNameNow = null;
+    userNameDrawn = null;
+    statusNow = null
+    if (statusNowTimer) {
+        clearTimeout(statusNowTimer);
+        statusNowTimer = null;
+    }
 }
 
 
-export function trackInit() {
-    trackWhiteImg = new Image({ uid: "trackWhiteImg" });
-    tjs.readFile(resourcePath + '/image/track_white.png', { encoding: "binary" }).then((data) => {
-        trackWhiteImg.setImageBinary(data.buffer);
-    });
-    hide(trackWhiteImg);
-    trackGreenImg = new Image({ uid: "trackGreenImg" });
-    tjs.readFile(resourcePath + '/image/track_green.png', { encoding: "binary" }).then((data) => {
-        trackGreenImg.setImageBinary(data.buffer);
-    });
-    hide(trackGreenImg);
-    trackRedImg = new Image({ uid: "trackRedImg" });
-    tjs.readFile(resourcePath + '/image/track_red.png', { encoding: "binary" }).then((data) => {
-        trackRedImg.setImageBinary(data.buffer);
-    });
-    hide(trackRedImg);
+export function trackInit(manager) {
+    configManager = manager;
 
+    // 优先使用原生叠加层，不可用时按原方式用图片绘制
+    if (lvgl.overlayInit() === 0) {
+        overlayActive = true;
+        overlayLost = lvgl.overlayLostCount();
+        for (const state of Object.values(OVERLAY_STATE)) {
+            const { file } = TRACK_IMAGES[state];
+            loadImage(file).then((buffer) => {
+                if (lvgl.overlaySetImage(state, buffer) !== 0) {
+                    console.log(`跟踪框图片设置失败: ${file}`);
+                }
+            });
+        }
+        lvgl.overlaySetFont(fontPath(), 40);
+        lvgl.overlaySetMode(lvgl.OVERLAY_MODE.TRACK);
+        return;
+    }
+
+    for (const state of Object.values(OVERLAY_STATE)) {
+        const { uid, file } = TRACK_IMAGES[state];
+        trackImgs[state] = new Image({ uid });
+        setImage(trackImgs[state], file);
+        hide(trackImgs[state]);
+        // 其他页面上也显示跟踪框，位于页面自身的遮罩、提示之下
+        lvgl.Page.share(trackImgs[state]);
+    }
 
     userNameText = new Text({ uid: "userNameText" });
     let userNameTextStyle = {
-        'font-size-1': resourcePath + "/font/AlibabaPuHuiTi-3-65-Medium.ttf#40#0",
+        'font-size-1': fontSpec(40),
         'text-color': 0xFFFFFFFF,
     }
-    userNameText.nativeSetStyle(userNameTextStyle, Object.keys(userNameTextStyle), Object.keys(userNameTextStyle).length, 0, true)
+    setStyle(userNameText, userNameTextStyle);
     hide(userNameText);
+    lvgl.Page.share(userNameText);
 
-
-    trackBoxNow = trackWhiteImg
+    trackBoxNow = trackImgs[OVERLAY_STATE.IDLE]
 }
 
+// 开始轮询识别结果，识别后要查库校验权限，需在人脸模块和数据库就绪后调用
+export function trackStart() {
+    setInterval(pollFace, overlayActive ? OVERLAY_POLL_INTERVAL : POLL_INTERVAL);
+}
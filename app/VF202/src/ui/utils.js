@@ -1,16 +1,113 @@
-let hideStyle = {
-    display: "none",
+// 预编译样式：键数组只生成一次，后续直接复用
+function createStyle(style) {
+    const keys = Object.keys(style);
+    return Object.freeze({ style, keys, length: keys.length });
 }
-let showStyle = {
-    display: "block",
+
+// 每个控件最近一次下发到底层的样式值，值未变化时不再跨越JS->native
+const appliedStyles = new WeakMap();
+
+function getApplied(comp) {
+    let applied = appliedStyles.get(comp);
+    if (!applied) {
+        applied = {};
+        appliedStyles.set(comp, applied);
+    }
+    return applied;
+}
+
+// 应用预编译样式，只要有一个键的值变化就整体下发，返回是否实际调用了底层
+function applyStyle(comp, handle) {
+    const applied = getApplied(comp);
+    let changed = false;
+    for (let i = 0; i < handle.length; i++) {
+        const key = handle.keys[i];
+        if (applied[key] !== handle.style[key]) {
+            applied[key] = handle.style[key];
+            changed = true;
+        }
+    }
+    if (changed) {
+        comp.nativeSetStyle(handle.style, handle.keys, handle.length, 0, true);
+    }
+    return changed;
+}
+
+// 批量应用样式 [{ comp, handle }]，返回实际下发的个数
+function applyStyles(list) {
+    let count = 0;
+    for (let i = 0; i < list.length; i++) {
+        if (applyStyle(list[i].comp, list[i].handle)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// 下发一次性的样式对象（初始化时的静态样式），同样经过缓存，之后的 hide/show/setStyleValue 据此判断是否变化
+function setStyle(comp, style) {
+    return applyStyle(comp, createStyle(style));
 }
 
+// 单个样式键的缓存键数组，避免每帧创建新数组
+const singleKeys = {};
+
+// 设置单个动态样式值（如img-scale），值未变化时跳过
+function setStyleValue(comp, key, value) {
+    const applied = getApplied(comp);
+    if (applied[key] === value) {
+        return false;
+    }
+    applied[key] = value;
+    let keys = singleKeys[key];
+    if (!keys) {
+        keys = singleKeys[key] = [key];
+    }
+    comp.nativeSetStyle({ [key]: value }, keys, 1, 0, true);
+    return true;
+}
+
+const hideStyle = createStyle({
+    display: "none",
+})
+const showStyle = createStyle({
+    display: "block",
+})
+
 function hide(obj) {
-    obj.nativeSetStyle(hideStyle, Object.keys(hideStyle), Object.keys(hideStyle).length, 0, true)
+    applyStyle(obj, hideStyle)
 }
 
 function show(obj) {
-    obj.nativeSetStyle(showStyle, Object.keys(showStyle), Object.keys(showStyle).length, 0, true)
+    applyStyle(obj, showStyle)
 }
 
-export { hide, show }
\ No newline at end of file
+// 事件处理函数表：按事件类型下标，每个类型一个 uid -> 处理函数的 Map，分发时直接查表
+const eventHandlers = [];
+
+/**
+ * 订阅控件事件，原生侧只回调订阅过的类型；同一控件同一类型重复订阅只替换处理函数
+ * @param {Object} comp 控件
+ * @param {number} type EVENTTYPE_MAP 中的事件类型
+ * @param {Function} fn (e, targetUid, point) => void，targetUid 为实际触发的子控件
+ */
+function onEvent(comp, type, fn) {
+    let table = eventHandlers[type];
+    if (!table) {
+        table = eventHandlers[type] = new Map();
+    }
+    if (!table.has(comp.uid)) {
+        comp.addEventListener(type);
+    }
+    table.set(comp.uid, fn);
+}
+
+globalThis.FIRE_QEVENT_CALLBACK = (targetUid, currentTargetUid, eventType, e, point) => {
+    const table = eventHandlers[eventType];
+    const fn = table && table.get(currentTargetUid);
+    if (fn) {
+        fn(e, targetUid, point);
+    }
+};
+
+export { hide, show, createStyle, applyStyle, applyStyles, setStyle, setStyleValue, onEvent }
@@ -2,6 +2,7 @@ import { Button, Render, Text, View } from "lvgljs-ui";
 import React from "react";
 import "./test/gpio.js"
 import "./test/net.js"
+import { TextUpdateTest } from "./test/text.jsx";
 
 function App() {
   return (
@@ -9,6 +10,7 @@ function App() {
       <Button style={{ "background-color": "red" }}>
         <Text>Hello</Text>
       </Button>
+      <TextUpdateTest />
     </View>
   );
 }
@@ -0,0 +1,33 @@
+import { Text } from "lvgljs-ui";
+import React, { useEffect, useRef, useState } from "react";
+
+// 文本内容作为子节点传入时，首次渲染和重新渲染都应下发到原生控件
+const EXPECTED = ["0", "1", "2"];
+
+// 首次渲染在 ref 可用之前就已下发文本，需在渲染前挂到原生 Text 的原型上记录，
+// 之后按控件对象筛出本测试的调用
+const NativeText = globalThis[Symbol.for('lvgljs')].NativeRender.NativeComponents.Text;
+const nativeSetText = NativeText.prototype.setText;
+const calls = [];
+NativeText.prototype.setText = function (text) {
+  calls.push({ comp: this, text });
+  return nativeSetText.call(this, text);
+};
+
+export function TextUpdateTest() {
+  const [count, setCount] = useState(0);
+  const textRef = useRef(null);
+
+  useEffect(() => {
+    if (count < EXPECTED.length - 1) {
+      setTimeout(() => setCount(count + 1), 100);
+      return;
+    }
+    NativeText.prototype.setText = nativeSetText;
+    const received = calls.filter((call) => call.comp === textRef.current).map((call) => String(call.text));
+    const ok = received.join(",") === EXPECTED.join(",");
+    console.log(ok ? "Text子节点更新测试通过" : `Text子节点更新测试失败: ${received.join(",")}`);
+  }, [count]);
+
+  return <Text ref={textRef}>{count}</Text>;
+}
@@ -0,0 +1,455 @@
+#define _GNU_SOURCE
+#include "bytecode.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <dlfcn.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <quickjs/quickjs.h>
+
+#define BYTECODE_MAGIC 0x43425844 // "DXBC"
+#define BYTECODE_VERSION 1
+#define BYTECODE_ALIGN 16
+
+// QuickJS接口从lvgljs进程中按名字查找，类型取自quickjs.h
+#define JS_SYM(name) static __typeof__(&name) p_##name = NULL
+#define JS_LOAD(name) (p_##name = (__typeof__(&name))dlsym(RTLD_DEFAULT, #name))
+
+JS_SYM(JS_NewRuntime);
+JS_SYM(JS_SetMaxStackSize);
+JS_SYM(JS_FreeRuntime);
+JS_SYM(JS_NewContext);
+JS_SYM(JS_FreeContext);
+JS_SYM(JS_Eval);
+JS_SYM(JS_WriteObject);
+JS_SYM(JS_GetException);
+JS_SYM(JS_ToCStringLen2);
+JS_SYM(JS_FreeCString);
+JS_SYM(__JS_FreeValue);
+JS_SYM(js_free);
+
+// 镜像布局：文件头、模块表、各模块字节码（按 BYTECODE_ALIGN 对齐），偏移均相对文件开头
+struct image_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    uint32_t size; // 文件总长
+    int64_t engine_size;
+    int64_t engine_mtime;
+};
+
+struct image_entry
+{
+    char path[BYTECODE_PATH_LEN];
+    int64_t source_size;
+    int64_t source_mtime;
+    uint32_t offset;
+    uint32_t size;
+};
+
+static pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int g_building = 0;
+static const uint8_t *g_image = NULL;
+static size_t g_image_size = 0;
+
+static int js_syms_loaded(void)
+{
+    static int ok = -1;
+    if (ok < 0)
+    {
+        ok = JS_LOAD(JS_NewRuntime) && JS_LOAD(JS_SetMaxStackSize) && JS_LOAD(JS_FreeRuntime) &&
+             JS_LOAD(JS_NewContext) && JS_LOAD(JS_FreeContext) && JS_LOAD(JS_Eval) &&
+             JS_LOAD(JS_WriteObject) && JS_LOAD(JS_GetException) && JS_LOAD(JS_ToCStringLen2) &&
+             JS_LOAD(JS_FreeCString) && JS_LOAD(__JS_FreeValue) && JS_LOAD(js_free);
+        if (!ok)
+        {
+            printf("bytecode: 当前引擎未导出 QuickJS 接口，无法生成字节码\n");
+        }
+    }
+    return ok;
+}
+
+// quickjs.h 中的 JS_FreeValue 是内联函数，直接引用 __JS_FreeValue，这里改为调用查找到的接口
+static void free_value(JSContext *ctx, JSValue v)
+{
+    if (JS_VALUE_HAS_REF_COUNT(v))
+    {
+        JSRefCountHeader *p = (JSRefCountHeader *)JS_VALUE_GET_PTR(v);
+        if (--p->ref_count <= 0)
+        {
+            p___JS_FreeValue(ctx, v);
+        }
+    }
+}
+
+// 引擎程序升级后字节码格式可能变化，镜像随之失效
+static int engine_stat(struct stat *st)
+{
+    return stat("/proc/self/exe", st);
+}
+
+static size_t align_up(size_t n)
+{
+    return (n + BYTECODE_ALIGN - 1) & ~(size_t)(BYTECODE_ALIGN - 1);
+}
+
+// ---------------- 生成 ----------------
+
+struct module_t
+{
+    char path[BYTECODE_PATH_LEN];
+    struct stat st;
+    uint8_t *data;
+    size_t size;
+};
+
+struct build_job
+{
+    char *image_path;
+    char *paths;
+};
+
+static void print_exception(JSContext *ctx, const char *path)
+{
+    JSValue exception = p_JS_GetException(ctx);
+    const char *msg = p_JS_ToCStringLen2(ctx, NULL, exception, 0);
+    printf("bytecode: 编译 %s 失败: %s\n", path, msg ? msg : "未知错误");
+    if (msg)
+    {
+        p_JS_FreeCString(ctx, msg);
+    }
+    free_value(ctx, exception);
+}
+
+static int compile_module(JSContext *ctx, struct module_t *m)
+{
+    FILE *fp = fopen(m->path, "rb");
+    if (!fp)
+    {
+        printf("bytecode: 打开 %s 失败: %s\n", m->path, strerror(errno));
+        return -1;
+    }
+    // 以打开后的状态为准，编译期间源文件被替换时镜像在下次校验时失效
+    if (fstat(fileno(fp), &m->st) != 0)
+    {
+        fclose(fp);
+        return -1;
+    }
+    // JS_Eval 要求源码以 '\0' 结尾
+    char *source = malloc(m->st.st_size + 1);
+    size_t len = source ? fread(source, 1, m->st.st_size, fp) : 0;
+    fclose(fp);
+    if (!source || len != (size_t)m->st.st_size)
+    {
+        free(source);
+        return -1;
+    }
+    source[len] = '\0';
+
+    JSValue obj = p_JS_Eval(ctx, source, len, m->path, JS_EVAL_TYPE_MODULE | JS_EVAL_FLAG_COMPILE_ONLY);
+    free(source);
+    if (JS_IsException(obj))
+    {
+        print_exception(ctx, m->path);
+        return -1;
+    }
+    size_t size = 0;
+    uint8_t *data = p_JS_WriteObject(ctx, &size, obj, JS_WRITE_OBJ_BYTECODE);
+    free_value(ctx, obj);
+    if (!data)
+    {
+        print_exception(ctx, m->path);
+        return -1;
+    }
+    m->data = malloc(size);
+    if (m->data)
+    {
+        memcpy(m->data, data, size);
+        m->size = size;
+    }
+    p_js_free(ctx, data);
+    return m->data ? 0 : -1;
+}
+
+static int write_image(const char *image_path, struct module_t *modules, int count)
+{
+    struct stat engine;
+    if (engine_stat(&engine) != 0)
+    {
+        return -1;
+    }
+    size_t offset = align_up(sizeof(struct image_header) + sizeof(struct image_entry) * count);
+    struct image_entry entries[BYTECODE_MAX];
+    memset(entries, 0, sizeof(entries));
+    for (int i = 0; i < count; i++)
+    {
+        strncpy(entries[i].path, modules[i].path, BYTECODE_PATH_LEN - 1);
+        entries[i].source_size = modules[i].st.st_size;
+        entries[i].source_mtime = modules[i].st.st_mtime;
+        entries[i].offset = offset;
+        entries[i].size = modules[i].size;
+        offset = align_up(offset + modules[i].size);
+    }
+    struct image_header header = {
+        .magic = BYTECODE_MAGIC,
+        .version = BYTECODE_VERSION,
+        .count = count,
+        .size = offset,
+        .engine_size = engine.st_size,
+        .engine_mtime = engine.st_mtime,
+    };
+
+    char tmp_path[BYTECODE_PATH_LEN + 8];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", image_path);
+    FILE *fp = fopen(tmp_path, "wb");
+    if (!fp)
+    {
+        printf("bytecode: 创建 %s 失败: %s\n", tmp_path, strerror(errno));
+        return -1;
+    }
+    static const uint8_t padding[BYTECODE_ALIGN] = {0};
+    size_t pos = sizeof(header) + sizeof(struct image_entry) * count;
+    int ok = fwrite(&header, sizeof(header), 1, fp) == 1 &&
+             fwrite(entries, sizeof(struct image_entry), count, fp) == (size_t)count;
+    for (int i = 0; ok && i < count; i++)
+    {
+        ok = fwrite(padding, 1, entries[i].offset - pos, fp) == entries[i].offset - pos &&
+             fwrite(modules[i].data, 1, modules[i].size, fp) == modules[i].size;
+        pos = entries[i].offset + modules[i].size;
+    }
+    ok = ok && fwrite(padding, 1, offset - pos, fp) == offset - pos;
+    ok = ok && fflush(fp) == 0 && fsync(fileno(fp)) == 0;
+    ok = fclose(fp) == 0 && ok;
+    if (!ok || rename(tmp_path, image_path) != 0)
+    {
+        printf("bytecode: 写入 %s 失败: %s\n", image_path, strerror(errno));
+        unlink(tmp_path);
+        return -1;
+    }
+    return 0;
+}
+
+static int build_image(const char *image_path, const char *paths)
+{
+    struct module_t *modules = calloc(BYTECODE_MAX, sizeof(struct module_t));
+    if (!modules)
+    {
+        return -1;
+    }
+    int count = 0;
+    int ret = -1;
+    const char *p = paths;
+    while (*p && count < BYTECODE_MAX)
+    {
+        size_t len = strcspn(p, "\n");
+        if (len > 0 && len < BYTECODE_PATH_LEN)
+        {
+            memcpy(modules[count].path, p, len);
+            count++;
+        }
+        p += len + (p[len] == '\n');
+    }
+
+    JSRuntime *rt = p_JS_NewRuntime();
+    JSContext *ctx = rt ? p_JS_NewContext(rt) : NULL;
+    if (ctx)
+    {
+        p_JS_SetMaxStackSize(rt, 768 * 1024);
+        ret = count > 0 ? 0 : -1;
+        for (int i = 0; i < count && ret == 0; i++)
+        {
+            ret = compile_module(ctx, &modules[i]);
+        }
+        if (ret == 0)
+        {
+            ret = write_image(image_path, modules, count);
+        }
+    }
+    if (ctx)
+    {
+        p_JS_FreeContext(ctx);
+    }
+    if (rt)
+    {
+        p_JS_FreeRuntime(rt);
+    }
+    size_t total = 0;
+    for (int i = 0; i < count; i++)
+    {
+        total += modules[i].size;
+        free(modules[i].data);
+    }
+    free(modules);
+    if (ret == 0)
+    {
+        printf("bytecode: 已生成 %s，%d 个模块，字节码 %zu 字节\n", image_path, count, total);
+    }
+    return ret;
+}
+
+static void *build_thread(void *arg)
+{
+    struct build_job *job = arg;
+    // 只在空闲时编译，不影响识别和界面刷新
+    setpriority(PRIO_PROCESS, syscall(SYS_gettid), 19);
+    build_image(job->image_path, job->paths);
+    free(job->image_path);
+    free(job->paths);
+    free(job);
+    pthread_mutex_lock(&g_mutex);
+    g_building = 0;
+    pthread_mutex_unlock(&g_mutex);
+    return NULL;
+}
+
+int bytecode_build_async(const char *image_path, const char *paths)
+{
+    if (!image_path || !paths || strlen(image_path) >= BYTECODE_PATH_LEN || !js_syms_loaded())
+    {
+        return -1;
+    }
+    pthread_mutex_lock(&g_mutex);
+    if (g_building)
+    {
+        pthread_mutex_unlock(&g_mutex);
+        return -1;
+    }
+    struct build_job *job = calloc(1, sizeof(struct build_job));
+    if (job)
+    {
+        job->image_path = strdup(image_path);
+        job->paths = strdup(paths);
+    }
+    int ret = -1;
+    if (job && job->image_path && job->paths)
+    {
+        // 解析器递归较深，线程栈比运行时栈上限留出余量
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        pthread_attr_setstacksize(&attr, 1024 * 1024);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        pthread_t tid;
+        if (pthread_create(&tid, &attr, build_thread, job) == 0)
+        {
+            g_building = 1;
+            ret = 0;
+        }
+        pthread_attr_destroy(&attr);
+    }
+    if (ret != 0 && job)
+    {
+        free(job->image_path);
+        free(job->paths);
+        free(job);
+    }
+    pthread_mutex_unlock(&g_mutex);
+    return ret;
+}
+
+// ---------------- 加载 ----------------
+
+static const struct image_entry *entry_at(int index)
+{
+    if (!g_image || index < 0 || (uint32_t)index >= ((const struct image_header *)g_image)->count)
+    {
+        return NULL;
+    }
+    return (const struct image_entry *)(g_image + sizeof(struct image_header)) + index;
+}
+
+static int image_valid(const uint8_t *image, size_t size)
+{
+    const struct image_header *header = (const struct image_header *)image;
+    if (size < sizeof(*header) || header->magic != BYTECODE_MAGIC || header->version != BYTECODE_VERSION ||
+        header->size != size || header->count == 0 || header->count > BYTECODE_MAX ||
+        sizeof(*header) + sizeof(struct image_entry) * header->count > size)
+    {
+        return 0;
+    }
+    struct stat st;
+    if (engine_stat(&st) != 0 || st.st_size != header->engine_size || st.st_mtime != header->engine_mtime)
+    {
+        printf("bytecode: 引擎已更新，镜像失效\n");
+        return 0;
+    }
+    const struct image_entry *entries = (const struct image_entry *)(image + sizeof(*header));
+    for (uint32_t i = 0; i < header->count; i++)
+    {
+        const struct image_entry *e = &entries[i];
+        if (e->offset % BYTECODE_ALIGN != 0 || e->offset > size || e->size > size - e->offset ||
+            memchr(e->path, '\0', BYTECODE_PATH_LEN) == NULL)
+        {
+            return 0;
+        }
+        if (stat(e->path, &st) != 0 || st.st_size != e->source_size || st.st_mtime != e->source_mtime)
+        {
+            printf("bytecode: %s 已修改，镜像失效\n", e->path);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int bytecode_open(const char *image_path)
+{
+    bytecode_close();
+    int fd = open(image_path, O_RDONLY);
+    if (fd < 0)
+    {
+        return -1;
+    }
+    struct stat st;
+    void *addr = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (addr == MAP_FAILED)
+    {
+        return -1;
+    }
+    if (!image_valid(addr, st.st_size))
+    {
+        munmap(addr, st.st_size);
+        return -1;
+    }
+    g_image = addr;
+    g_image_size = st.st_size;
+    return ((const struct image_header *)g_image)->count;
+}
+
+int bytecode_size(int index)
+{
+    const struct image_entry *e = entry_at(index);
+    return e ? (int)e->size : -1;
+}
+
+int bytecode_read(int index, uint8_t *buf, size_t size)
+{
+    const struct image_entry *e = entry_at(index);
+    if (!e || !buf || size < e->size)
+    {
+        return -1;
+    }
+    memcpy(buf, g_image + e->offset, e->size);
+    return e->size;
+}
+
+void bytecode_close(void)
+{
+    if (g_image)
+    {
+        munmap((void *)g_image, g_image_size);
+        g_image = NULL;
+        g_image_size = 0;
+    }
+}
@@ -0,0 +1,49 @@
+#ifndef BYTECODE_H
+#define BYTECODE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 模块字节码镜像：把 app 的 JS 模块预编译为 QuickJS 字节码（JS_WriteObject），打包成一个文件，
+// 启动时映射后直接反序列化，省去从源码解析的时间和解析期间的内存峰值
+//
+// 编译使用 lvgljs 进程中的 QuickJS（按名字查找），保证字节码格式与加载它的引擎一致，
+// 因此只能在设备上生成；镜像记录引擎程序和各源文件的大小、修改时间，任何一项变化都视为失效
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BYTECODE_MAX 32
+#define BYTECODE_PATH_LEN 128
+
+/**
+ * @brief 异步编译并生成镜像，在独立线程（低优先级、独立的 JS 运行时）中完成，不阻塞 JS 线程
+ *
+ * @param image_path 镜像文件，先写临时文件再改名，生成失败时不影响已有镜像
+ * @param paths 模块源文件绝对路径，以换行分隔，第一个为入口；路径同时作为模块名
+ *
+ * @return 0已开始，-1参数错误、引擎不支持或已有编译在进行
+ */
+int bytecode_build_async(const char *image_path, const char *paths);
+
+/**
+ * @brief 映射并校验镜像，同一时间只打开一个镜像
+ *
+ * @return 模块个数，-1表示镜像不存在、格式错误或已失效
+ */
+int bytecode_open(const char *image_path);
+
+// 第 index 个模块的字节码长度，-1表示编号无效
+int bytecode_size(int index);
+
+// 复制第 index 个模块的字节码（按镜像顺序，0为入口），返回复制的长度，-1表示编号无效或缓冲区不足
+int bytecode_read(int index, uint8_t *buf, size_t size);
+
+void bytecode_close(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BYTECODE_H
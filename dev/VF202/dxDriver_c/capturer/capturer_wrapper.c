@@ -1,6 +1,8 @@
-#include "capturer.h"
+#include "capturer_wrapper.h"
 #include "./include/capturer.h"
 #include <stdio.h>
+#include <string.h>
+#include <pthread.h>
 
 static struct vbar_m_capturer_config config1 =
     {
@@ -94,3 +96,137 @@ void capturer_nir_deinit(void)
         printf("app_nir_capturer has not been initialized\n");
     }
 }
+
+// ---------------- 帧池 ----------------
+
+// 两路摄像头各3个驱动缓冲区，再留出余量给未及时释放的帧
+#define FRAME_POOL_SIZE 8
+
+struct capturer_frame
+{
+    struct vbar_drv_image *image;
+    int channel;
+    int refcount;
+};
+
+static struct capturer_frame g_frames[FRAME_POOL_SIZE];
+static struct capturer_frame_pool_stats g_pool_stats[CAPTURER_CHANNEL_NUM];
+static pthread_mutex_t g_pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static struct vbar_m_capturer_handle *capturer_get_handle(int channel)
+{
+    if (channel == CAPTURER_CHANNEL_RGB)
+    {
+        return app_rgb_capturer;
+    }
+    if (channel == CAPTURER_CHANNEL_NIR)
+    {
+        return app_nir_capturer;
+    }
+    return NULL;
+}
+
+static struct capturer_frame *frame_find_locked(const struct vbar_drv_image *image)
+{
+    for (int i = 0; i < FRAME_POOL_SIZE; i++)
+    {
+        if (g_frames[i].image == image)
+        {
+            return &g_frames[i];
+        }
+    }
+    return NULL;
+}
+
+struct vbar_drv_image *capturer_frame_read(int channel)
+{
+    struct vbar_m_capturer_handle *handle = capturer_get_handle(channel);
+    if (!handle)
+    {
+        return NULL;
+    }
+
+    // 读取会阻塞到下一帧，不能持锁
+    struct vbar_drv_image *image = vbar_m_capturer_read(handle);
+    if (!image)
+    {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&g_pool_mutex);
+    struct capturer_frame_pool_stats *stats = &g_pool_stats[channel];
+    // image为NULL的槽位即空闲槽位
+    struct capturer_frame *frame = frame_find_locked(NULL);
+    stats->reads++;
+    if (frame)
+    {
+        frame->image = image;
+        frame->channel = channel;
+        frame->refcount = 1;
+        stats->in_use++;
+        if (stats->in_use > stats->peak)
+        {
+            stats->peak = stats->in_use;
+        }
+    }
+    else
+    {
+        // 池满时不登记，释放时直接归还驱动
+        stats->untracked++;
+    }
+    pthread_mutex_unlock(&g_pool_mutex);
+    return image;
+}
+
+void capturer_frame_ref(struct vbar_drv_image *image)
+{
+    pthread_mutex_lock(&g_pool_mutex);
+    struct capturer_frame *frame = image ? frame_find_locked(image) : NULL;
+    if (frame)
+    {
+        frame->refcount++;
+    }
+    pthread_mutex_unlock(&g_pool_mutex);
+}
+
+void capturer_frame_release(struct vbar_drv_image *image)
+{
+    if (!image)
+    {
+        return;
+    }
+
+    bool destroy = true;
+    pthread_mutex_lock(&g_pool_mutex);
+    struct capturer_frame *frame = frame_find_locked(image);
+    if (frame)
+    {
+        if (--frame->refcount > 0)
+        {
+            destroy = false;
+        }
+        else
+        {
+            g_pool_stats[frame->channel].in_use--;
+            memset(frame, 0, sizeof(*frame));
+        }
+    }
+    pthread_mutex_unlock(&g_pool_mutex);
+
+    if (destroy)
+    {
+        vbar_m_capturer_image_destroy(image);
+    }
+}
+
+void capturer_frame_pool_get_stats(int channel, struct capturer_frame_pool_stats *stats)
+{
+    if (channel < 0 || channel >= CAPTURER_CHANNEL_NUM)
+    {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+    pthread_mutex_lock(&g_pool_mutex);
+    *stats = g_pool_stats[channel];
+    pthread_mutex_unlock(&g_pool_mutex);
+}
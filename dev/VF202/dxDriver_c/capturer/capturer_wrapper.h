@@ -0,0 +1,52 @@
+#ifndef CAPTURER_WRAPPER_H
+#define CAPTURER_WRAPPER_H
+
+#include <stdint.h>
+#include "capturer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 摄像头通道
+enum capturer_channel
+{
+    CAPTURER_CHANNEL_RGB = 0,
+    CAPTURER_CHANNEL_NIR = 1,
+    CAPTURER_CHANNEL_NUM
+};
+
+// 帧池统计
+struct capturer_frame_pool_stats
+{
+    uint32_t in_use;        // 当前被持有的帧数
+    uint32_t peak;          // 同时被持有的最大帧数
+    uint64_t reads;         // 从驱动读取的帧数
+    uint64_t untracked;     // 池满未登记、直接交给调用者的帧数
+};
+
+struct vbar_m_capturer_handle *capturer_rgb_init(void);
+struct vbar_m_capturer_handle *capturer_nir_init(void);
+void capturer_rgb_deinit(void);
+void capturer_nir_deinit(void);
+
+// 帧池：驱动缓冲区（CMA连续内存）中的帧按引用计数在多个使用者之间共享，
+// 最后一个使用者释放时才归还驱动，不做任何拷贝
+
+// 从驱动读取一帧新图像（阻塞），引用计数为1
+struct vbar_drv_image *capturer_frame_read(int channel);
+
+// 对已持有的帧增加引用，交给其他使用者时调用
+void capturer_frame_ref(struct vbar_drv_image *image);
+
+// 释放一次引用，引用归零时归还驱动
+void capturer_frame_release(struct vbar_drv_image *image);
+
+// 获取帧池统计
+void capturer_frame_pool_get_stats(int channel, struct capturer_frame_pool_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CAPTURER_WRAPPER_H
@@ -0,0 +1,3 @@
+/home/dxl/.toolchains/arm-gcc550/arm-gcc550-glibc221-sv80x/bin/arm-linux-gnueabihf-gcc -Wall -Wextra -fPIC -shared -O3 -o /home/dxl/dxInside/dejaos/dev/VF202/dxDriver_c/channel/libchannel_wrapper.so /home/dxl/dxInside/dejaos/dev/VF202/dxDriver_c/channel/channel_wrapper.c -pthread -lvbar-m-channel -I/home/dxl/dxInside/dejaos/dev/VF202/driver/include -L/home/dxl/dxInside/dejaos/dev/VF202/os/driver
+
+cp /home/dxl/dxInside/dejaos/dev/VF202/dxDriver_c/channel/libchannel_wrapper.so /home/dxl/dxInside/dejaos/dev/VF202/os/driver
@@ -0,0 +1,393 @@
+#include "channel_wrapper.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <modules/channel.h>
+#include <soc/gpio.h>
+
+// 未取走的完成事件最多保留的条数
+#define CHANNEL_EVENT_QUEUE_SIZE 64
+// 韦根输出引脚，同 board.h 的 VBAR_BOARD_CHANNEL_WIEGAND0_D0/D1（其中 GPIO_PG(08) 按八进制解析无法编译）
+#define WIEGAND0_D0 GPIO_PG(7)
+#define WIEGAND0_D1 GPIO_PG(8)
+
+struct send_job
+{
+    unsigned int seq;
+    uint8_t *data;
+    size_t len;
+    uint64_t queued_us;
+};
+
+struct channel_ctx
+{
+    struct vbar_m_channel_handle *handle;
+    int type;
+    int wiegand_mode;
+    int running;
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    // 发送与参数设置互斥，参数只在两帧之间下发
+    pthread_mutex_t send_mutex;
+    struct send_job jobs[CHANNEL_QUEUE_SIZE];
+    unsigned int job_head;
+    unsigned int job_count;
+};
+
+static struct channel_ctx g_channels[CHANNEL_MAX];
+// 打开、关闭信道持写锁；其他接口在查找和使用信道期间持读锁，关闭不会销毁正在使用的信道
+static pthread_rwlock_t g_open_lock = PTHREAD_RWLOCK_INITIALIZER;
+
+static struct channel_event_t g_events[CHANNEL_EVENT_QUEUE_SIZE];
+static unsigned int g_event_head = 0;
+static unsigned int g_event_count = 0;
+static unsigned int g_seq = 0;
+static pthread_mutex_t g_event_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static uint64_t monotonic_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static unsigned int next_seq(void)
+{
+    pthread_mutex_lock(&g_event_mutex);
+    // 0保留为失败
+    if (++g_seq == 0)
+    {
+        g_seq = 1;
+    }
+    unsigned int seq = g_seq;
+    pthread_mutex_unlock(&g_event_mutex);
+    return seq;
+}
+
+static void push_event(const struct channel_event_t *event)
+{
+    pthread_mutex_lock(&g_event_mutex);
+    if (g_event_count == CHANNEL_EVENT_QUEUE_SIZE)
+    {
+        // JS长时间未取走时丢弃最旧的事件
+        g_event_head = (g_event_head + 1) % CHANNEL_EVENT_QUEUE_SIZE;
+        g_event_count--;
+    }
+    g_events[(g_event_head + g_event_count) % CHANNEL_EVENT_QUEUE_SIZE] = *event;
+    g_event_count++;
+    pthread_mutex_unlock(&g_event_mutex);
+}
+
+// 调用方须持有 g_open_lock
+static struct channel_ctx *get_channel(int channel)
+{
+    if (channel < 0 || channel >= CHANNEL_MAX || !g_channels[channel].handle)
+    {
+        return NULL;
+    }
+    return &g_channels[channel];
+}
+
+// 发送线程：逐条取出发送，韦根的按位时序只在这里等待
+static void *channel_worker(void *arg)
+{
+    struct channel_ctx *ctx = arg;
+    int channel = ctx - g_channels;
+
+    pthread_mutex_lock(&ctx->mutex);
+    while (1)
+    {
+        while (ctx->running && ctx->job_count == 0)
+        {
+            pthread_cond_wait(&ctx->cond, &ctx->mutex);
+        }
+        if (!ctx->running)
+        {
+            break;
+        }
+        struct send_job job = ctx->jobs[ctx->job_head];
+        ctx->job_head = (ctx->job_head + 1) % CHANNEL_QUEUE_SIZE;
+        ctx->job_count--;
+        pthread_mutex_unlock(&ctx->mutex);
+
+        pthread_mutex_lock(&ctx->send_mutex);
+        uint64_t start = monotonic_us();
+        int ret = vbar_m_channel_send(ctx->handle, job.data, job.len);
+        uint64_t end = monotonic_us();
+        pthread_mutex_unlock(&ctx->send_mutex);
+        struct channel_event_t event = {
+            .seq = job.seq,
+            .channel = channel,
+            .result = ret < 0 ? ret : 0,
+            .wait_us = (uint32_t)(start - job.queued_us),
+            .send_us = (uint32_t)(end - start),
+        };
+        free(job.data);
+        push_event(&event);
+
+        pthread_mutex_lock(&ctx->mutex);
+    }
+    pthread_mutex_unlock(&ctx->mutex);
+    return NULL;
+}
+
+int channel_open(int type, const char *path)
+{
+    pthread_rwlock_wrlock(&g_open_lock);
+    int channel = -1;
+    for (int i = 0; i < CHANNEL_MAX; i++)
+    {
+        if (!g_channels[i].handle)
+        {
+            channel = i;
+            break;
+        }
+    }
+    if (channel < 0)
+    {
+        printf("信道已全部打开\n");
+        pthread_rwlock_unlock(&g_open_lock);
+        return -1;
+    }
+
+    struct channel_ctx *ctx = &g_channels[channel];
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->handle = vbar_m_channel_open(type, (unsigned long)path);
+    if (!ctx->handle)
+    {
+        printf("打开信道失败: 类型%d %s\n", type, path);
+        pthread_rwlock_unlock(&g_open_lock);
+        return -1;
+    }
+    ctx->type = type;
+    pthread_mutex_init(&ctx->mutex, NULL);
+    pthread_mutex_init(&ctx->send_mutex, NULL);
+    pthread_cond_init(&ctx->cond, NULL);
+    ctx->running = 1;
+    if (pthread_create(&ctx->thread, NULL, channel_worker, ctx) != 0)
+    {
+        printf("创建信道发送线程失败\n");
+        vbar_m_channel_close(ctx->handle);
+        pthread_mutex_destroy(&ctx->mutex);
+        pthread_mutex_destroy(&ctx->send_mutex);
+        pthread_cond_destroy(&ctx->cond);
+        memset(ctx, 0, sizeof(*ctx));
+        pthread_rwlock_unlock(&g_open_lock);
+        return -1;
+    }
+    pthread_rwlock_unlock(&g_open_lock);
+    printf("信道%d已打开: 类型%d %s\n", channel, type, path);
+    return channel;
+}
+
+void channel_close(int channel)
+{
+    pthread_rwlock_wrlock(&g_open_lock);
+    struct channel_ctx *ctx = get_channel(channel);
+    if (!ctx)
+    {
+        pthread_rwlock_unlock(&g_open_lock);
+        return;
+    }
+    pthread_mutex_lock(&ctx->mutex);
+    ctx->running = 0;
+    pthread_cond_signal(&ctx->cond);
+    pthread_mutex_unlock(&ctx->mutex);
+    pthread_join(ctx->thread, NULL);
+
+    // 未发出的数据以失败通知调用者
+    while (ctx->job_count > 0)
+    {
+        struct send_job *job = &ctx->jobs[ctx->job_head];
+        struct channel_event_t event = {.seq = job->seq, .channel = channel, .result = -1};
+        free(job->data);
+        push_event(&event);
+        ctx->job_head = (ctx->job_head + 1) % CHANNEL_QUEUE_SIZE;
+        ctx->job_count--;
+    }
+    vbar_m_channel_close(ctx->handle);
+    pthread_mutex_destroy(&ctx->mutex);
+    pthread_mutex_destroy(&ctx->send_mutex);
+    pthread_cond_destroy(&ctx->cond);
+    memset(ctx, 0, sizeof(*ctx));
+    pthread_rwlock_unlock(&g_open_lock);
+}
+
+int channel_set_uart_param(int channel, const char *param)
+{
+    pthread_rwlock_rdlock(&g_open_lock);
+    struct channel_ctx *ctx = get_channel(channel);
+    if (!ctx || ctx->type != VBAR_M_CHANNEL_TYPE_UART)
+    {
+        pthread_rwlock_unlock(&g_open_lock);
+        return -1;
+    }
+    pthread_mutex_lock(&ctx->send_mutex);
+    int ret = vbar_m_channel_ioctl(ctx->handle, VBAR_M_CHANNEL_IOC_SET_UART_PARAM, (unsigned long)param);
+    pthread_mutex_unlock(&ctx->send_mutex);
+    pthread_rwlock_unlock(&g_open_lock);
+    return ret;
+}
+
+int channel_set_wiegand(int channel, int mode, int busy_time, int free_time)
+{
+    pthread_rwlock_rdlock(&g_open_lock);
+    struct channel_ctx *ctx = get_channel(channel);
+    if (!ctx || ctx->type != VBAR_M_CHANNEL_TYPE_WIEGAND)
+    {
+        pthread_rwlock_unlock(&g_open_lock);
+        return -1;
+    }
+    struct vbar_m_channel_wiegand_ioctl_param param = {
+        .mode = mode,
+        .busy_time = busy_time,
+        .free_time = free_time,
+        .wiegand_d0 = WIEGAND0_D0,
+        .wiegand_d1 = WIEGAND0_D1,
+        .log_level = 0,
+    };
+    // 参数在两帧之间下发，避免改到正在输出的帧
+    pthread_mutex_lock(&ctx->send_mutex);
+    int ret = vbar_m_channel_ioctl(ctx->handle, VBAR_M_CHANNEL_IOC_SET_WIEGAND_GPIO, (unsigned long)&param);
+    if (ret == 0)
+    {
+        ret = vbar_m_channel_ioctl(ctx->handle, VBAR_M_CHANNEL_IOC_SET_WIEGAND_MODE, (unsigned long)&param);
+    }
+    if (ret == 0)
+    {
+        ret = vbar_m_channel_ioctl(ctx->handle, VBAR_M_CHANNEL_IOC_SET_WIEGAND_DELAY, (unsigned long)&param);
+    }
+    pthread_mutex_unlock(&ctx->send_mutex);
+
+    if (ret == 0)
+    {
+        pthread_mutex_lock(&ctx->mutex);
+        ctx->wiegand_mode = mode;
+        pthread_mutex_unlock(&ctx->mutex);
+    }
+    pthread_rwlock_unlock(&g_open_lock);
+    return ret;
+}
+
+// 入队，data 的所有权转移给发送线程
+static unsigned int enqueue(struct channel_ctx *ctx, uint8_t *data, size_t len)
+{
+    pthread_mutex_lock(&ctx->mutex);
+    if (!ctx->running || ctx->job_count == CHANNEL_QUEUE_SIZE)
+    {
+        pthread_mutex_unlock(&ctx->mutex);
+        free(data);
+        printf("信道发送队列已满\n");
+        return 0;
+    }
+    struct send_job *job = &ctx->jobs[(ctx->job_head + ctx->job_count) % CHANNEL_QUEUE_SIZE];
+    job->seq = next_seq();
+    job->data = data;
+    job->len = len;
+    job->queued_us = monotonic_us();
+    ctx->job_count++;
+    unsigned int seq = job->seq;
+    pthread_cond_signal(&ctx->cond);
+    pthread_mutex_unlock(&ctx->mutex);
+    return seq;
+}
+
+unsigned int channel_send(int channel, const uint8_t *data, uint32_t len)
+{
+    if (!data || len == 0)
+    {
+        return 0;
+    }
+    uint8_t *copy = malloc(len);
+    if (!copy)
+    {
+        return 0;
+    }
+    memcpy(copy, data, len);
+    pthread_rwlock_rdlock(&g_open_lock);
+    struct channel_ctx *ctx = get_channel(channel);
+    unsigned int seq = 0;
+    if (ctx)
+    {
+        seq = enqueue(ctx, copy, len);
+    }
+    else
+    {
+        free(copy);
+    }
+    pthread_rwlock_unlock(&g_open_lock);
+    return seq;
+}
+
+// 卡号编码为韦根数据字节（高位在前），校验位由驱动按模式补齐；卡号超出当前模式的位数返回-1
+static int wiegand_encode(int mode, uint32_t number, uint8_t *data)
+{
+    int len;
+    switch (mode)
+    {
+    case VBAR_M_CHANNEL_WIEGAND_MODE_26:
+        if (number > 0xFFFFFF)
+        {
+            return -1;
+        }
+        len = 3;
+        break;
+    case VBAR_M_CHANNEL_WIEGAND_MODE_34:
+        len = 4;
+        break;
+    default:
+        return -1;
+    }
+    for (int i = 0; i < len; i++)
+    {
+        data[i] = (number >> ((len - 1 - i) * 8)) & 0xFF;
+    }
+    return len;
+}
+
+unsigned int channel_send_wiegand(int channel, uint32_t number)
+{
+    pthread_rwlock_rdlock(&g_open_lock);
+    struct channel_ctx *ctx = get_channel(channel);
+    if (!ctx || ctx->type != VBAR_M_CHANNEL_TYPE_WIEGAND)
+    {
+        pthread_rwlock_unlock(&g_open_lock);
+        return 0;
+    }
+    pthread_mutex_lock(&ctx->mutex);
+    int mode = ctx->wiegand_mode;
+    pthread_mutex_unlock(&ctx->mutex);
+
+    unsigned int seq = 0;
+    uint8_t *data = malloc(4);
+    int len = data ? wiegand_encode(mode, number, data) : -1;
+    if (len > 0)
+    {
+        seq = enqueue(ctx, data, len);
+    }
+    else
+    {
+        free(data);
+        printf("韦根模式%d下无法发送卡号%u\n", mode, number);
+    }
+    pthread_rwlock_unlock(&g_open_lock);
+    return seq;
+}
+
+int channel_get_event(struct channel_event_t *event)
+{
+    pthread_mutex_lock(&g_event_mutex);
+    if (g_event_count == 0)
+    {
+        pthread_mutex_unlock(&g_event_mutex);
+        return 0;
+    }
+    *event = g_events[g_event_head];
+    g_event_head = (g_event_head + 1) % CHANNEL_EVENT_QUEUE_SIZE;
+    g_event_count--;
+    pthread_mutex_unlock(&g_event_mutex);
+    return 1;
+}
@@ -0,0 +1,70 @@
+#ifndef CHANNEL_WRAPPER_H
+#define CHANNEL_WRAPPER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 输出信道（UART、韦根）：发送只入队，由每个信道各自的发送线程按序发出，
+// 韦根按位输出的时序等待不会阻塞调用者；发送完成后产生事件，由JS轮询取走
+
+#define CHANNEL_MAX 4
+// 每个信道最多排队的发送数
+#define CHANNEL_QUEUE_SIZE 32
+
+// 发送完成事件
+struct channel_event_t
+{
+    unsigned int seq;      // channel_send 返回的发送序号
+    int channel;
+    int result;            // 0成功，负值为驱动错误码
+    uint32_t wait_us;      // 入队到开始发送的等待时间
+    uint32_t send_us;      // 发送耗时
+};
+
+/**
+ * @brief 打开信道并启动发送线程
+ *
+ * @param type 信道类型，见 channel.h 的 vbar_m_channel_type（3-UART，4-韦根）
+ * @param path 设备路径，如 /dev/ttyS2、/dev/vg-wiegand0
+ *
+ * @return 信道号（0 ~ CHANNEL_MAX-1），失败返回-1
+ */
+int channel_open(int type, const char *path);
+void channel_close(int channel);
+
+// 设置串口参数，如 "115200-8-N-1"
+int channel_set_uart_param(int channel, const char *param);
+
+/**
+ * @brief 设置韦根输出模式和时序
+ *
+ * @param mode 见 channel.h 的 vbar_m_channel_wiegand_mode（1-26位，2-34位）
+ * @param busy_time 输出引脚忙延时（脉宽）
+ * @param free_time 输出引脚闲延时（脉冲间隔）
+ */
+int channel_set_wiegand(int channel, int mode, int busy_time, int free_time);
+
+// 发送数据（拷贝后入队），返回发送序号，队列满或信道未打开返回0
+unsigned int channel_send(int channel, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief 按当前韦根模式编码卡号并发送
+ *
+ * @param number 卡号，26位模式不超过24位，34位模式为32位
+ *
+ * @return 发送序号，信道未打开、未设置模式、卡号超出当前模式位数或队列满返回0
+ */
+unsigned int channel_send_wiegand(int channel, uint32_t number);
+
+// 取一条发送完成事件，有事件返回1，没有返回0
+int channel_get_event(struct channel_event_t *event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CHANNEL_WRAPPER_H
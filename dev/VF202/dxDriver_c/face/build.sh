@@ -1,3 +1,3 @@
-/home/dxl/.toolchains/arm-gcc550/arm-gcc550-glibc221-sv80x/bin/arm-linux-gnueabihf-gcc -Wall -Wextra -fPIC -shared -O3 -o /home/dxl/dxInside/dejaos/dev/VF202/dxDriver_c/face/libface_wrapper.so /home/dxl/dxInside/dejaos/dev/VF202/dxDriver_c/face/face_wrapper.c -lvbar-drv-face -lvbar-m-capturer -I/home/dxl/dxInside/dejaos/dev/VF202/driver/include -L/home/dxl/dxInside/dejaos/dev/VF202/os/driver
+/home/dxl/.toolchains/arm-gcc550/arm-gcc550-glibc221-sv80x/bin/arm-linux-gnueabihf-gcc -Wall -Wextra -fPIC -shared -O3 -o /home/dxl/dxInside/dejaos/dev/VF202/dxDriver_c/face/libface_wrapper.so /home/dxl/dxInside/dejaos/dev/VF202/dxDriver_c/face/face_wrapper.c /home/dxl/dxInside/dejaos/dev/VF202/dxDriver_c/face/snapshot.c /home/dxl/dxInside/dejaos/dev/VF202/dxDriver_c/face/latency.c -lvbar-drv-face -lvbar-m-capturer -lcapturer_wrapper -lmetrics_wrapper -I/home/dxl/dxInside/dejaos/dev/VF202/driver/include -L/home/dxl/dxInside/dejaos/dev/VF202/os/driver
 
 cp /home/dxl/dxInside/dejaos/dev/VF202/dxDriver_c/face/libface_wrapper.so /home/dxl/dxInside/dejaos/dev/VF202/os/driver
\ No newline at end of file
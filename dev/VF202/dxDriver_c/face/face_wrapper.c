@@ -1,4 +1,5 @@
 #include "face.h"
+#include "face_wrapper.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/stat.h>
@@ -8,8 +9,11 @@
 #include <pthread.h>
 #include <errno.h>
 #include <time.h>
-#include "../capturer/capturer.h"
+#include "../capturer/capturer_wrapper.h"
 #include "../capturer/include/image_process.h"
+#include "snapshot.h"
+#include "latency.h"
+#include "../metrics/metrics.h"
 
 // 定义全局变量
 static struct vbar_m_capturer_handle *nirCapturer = NULL;
@@ -20,17 +24,14 @@ static char register_userid[256] = {0};
 static int register_result = -99;
 static char saved_picture_path[256] = {0};
 static char saved_picture_thumb_path[256] = {0};
+// 保存路径由识别线程写入、JS线程读取
+static pthread_mutex_t g_saved_path_mutex = PTHREAD_MUTEX_INITIALIZER;
 
-struct track_t
-{
-    int x1;
-    int y1;
-    int x2;
-    int y2;
-    int id;
-};
 static struct track_t g_track = {0};
 static struct track_t g_last_track = {0};
+// 检测回调每更新一次跟踪框加1，供原生叠加层判断是否有新数据
+static unsigned int g_track_seq = 0;
+static pthread_mutex_t g_track_mutex = PTHREAD_MUTEX_INITIALIZER;
 
 static char g_userid[256] = {0};
 
@@ -41,6 +42,7 @@ struct recognition_t
     float score;
     int is_living;
     int living_score;
+    unsigned int trace_id; // 时延跟踪号，JS 在权限判定、结果提示后用它打时间戳
 };
 static struct recognition_t g_recognition = {0};
 static struct recognition_t g_last_recognition = {0};
@@ -50,29 +52,272 @@ struct face_config_t
     int living_check_enable;
 };
 
+// ---------------- 检测调度 ----------------
+// 无人且画面静止时只把少量帧交给人脸引擎检测，画面变化或跟踪到人脸后恢复逐帧检测
+
+// 亮度签名：Y平面划分为网格，每格稀疏采样求均值
+#define SCHED_GRID_X 16
+#define SCHED_GRID_Y 16
+#define SCHED_SAMPLES 4
+
+struct detect_schedule_t
+{
+    int idle_interval;      // 空闲时每隔多少帧检测一次
+    int motion_threshold;   // 网格亮度变化超过该值视为运动
+    int motion_blocks;      // 变化网格数达到该值才算运动，过滤噪声
+    int hold_ms;            // 运动或人脸消失后保持逐帧检测的时间
+};
+static struct detect_schedule_t g_schedule = {
+    .idle_interval = 5,
+    .motion_threshold = 12,
+    .motion_blocks = 2,
+    .hold_ms = 2000,
+};
+
+struct detect_schedule_stats_t
+{
+    unsigned int active;    // 当前是否逐帧检测
+    unsigned int accepted;  // 送检帧数
+    unsigned int skipped;   // 跳过帧数
+    unsigned int motion;    // 检测到运动的次数
+};
+static struct detect_schedule_stats_t g_schedule_stats = {0};
+
+static uint8_t g_signature[SCHED_GRID_X * SCHED_GRID_Y];
+static bool g_signature_valid = false;
+static int g_idle_count = 0;
+static long long g_last_active_ms = 0;
+// 最近一次检测回调的单调时钟时间（微秒），作为识别事件的检测阶段时间戳
+static volatile int64_t g_last_detect_us = 0;
+// 最近一次检测到人脸的时间，由检测回调更新
+static volatile long long g_last_face_ms = 0;
+
+static long long sched_now_ms()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+// 计算当前帧的亮度签名并与上一帧比较，返回是否有运动
+static bool sched_detect_motion(const struct vbar_drv_image *image)
+{
+    const uint8_t *luma = image->layout_type == VBAR_DRV_IMAGE_LAYOUT_CAPTURER_PLANE ? image->mplane.addr[0] : image->data;
+    uint32_t width = image->width;
+    uint32_t height = image->height;
+    if (!luma || width < SCHED_GRID_X * SCHED_SAMPLES || height < SCHED_GRID_Y * SCHED_SAMPLES)
+    {
+        return true;
+    }
+
+    uint32_t cell_w = width / SCHED_GRID_X;
+    uint32_t cell_h = height / SCHED_GRID_Y;
+    int changed = 0;
+    for (int gy = 0; gy < SCHED_GRID_Y; gy++)
+    {
+        for (int gx = 0; gx < SCHED_GRID_X; gx++)
+        {
+            uint32_t sum = 0;
+            for (int sy = 0; sy < SCHED_SAMPLES; sy++)
+            {
+                const uint8_t *row = luma + (gy * cell_h + sy * cell_h / SCHED_SAMPLES + cell_h / (2 * SCHED_SAMPLES)) * width + gx * cell_w;
+                for (int sx = 0; sx < SCHED_SAMPLES; sx++)
+                {
+                    sum += row[sx * cell_w / SCHED_SAMPLES + cell_w / (2 * SCHED_SAMPLES)];
+                }
+            }
+            uint8_t mean = sum / (SCHED_SAMPLES * SCHED_SAMPLES);
+            int index = gy * SCHED_GRID_X + gx;
+            if (abs((int)mean - (int)g_signature[index]) > g_schedule.motion_threshold)
+            {
+                changed++;
+            }
+            g_signature[index] = mean;
+        }
+    }
+
+    bool motion = !g_signature_valid || changed >= g_schedule.motion_blocks;
+    g_signature_valid = true;
+    return motion;
+}
+
+// 判断该帧是否送给人脸引擎检测
+static bool sched_accept(const struct vbar_drv_image *image)
+{
+    long long now = sched_now_ms();
+    bool motion = sched_detect_motion(image);
+    if (motion)
+    {
+        g_schedule_stats.motion++;
+    }
+
+    if (motion || register_flag || now - g_last_face_ms < g_schedule.hold_ms)
+    {
+        g_last_active_ms = now;
+    }
+
+    if (g_schedule.idle_interval <= 1 || now - g_last_active_ms < g_schedule.hold_ms)
+    {
+        g_schedule_stats.active = 1;
+        g_idle_count = 0;
+        return true;
+    }
+
+    g_schedule_stats.active = 0;
+    if (++g_idle_count >= g_schedule.idle_interval)
+    {
+        g_idle_count = 0;
+        return true;
+    }
+    return false;
+}
+
+void face_set_detect_schedule(int idle_interval, int motion_threshold, int hold_ms)
+{
+    g_schedule.idle_interval = idle_interval;
+    g_schedule.motion_threshold = motion_threshold;
+    g_schedule.hold_ms = hold_ms;
+}
+
+void face_get_detect_schedule_stats(struct detect_schedule_stats_t *stats)
+{
+    *stats = g_schedule_stats;
+}
+
+// ---------------- 红外/彩色帧配对 ----------------
+// 活体检测取红外帧时，按时间戳选取与最近一次送检彩色帧最接近的红外帧，
+// 队列中积压的旧红外帧直接丢弃，不再拿旧帧与新彩色帧配对
+
+// 每次最多额外读取的红外帧数：空闲跳帧期间红外帧不被读取，驱动的3个缓冲区会积满旧帧，
+// 先把积压的旧帧读完，再多等两帧越过彩色帧时间戳；正常情况下读到越过即停止
+#define SYNC_MAX_LOOKAHEAD 5
+
+struct sync_stats_t
+{
+    unsigned int pairs;         // 配对次数
+    unsigned int dropped;       // 丢弃的旧红外帧数
+    long long last_skew;        // 最近一次红外减彩色时间戳差
+    long long max_skew;         // 最大时间差（绝对值）
+    long long avg_skew;         // 平均时间差（绝对值）
+};
+static struct sync_stats_t g_sync_stats = {0};
+static long long g_sync_skew_sum = 0;
+// 最近一次送检彩色帧的时间戳
+static volatile uint64_t g_rgb_timestamp = 0;
+
+static long long sync_skew(const struct vbar_drv_image *nir, uint64_t rgb_timestamp)
+{
+    return (long long)(nir->timestamp - rgb_timestamp);
+}
+
+static struct vbar_drv_image *sync_nir_read()
+{
+    struct vbar_drv_image *best = capturer_frame_read(CAPTURER_CHANNEL_NIR);
+    uint64_t target = g_rgb_timestamp;
+    if (!best || target == 0)
+    {
+        return best;
+    }
+
+    // 时间戳单调递增，红外帧早于彩色帧时继续读取（积压的旧帧立即返回），读到不早于彩色帧的一帧后
+    // 在它和前一帧中取时间差小的
+    for (int i = 0; i < SYNC_MAX_LOOKAHEAD && best->timestamp < target; i++)
+    {
+        struct vbar_drv_image *next = capturer_frame_read(CAPTURER_CHANNEL_NIR);
+        if (!next)
+        {
+            break;
+        }
+        g_sync_stats.dropped++;
+        if (llabs(sync_skew(next, target)) <= llabs(sync_skew(best, target)))
+        {
+            capturer_frame_release(best);
+            best = next;
+        }
+        else
+        {
+            capturer_frame_release(next);
+            break;
+        }
+    }
+
+    long long skew = sync_skew(best, target);
+    g_sync_stats.pairs++;
+    g_sync_stats.last_skew = skew;
+    if (llabs(skew) > g_sync_stats.max_skew)
+    {
+        g_sync_stats.max_skew = llabs(skew);
+    }
+    g_sync_skew_sum += llabs(skew);
+    g_sync_stats.avg_skew = g_sync_skew_sum / g_sync_stats.pairs;
+    return best;
+}
+
+// 时间差单位与驱动上报的vbar_drv_image.timestamp一致
+void face_get_sync_stats(struct sync_stats_t *stats)
+{
+    *stats = g_sync_stats;
+}
+
+// 通过帧池取图，归还时按引用计数交回驱动
 static struct vbar_drv_image *nir_capturer_image_read()
 {
     if (nirCapturer)
     {
-        return vbar_m_capturer_read(nirCapturer);
+        return sync_nir_read();
     }
     return NULL;
 }
 
+// 运行指标编号，初始化时注册；帧率、识别次数由采集端按计数增量计算
+static int g_metric_frames = -1;
+static int g_metric_frames_skipped = -1;
+static int g_metric_detections = -1;
+static int g_metric_compares = -1;
+static int g_metric_latency_p50 = -1;
+static int g_metric_latency_p99 = -1;
+
+static void register_metrics(void)
+{
+    g_metric_frames = metrics_register("face_frames_total", METRIC_COUNTER, "送入人脸算法的 RGB 帧数");
+    g_metric_frames_skipped = metrics_register("face_frames_skipped_total", METRIC_COUNTER, "空闲时跳过的 RGB 帧数");
+    g_metric_detections = metrics_register("face_detections_total", METRIC_COUNTER, "检测到人脸的帧数");
+    g_metric_compares = metrics_register("face_compare_total", METRIC_COUNTER, "特征值比对次数");
+    g_metric_latency_p50 = metrics_register("face_recognition_latency_p50_us", METRIC_GAUGE, "帧采集到结果提示的总耗时中位数（微秒）");
+    g_metric_latency_p99 = metrics_register("face_recognition_latency_p99_us", METRIC_GAUGE, "帧采集到结果提示的总耗时99分位（微秒）");
+}
+
 static struct vbar_drv_image *rgb_capturer_image_read()
 {
-    if (rgbCapturer)
+    if (!rgbCapturer)
     {
-        return vbar_m_capturer_read(rgbCapturer);
+        return NULL;
+    }
+    // 空闲时跳过的帧直接归还驱动，读取会阻塞到下一帧
+    while (1)
+    {
+        struct vbar_drv_image *image = capturer_frame_read(CAPTURER_CHANNEL_RGB);
+        if (!image || sched_accept(image))
+        {
+            if (image)
+            {
+                g_schedule_stats.accepted++;
+                metrics_add(g_metric_frames, 1);
+                g_rgb_timestamp = image->timestamp;
+            }
+            return image;
+        }
+        g_schedule_stats.skipped++;
+        metrics_add(g_metric_frames_skipped, 1);
+        capturer_frame_release(image);
     }
-    return NULL;
 }
 
 static void nir_rgb_capturer_image_destroy(struct vbar_drv_image *image)
 {
     if (image)
     {
-        vbar_m_capturer_image_destroy(image);
+        capturer_frame_release(image);
     }
 }
 
@@ -131,6 +376,7 @@ int face_init(void *rgb, void *nir, struct face_config_t *options)
         return 0;
     }
     face_init_flag = 1;
+    register_metrics();
 
     rgbCapturer = (struct vbar_m_capturer_handle *)rgb;
     nirCapturer = (struct vbar_m_capturer_handle *)nir;
@@ -181,16 +427,23 @@ int face_detection(struct vbar_drv_face_analysis_result *analysis_result, void *
     if (analysis_result->face_info_num <= 0)
         return 0;
 
+    g_last_face_ms = sched_now_ms();
+    g_last_detect_us = latency_now_us();
+    metrics_add(g_metric_detections, 1);
+
     // 暂且支持单一人脸识别
     struct vbar_drv_face_info face_info = analysis_result->face_infos[0];
     // if (face_info.rgb_detection.score_quality < 40)
     //     return;
 
+    pthread_mutex_lock(&g_track_mutex);
     g_track.x1 = face_info.rgb_detection.rect_render[0];
     g_track.y1 = face_info.rgb_detection.rect_render[1];
     g_track.x2 = face_info.rgb_detection.rect_render[2];
     g_track.y2 = face_info.rgb_detection.rect_render[3];
     g_track.id = face_info.id;
+    g_track_seq++;
+    pthread_mutex_unlock(&g_track_mutex);
 
     struct vbar_drv_face_process_mode mode = {
         .is_living_check = config.living_check_enable,
@@ -199,7 +452,7 @@ int face_detection(struct vbar_drv_face_analysis_result *analysis_result, void *
 
     return 0;
 }
-void __save_image(char *dir, char *userid, struct vbar_drv_face_recongition_info *recognition);
+void __save_image(char *dir, char *userid, struct vbar_drv_face_recongition_info *recognition, bool cache);
 
 int face_recognition(struct vbar_drv_face_analysis_result *analysis_result, void *pdata)
 {
@@ -209,13 +462,18 @@ int face_recognition(struct vbar_drv_face_analysis_result *analysis_result, void
         return 0;
     struct vbar_drv_face_info face_info = analysis_result->face_infos[0];
     struct vbar_drv_face_cmp_result result;
+    struct vbar_drv_image *rgb_image = face_info.recognition.rgb_image;
+    unsigned int trace_id = latency_trace_begin(rgb_image ? (int64_t)rgb_image->timestamp : (int64_t)g_rgb_timestamp, g_last_detect_us);
     // 人脸识别特征值比对
     vbar_drv_face_feature_compare(face_info.recognition.feature, &result);
+    latency_trace_mark(trace_id, LATENCY_STAGE_COMPARE);
+    metrics_add(g_metric_compares, 1);
 
-    strncpy(g_userid, result.userid, sizeof(g_userid) - 1);
+    snprintf(g_userid, sizeof(g_userid), "%s", result.userid);
     g_recognition.score = result.score;
     g_recognition.is_living = face_info.recognition.is_living_check_success;
     g_recognition.living_score = face_info.recognition.score_living;
+    g_recognition.trace_id = trace_id;
     if (register_flag)
     {
         int ret = vbar_drv_face_features_register(register_userid, face_info.recognition.feature);
@@ -224,7 +482,7 @@ int face_recognition(struct vbar_drv_face_analysis_result *analysis_result, void
         register_flag = 0; // 清除注册标志
         if (ret == 0)
         {
-            __save_image("/data/user/register/picture", register_userid, &face_info.recognition);
+            __save_image("/data/user/register/picture", register_userid, &face_info.recognition, false);
         }
     }else{
         // 使用更高效的等待机制，避免CPU占用过高
@@ -249,14 +507,14 @@ int face_recognition(struct vbar_drv_face_analysis_result *analysis_result, void
             char userid_with_timestamp[512];
             time_t current_time = time(NULL);
             snprintf(userid_with_timestamp, sizeof(userid_with_timestamp), "%s_%ld", g_userid, current_time);
-            __save_image("/data/user/access/picture", userid_with_timestamp, &face_info.recognition);
+            __save_image("/data/user/access/picture", userid_with_timestamp, &face_info.recognition, true);
         }
         g_recognition_success = -1;
     }
     return 0;
 }
 
-void __save_image(char *dir, char *userid, struct vbar_drv_face_recongition_info *recognition)
+void __save_image(char *dir, char *userid, struct vbar_drv_face_recongition_info *recognition, bool cache)
 {
     // 检查参数有效性
     if (!dir || !userid || !recognition) {
@@ -264,45 +522,68 @@ void __save_image(char *dir, char *userid, struct vbar_drv_face_recongition_info
         return;
     }
 
-    // 递归创建指定目录
-    char mkdir_cmd[512];
-    snprintf(mkdir_cmd, sizeof(mkdir_cmd), "mkdir -p %s", dir);
-    system(mkdir_cmd);
-
-    // 生成主图片文件路径
-    char picture_path[512];
-    snprintf(picture_path, sizeof(picture_path), "%s/%s.jpeg", dir, userid);
+    struct snapshot_config_t snapshot_config;
+    snapshot_get_config(&snapshot_config);
+    // 注册照片始终落盘，通行抓拍按配置决定是否落盘
+    bool disk = !cache || snapshot_config.store_to_disk;
 
-    // 如果文件存在则先删除
-    if (access(picture_path, F_OK) == 0) {
-        remove(picture_path);
+    if (disk)
+    {
+        // 递归创建指定目录
+        char mkdir_cmd[512];
+        snprintf(mkdir_cmd, sizeof(mkdir_cmd), "mkdir -p %s", dir);
+        system(mkdir_cmd);
     }
 
-    // 调整图像尺寸并保存主图片
+    // 调整图像尺寸作为大图，人脸区域裁剪作为缩略图
     struct vbar_drv_image *resized_image = vbar_drv_image_resize_resolution(recognition->rgb_image, 480, 854, FILTER_MODE_BOX);
-    vbar_drv_image_process_image_to_picture_file(resized_image, IMAGE_YUV420SP, TYPE_JPEG, picture_path, 100);
-    vbar_drv_capturer_image_destroy(resized_image); // 释放内存
-
-    // 生成缩略图文件路径
-    char thumb_path[512];
-    snprintf(thumb_path, sizeof(thumb_path), "%s/%s_thumb.jpeg", dir, userid);
+    struct vbar_drv_image *thumb_image = vbar_drv_image_process_yuv420sp_cut(recognition->rgb_image, recognition->rect_smooth[0], recognition->rect_smooth[1], recognition->rect_smooth[2] - recognition->rect_smooth[0], recognition->rect_smooth[3] - recognition->rect_smooth[1]);
+    int ret = -1;
+    if (resized_image && thumb_image)
+    {
+        ret = snapshot_take(resized_image, thumb_image, dir, userid, disk, cache);
+    }
+    // 释放内存
+    if (resized_image)
+    {
+        vbar_drv_capturer_image_destroy(resized_image);
+    }
+    if (thumb_image)
+    {
+        vbar_drv_capturer_image_destroy(thumb_image);
+    }
 
-    // 如果缩略图文件存在则先删除
-    if (access(thumb_path, F_OK) == 0) {
-        remove(thumb_path);
+    if (ret != 0 || !disk)
+    {
+        // 本次没有落盘，不能让应用取到上一次抓拍的路径
+        pthread_mutex_lock(&g_saved_path_mutex);
+        saved_picture_path[0] = '\0';
+        saved_picture_thumb_path[0] = '\0';
+        pthread_mutex_unlock(&g_saved_path_mutex);
+        return;
     }
 
-    struct vbar_drv_image *thumb_image = vbar_drv_image_process_yuv420sp_cut(recognition->rgb_image, recognition->rect_smooth[0], recognition->rect_smooth[1], recognition->rect_smooth[2] - recognition->rect_smooth[0], recognition->rect_smooth[3] - recognition->rect_smooth[1]);
-    vbar_drv_image_process_image_to_picture_file(thumb_image, IMAGE_YUV420SP, TYPE_JPEG, thumb_path, 100);
-    vbar_drv_capturer_image_destroy(thumb_image); // 释放内存
+    pthread_mutex_lock(&g_saved_path_mutex);
+    snprintf(saved_picture_path, sizeof(saved_picture_path), "%s/%s.jpeg", dir, userid);
+    snprintf(saved_picture_thumb_path, sizeof(saved_picture_thumb_path), "%s/%s_thumb.jpeg", dir, userid);
+    printf("保存图片成功：%s\n", saved_picture_path);
+    printf("保存缩略图成功：%s\n", saved_picture_thumb_path);
+    pthread_mutex_unlock(&g_saved_path_mutex);
+}
 
-    printf("保存图片成功：%s\n", picture_path);
-    printf("保存缩略图成功：%s\n", thumb_path);
+void face_set_snapshot_config(struct snapshot_config_t *options)
+{
+    snapshot_set_config(options);
+}
 
-    strncpy(saved_picture_path, picture_path, sizeof(saved_picture_path) - 1);
-    saved_picture_path[sizeof(saved_picture_path) - 1] = '\0';
-    strncpy(saved_picture_thumb_path, thumb_path, sizeof(saved_picture_thumb_path) - 1);
-    saved_picture_thumb_path[sizeof(saved_picture_thumb_path) - 1] = '\0';
+void face_get_snapshot_info(struct snapshot_info_t *info)
+{
+    snapshot_get_info(info);
+}
+
+int face_copy_snapshot(unsigned int seq, uint8_t *picture, uint32_t picture_size, uint8_t *thumb, uint32_t thumb_size)
+{
+    return snapshot_copy(seq, picture, picture_size, thumb, thumb_size);
 }
 
 int face_set_pause(bool pause)
@@ -338,12 +619,25 @@ int get_face_register_result(void)
 
 struct track_t get_face_track_data(void)
 {
-    if (g_track.x1 == g_last_track.x1 && g_track.y1 == g_last_track.y1)
+    pthread_mutex_lock(&g_track_mutex);
+    struct track_t track = g_track;
+    pthread_mutex_unlock(&g_track_mutex);
+
+    if (track.x1 == g_last_track.x1 && track.y1 == g_last_track.y1)
     {
         return (struct track_t){0};
     }
-    g_last_track = g_track;
-    return g_track;
+    g_last_track = track;
+    return track;
+}
+
+unsigned int face_get_track_snapshot(struct track_t *track)
+{
+    pthread_mutex_lock(&g_track_mutex);
+    *track = g_track;
+    unsigned int seq = g_track_seq;
+    pthread_mutex_unlock(&g_track_mutex);
+    return seq;
 }
 
 struct recognition_t get_face_recognition_result(char *userid)
@@ -352,11 +646,35 @@ struct recognition_t get_face_recognition_result(char *userid)
     {
         return (struct recognition_t){0};
     }
-    strncpy(userid, g_userid, sizeof(g_userid) - 1);
+    snprintf(userid, sizeof(g_userid), "%s", g_userid);
     g_last_recognition = g_recognition;
+    latency_trace_mark(g_recognition.trace_id, LATENCY_STAGE_POLL);
     return g_recognition;
 }
 
+// JS 侧阶段（权限判定、结果提示）打时间戳
+void face_latency_mark(unsigned int trace_id, int stage)
+{
+    latency_trace_mark(trace_id, stage);
+    if (stage == LATENCY_STAGE_RESULT)
+    {
+        struct latency_stats_t stats;
+        latency_get_stats(LATENCY_HIST_TOTAL, &stats);
+        metrics_set(g_metric_latency_p50, stats.p50_us);
+        metrics_set(g_metric_latency_p99, stats.p99_us);
+    }
+}
+
+int face_get_latency_stats(int index, struct latency_stats_t *stats)
+{
+    return latency_get_stats(index, stats);
+}
+
+void face_latency_reset(void)
+{
+    latency_reset();
+}
+
 void set_face_recognition_result(int is_success)
 {
     g_recognition_success = is_success;
@@ -364,10 +682,12 @@ void set_face_recognition_result(int is_success)
 
 void get_saved_picture_path(char *path, char *thumb_path)
 {
-    strncpy(path, saved_picture_path, sizeof(saved_picture_path) - 1);
+    pthread_mutex_lock(&g_saved_path_mutex);
+    snprintf(path, sizeof(saved_picture_path), "%s", saved_picture_path);
     saved_picture_path[0] = '\0';
-    strncpy(thumb_path, saved_picture_thumb_path, sizeof(saved_picture_thumb_path) - 1);
+    snprintf(thumb_path, sizeof(saved_picture_thumb_path), "%s", saved_picture_thumb_path);
     saved_picture_thumb_path[0] = '\0';
+    pthread_mutex_unlock(&g_saved_path_mutex);
 }
 
 void face_update_config(struct face_config_t *options)
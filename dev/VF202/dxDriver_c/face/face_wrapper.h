@@ -0,0 +1,25 @@
+#ifndef FACE_WRAPPER_H
+#define FACE_WRAPPER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 人脸跟踪框（屏幕坐标），LVGL叠加层通过 face_get_track_snapshot 直接读取
+struct track_t
+{
+    int x1;
+    int y1;
+    int x2;
+    int y2;
+    int id;
+};
+
+// 读取最新跟踪框（不影响get_face_track_data的去重状态），返回更新序号，检测回调每更新一次加1
+unsigned int face_get_track_snapshot(struct track_t *track);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FACE_WRAPPER_H
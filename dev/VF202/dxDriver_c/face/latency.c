@@ -0,0 +1,227 @@
+#include "latency.h"
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+// 同时在途的识别事件数，超出后最旧的跟踪被覆盖
+#define LATENCY_TRACE_MAX 16
+// 帧时间戳早于当前超过该值时视为与单调时钟不一致
+#define LATENCY_FRAME_MAX_AGE_US (10 * 1000000LL)
+
+#define SUB_COUNT (1 << LATENCY_SUB_BITS)
+#define EXACT_LIMIT (1u << (LATENCY_SUB_BITS + 1))
+
+struct trace
+{
+    uint32_t id;
+    int64_t stamps[LATENCY_STAGE_COUNT];
+};
+
+static pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct trace g_traces[LATENCY_TRACE_MAX];
+static uint32_t g_trace_id = 0;
+static struct latency_hist_t g_hists[LATENCY_HIST_COUNT];
+
+int64_t latency_now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// ---------------- 直方图 ----------------
+
+static int bucket_index(uint32_t value)
+{
+    if (value < EXACT_LIMIT)
+    {
+        return value;
+    }
+    int msb = 31 - __builtin_clz(value);
+    int shift = msb - LATENCY_SUB_BITS;
+    return EXACT_LIMIT + (msb - LATENCY_SUB_BITS - 1) * SUB_COUNT + ((value >> shift) & (SUB_COUNT - 1));
+}
+
+static uint32_t bucket_value(int index)
+{
+    if (index < (int)EXACT_LIMIT)
+    {
+        return index;
+    }
+    int octave = (index - EXACT_LIMIT) / SUB_COUNT;
+    int sub = (index - EXACT_LIMIT) % SUB_COUNT;
+    int shift = octave + 1;
+    uint64_t low = (uint64_t)(SUB_COUNT + sub) << shift;
+    uint64_t mid = low + ((1ull << shift) >> 1);
+    return mid > UINT32_MAX ? UINT32_MAX : (uint32_t)mid;
+}
+
+void latency_hist_record(struct latency_hist_t *hist, uint32_t value_us)
+{
+    if (hist->count == 0 || value_us < hist->min_us)
+    {
+        hist->min_us = value_us;
+    }
+    if (value_us > hist->max_us)
+    {
+        hist->max_us = value_us;
+    }
+    hist->count++;
+    hist->sum_us += value_us;
+    hist->buckets[bucket_index(value_us)]++;
+}
+
+uint32_t latency_hist_percentile(const struct latency_hist_t *hist, double percentile)
+{
+    if (hist->count == 0)
+    {
+        return 0;
+    }
+    uint64_t target = (uint64_t)(hist->count * percentile / 100.0 + 0.5);
+    if (target < 1)
+    {
+        target = 1;
+    }
+    uint64_t seen = 0;
+    for (int i = 0; i < LATENCY_BUCKETS; i++)
+    {
+        seen += hist->buckets[i];
+        if (seen >= target)
+        {
+            // 桶中值可能超出实际范围，用最小、最大值收紧
+            uint32_t value = bucket_value(i);
+            return value < hist->min_us ? hist->min_us : value > hist->max_us ? hist->max_us : value;
+        }
+    }
+    return hist->max_us;
+}
+
+void latency_hist_stats(const struct latency_hist_t *hist, struct latency_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    if (hist->count == 0)
+    {
+        return;
+    }
+    stats->count = hist->count;
+    stats->min_us = hist->min_us;
+    stats->max_us = hist->max_us;
+    stats->mean_us = (uint32_t)(hist->sum_us / hist->count);
+    stats->p50_us = latency_hist_percentile(hist, 50);
+    stats->p90_us = latency_hist_percentile(hist, 90);
+    stats->p99_us = latency_hist_percentile(hist, 99);
+    stats->p999_us = latency_hist_percentile(hist, 99.9);
+}
+
+// ---------------- 跟踪 ----------------
+
+static struct trace *find_trace_locked(uint32_t id)
+{
+    struct trace *trace = &g_traces[id % LATENCY_TRACE_MAX];
+    return id && trace->id == id ? trace : NULL;
+}
+
+static void record_delta_locked(int index, int64_t from, int64_t to)
+{
+    if (from > 0 && to >= from)
+    {
+        int64_t delta = to - from;
+        latency_hist_record(&g_hists[index], delta > UINT32_MAX ? UINT32_MAX : (uint32_t)delta);
+    }
+}
+
+// 缺失的阶段跳过，相邻耗时从上一个已知阶段算起
+static void finish_trace_locked(struct trace *trace)
+{
+    int64_t first = 0;
+    int64_t last = 0;
+    for (int stage = 0; stage < LATENCY_STAGE_COUNT; stage++)
+    {
+        int64_t stamp = trace->stamps[stage];
+        if (!stamp)
+        {
+            continue;
+        }
+        if (last)
+        {
+            record_delta_locked(stage, last, stamp);
+        }
+        if (!first)
+        {
+            first = stamp;
+        }
+        last = stamp;
+    }
+    if (trace->stamps[LATENCY_STAGE_FRAME])
+    {
+        record_delta_locked(LATENCY_HIST_TOTAL, first, last);
+    }
+    trace->id = 0;
+}
+
+uint32_t latency_trace_begin(int64_t frame_us, int64_t detect_us)
+{
+    int64_t now = latency_now_us();
+    if (frame_us <= 0 || frame_us > now || now - frame_us > LATENCY_FRAME_MAX_AGE_US)
+    {
+        frame_us = 0;
+    }
+    if (detect_us <= 0 || detect_us > now || (frame_us && detect_us < frame_us))
+    {
+        detect_us = 0;
+    }
+
+    pthread_mutex_lock(&g_mutex);
+    if (++g_trace_id == 0)
+    {
+        g_trace_id = 1;
+    }
+    uint32_t id = g_trace_id;
+    struct trace *trace = &g_traces[id % LATENCY_TRACE_MAX];
+    memset(trace, 0, sizeof(*trace));
+    trace->id = id;
+    trace->stamps[LATENCY_STAGE_FRAME] = frame_us;
+    trace->stamps[LATENCY_STAGE_DETECT] = detect_us;
+    trace->stamps[LATENCY_STAGE_RECOGNIZE] = now;
+    pthread_mutex_unlock(&g_mutex);
+    return id;
+}
+
+void latency_trace_mark(uint32_t id, int stage)
+{
+    if (stage <= LATENCY_STAGE_RECOGNIZE || stage >= LATENCY_STAGE_COUNT)
+    {
+        return;
+    }
+    int64_t now = latency_now_us();
+    pthread_mutex_lock(&g_mutex);
+    struct trace *trace = find_trace_locked(id);
+    if (trace)
+    {
+        trace->stamps[stage] = now;
+        if (stage == LATENCY_STAGE_RESULT)
+        {
+            finish_trace_locked(trace);
+        }
+    }
+    pthread_mutex_unlock(&g_mutex);
+}
+
+int latency_get_stats(int index, struct latency_stats_t *stats)
+{
+    if (index < 0 || index >= LATENCY_HIST_COUNT || !stats)
+    {
+        return -1;
+    }
+    pthread_mutex_lock(&g_mutex);
+    latency_hist_stats(&g_hists[index], stats);
+    pthread_mutex_unlock(&g_mutex);
+    return 0;
+}
+
+void latency_reset(void)
+{
+    pthread_mutex_lock(&g_mutex);
+    memset(g_hists, 0, sizeof(g_hists));
+    pthread_mutex_unlock(&g_mutex);
+}
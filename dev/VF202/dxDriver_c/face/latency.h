@@ -0,0 +1,78 @@
+#ifndef FACE_LATENCY_H
+#define FACE_LATENCY_H
+
+#include <stdint.h>
+
+// 识别链路时延：每次识别事件带一个跟踪号，各阶段在经过时打单调时钟时间戳，
+// 结果提示阶段完成后把相邻阶段的耗时及总耗时计入直方图
+
+enum latency_stage
+{
+    LATENCY_STAGE_FRAME = 0, // 帧采集（驱动帧时间戳）
+    LATENCY_STAGE_DETECT,    // 人脸检测回调
+    LATENCY_STAGE_RECOGNIZE, // 识别回调（特征值已提取）
+    LATENCY_STAGE_COMPARE,   // 特征比对完成
+    LATENCY_STAGE_POLL,      // JS 取到识别结果
+    LATENCY_STAGE_ACCESS,    // JS 权限判定完成
+    LATENCY_STAGE_RESULT,    // 开门、界面提示
+    LATENCY_STAGE_COUNT,
+};
+
+// 直方图编号：0为帧采集到结果提示的总耗时，i（1 ~ LATENCY_STAGE_COUNT-1）为阶段 i-1 到阶段 i 的耗时
+#define LATENCY_HIST_TOTAL 0
+#define LATENCY_HIST_COUNT LATENCY_STAGE_COUNT
+
+// 直方图按2的幂分段，每段32个子桶，相对误差约3%，最大记录约71分钟
+#define LATENCY_SUB_BITS 5
+#define LATENCY_BUCKETS (((32 - LATENCY_SUB_BITS - 1) << LATENCY_SUB_BITS) + (1 << (LATENCY_SUB_BITS + 1)))
+
+struct latency_hist_t
+{
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t sum_us;
+    uint32_t buckets[LATENCY_BUCKETS];
+};
+
+// 单位均为微秒
+struct latency_stats_t
+{
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint32_t mean_us;
+    uint32_t p50_us;
+    uint32_t p90_us;
+    uint32_t p99_us;
+    uint32_t p999_us;
+};
+
+int64_t latency_now_us(void);
+
+void latency_hist_record(struct latency_hist_t *hist, uint32_t value_us);
+
+// 百分位数（0-100），取所在桶的中值
+uint32_t latency_hist_percentile(const struct latency_hist_t *hist, double percentile);
+
+void latency_hist_stats(const struct latency_hist_t *hist, struct latency_stats_t *stats);
+
+/**
+ * @brief 开始一次识别事件的跟踪，同时打上识别阶段时间戳
+ *
+ * @param frame_us 帧时间戳，与单调时钟不一致（为0、晚于当前或早于10秒以前）时视为未知
+ * @param detect_us 检测回调时间，早于帧时间时视为未知
+ *
+ * @return 跟踪号，不为0
+ */
+uint32_t latency_trace_begin(int64_t frame_us, int64_t detect_us);
+
+// 打阶段时间戳，阶段为 LATENCY_STAGE_RESULT 时结束跟踪并计入直方图；跟踪号已过期时忽略
+void latency_trace_mark(uint32_t id, int stage);
+
+// 取统计，index 见 LATENCY_HIST_*，返回-1表示编号无效
+int latency_get_stats(int index, struct latency_stats_t *stats);
+
+void latency_reset(void);
+
+#endif // FACE_LATENCY_H
@@ -0,0 +1,328 @@
+#include "snapshot.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include "../capturer/include/image_process.h"
+
+// 压缩质量搜索范围
+#define SNAPSHOT_QUALITY_MIN 30
+#define SNAPSHOT_QUALITY_MAX 90
+// 每张图最多编码次数
+#define SNAPSHOT_MAX_TRIES 5
+
+static struct snapshot_config_t g_config = {
+    .picture_target = 60 * 1024,
+    .thumb_target = 12 * 1024,
+    .cache_max_bytes = 64 * 1024 * 1024,
+    .store_to_disk = 1,
+};
+
+// 上一次满足目标的质量，作为下一次搜索的起点
+static int g_last_quality[2] = {80, 80};
+
+// 最近一次抓拍
+static uint8_t *g_data[2] = {NULL, NULL};
+static struct snapshot_info_t g_info = {0};
+static pthread_mutex_t g_snapshot_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+void snapshot_set_config(const struct snapshot_config_t *config)
+{
+    pthread_mutex_lock(&g_snapshot_mutex);
+    g_config = *config;
+    pthread_mutex_unlock(&g_snapshot_mutex);
+}
+
+void snapshot_get_config(struct snapshot_config_t *config)
+{
+    pthread_mutex_lock(&g_snapshot_mutex);
+    *config = g_config;
+    pthread_mutex_unlock(&g_snapshot_mutex);
+}
+
+static int snapshot_encode_once(struct vbar_drv_image *image, int quality, uint8_t **data, uint32_t *len)
+{
+    *data = NULL;
+    *len = 0;
+    if (vbar_drv_image_process_image_to_picture_data(image, IMAGE_YUV420SP, TYPE_JPEG, quality, data, len) != 0 || !*data)
+    {
+        return -1;
+    }
+    return 0;
+}
+
+// 二分查找不超过目标字节数的最高质量，从上一次的质量开始尝试
+static int snapshot_encode(struct vbar_drv_image *image, uint32_t target, int part, uint8_t **out, uint32_t *out_len, int *out_quality)
+{
+    uint8_t *best = NULL;
+    uint32_t best_len = 0;
+    int best_quality = -1;
+    int lo = SNAPSHOT_QUALITY_MIN;
+    int hi = SNAPSHOT_QUALITY_MAX;
+    int quality = target ? g_last_quality[part] : SNAPSHOT_QUALITY_MAX;
+
+    for (int tries = 0; tries < SNAPSHOT_MAX_TRIES && lo <= hi; tries++)
+    {
+        uint8_t *data;
+        uint32_t len;
+        if (snapshot_encode_once(image, quality, &data, &len) != 0)
+        {
+            break;
+        }
+        if (!target || len <= target)
+        {
+            free(best);
+            best = data;
+            best_len = len;
+            best_quality = quality;
+            // 已接近目标（不低于85%）时不再提高质量，场景稳定时通常一次编码即可
+            if (!target || (uint64_t)len * 100 >= (uint64_t)target * 85)
+            {
+                break;
+            }
+            lo = quality + 1;
+        }
+        else
+        {
+            free(data);
+            hi = quality - 1;
+        }
+        quality = (lo + hi) / 2;
+    }
+
+    // 最低质量仍超出目标时按最低质量输出
+    if (!best && snapshot_encode_once(image, SNAPSHOT_QUALITY_MIN, &best, &best_len) == 0)
+    {
+        best_quality = SNAPSHOT_QUALITY_MIN;
+    }
+    if (!best)
+    {
+        return -1;
+    }
+
+    if (target)
+    {
+        g_last_quality[part] = best_quality;
+    }
+    *out = best;
+    *out_len = best_len;
+    *out_quality = best_quality;
+    return 0;
+}
+
+// ---------------- 落盘缓存 ----------------
+
+struct cache_entry_t
+{
+    char *path;
+    uint32_t size;
+    time_t mtime;
+};
+
+static struct cache_entry_t *g_entries = NULL;
+static int g_entry_count = 0;
+static int g_entry_capacity = 0;
+static uint64_t g_cache_bytes = 0;
+static char g_cache_dir[256] = {0};
+
+static void cache_push(const char *path, uint32_t size, time_t mtime)
+{
+    // 文件名精确到秒，同一秒内重复抓拍会覆盖同名文件，先扣除旧文件；按时间排序，只需查看末尾同时刻的项
+    for (int i = g_entry_count - 1; i >= 0 && g_entries[i].mtime >= mtime - 1; i--)
+    {
+        if (strcmp(g_entries[i].path, path) == 0)
+        {
+            g_cache_bytes -= g_entries[i].size;
+            g_entries[i].size = size;
+            g_entries[i].mtime = mtime;
+            g_cache_bytes += size;
+            return;
+        }
+    }
+    if (g_entry_count == g_entry_capacity)
+    {
+        int capacity = g_entry_capacity ? g_entry_capacity * 2 : 256;
+        struct cache_entry_t *entries = realloc(g_entries, capacity * sizeof(*entries));
+        if (!entries)
+        {
+            return;
+        }
+        g_entries = entries;
+        g_entry_capacity = capacity;
+    }
+    g_entries[g_entry_count].path = strdup(path);
+    g_entries[g_entry_count].size = size;
+    g_entries[g_entry_count].mtime = mtime;
+    g_entry_count++;
+    g_cache_bytes += size;
+}
+
+static int cache_compare(const void *a, const void *b)
+{
+    const struct cache_entry_t *ea = a;
+    const struct cache_entry_t *eb = b;
+    return (ea->mtime > eb->mtime) - (ea->mtime < eb->mtime);
+}
+
+// 首次使用时扫描目录建立索引，之后只在内存中维护
+static void cache_load(const char *dir)
+{
+    if (strcmp(g_cache_dir, dir) == 0)
+    {
+        return;
+    }
+    for (int i = 0; i < g_entry_count; i++)
+    {
+        free(g_entries[i].path);
+    }
+    g_entry_count = 0;
+    g_cache_bytes = 0;
+    strncpy(g_cache_dir, dir, sizeof(g_cache_dir) - 1);
+
+    DIR *d = opendir(dir);
+    if (!d)
+    {
+        return;
+    }
+    struct dirent *ent;
+    char path[512];
+    while ((ent = readdir(d)) != NULL)
+    {
+        struct stat st;
+        snprintf(path, sizeof(path), "%s/%s", dir, ent->d_name);
+        if (stat(path, &st) == 0 && S_ISREG(st.st_mode))
+        {
+            cache_push(path, st.st_size, st.st_mtime);
+        }
+    }
+    closedir(d);
+    qsort(g_entries, g_entry_count, sizeof(*g_entries), cache_compare);
+    printf("抓拍缓存: %s %d个文件 %llu字节\n", dir, g_entry_count, (unsigned long long)g_cache_bytes);
+}
+
+// 超出上限时从最旧的文件开始删除
+static void cache_evict(uint32_t max_bytes)
+{
+    int removed = 0;
+    while (max_bytes && g_cache_bytes > max_bytes && removed < g_entry_count)
+    {
+        struct cache_entry_t *entry = &g_entries[removed];
+        remove(entry->path);
+        g_cache_bytes -= entry->size;
+        free(entry->path);
+        removed++;
+    }
+    if (removed > 0)
+    {
+        memmove(g_entries, g_entries + removed, (g_entry_count - removed) * sizeof(*g_entries));
+        g_entry_count -= removed;
+        printf("抓拍缓存超出上限，删除%d个最旧文件\n", removed);
+    }
+}
+
+static int snapshot_write_file(const char *path, const uint8_t *data, uint32_t len)
+{
+    FILE *fp = fopen(path, "wb");
+    if (!fp)
+    {
+        printf("打开文件失败: %s\n", path);
+        return -1;
+    }
+    size_t written = fwrite(data, 1, len, fp);
+    fclose(fp);
+    if (written != len)
+    {
+        printf("写入文件失败: %s\n", path);
+        remove(path);
+        return -1;
+    }
+    return 0;
+}
+
+int snapshot_take(struct vbar_drv_image *picture, struct vbar_drv_image *thumb,
+                  const char *dir, const char *name, bool disk, bool cache)
+{
+    struct snapshot_config_t config;
+    snapshot_get_config(&config);
+
+    uint8_t *data[2] = {NULL, NULL};
+    uint32_t len[2] = {0, 0};
+    int quality[2] = {0, 0};
+    if (snapshot_encode(picture, config.picture_target, SNAPSHOT_PICTURE, &data[0], &len[0], &quality[0]) != 0 ||
+        snapshot_encode(thumb, config.thumb_target, SNAPSHOT_THUMB, &data[1], &len[1], &quality[1]) != 0)
+    {
+        printf("抓拍编码失败\n");
+        free(data[0]);
+        free(data[1]);
+        return -1;
+    }
+
+    int ret = 0;
+    if (disk)
+    {
+        char path[2][512];
+        snprintf(path[0], sizeof(path[0]), "%s/%s.jpeg", dir, name);
+        snprintf(path[1], sizeof(path[1]), "%s/%s_thumb.jpeg", dir, name);
+        if (cache)
+        {
+            cache_load(dir);
+        }
+        for (int i = 0; i < 2; i++)
+        {
+            if (snapshot_write_file(path[i], data[i], len[i]) != 0)
+            {
+                ret = -1;
+            }
+            else if (cache)
+            {
+                cache_push(path[i], len[i], time(NULL));
+            }
+        }
+        if (cache)
+        {
+            cache_evict(config.cache_max_bytes);
+        }
+    }
+
+    // 替换内存中的最近一次抓拍
+    pthread_mutex_lock(&g_snapshot_mutex);
+    for (int i = 0; i < 2; i++)
+    {
+        free(g_data[i]);
+        g_data[i] = data[i];
+    }
+    g_info.seq++;
+    g_info.picture_len = len[0];
+    g_info.thumb_len = len[1];
+    g_info.picture_quality = quality[0];
+    g_info.thumb_quality = quality[1];
+    pthread_mutex_unlock(&g_snapshot_mutex);
+
+    printf("抓拍完成: 大图%u字节(质量%d) 缩略图%u字节(质量%d)\n", len[0], quality[0], len[1], quality[1]);
+    return ret;
+}
+
+void snapshot_get_info(struct snapshot_info_t *info)
+{
+    pthread_mutex_lock(&g_snapshot_mutex);
+    *info = g_info;
+    pthread_mutex_unlock(&g_snapshot_mutex);
+}
+
+int snapshot_copy(unsigned int seq, uint8_t *picture, uint32_t picture_size, uint8_t *thumb, uint32_t thumb_size)
+{
+    int ret = -1;
+    pthread_mutex_lock(&g_snapshot_mutex);
+    if (g_info.seq == seq && g_data[SNAPSHOT_PICTURE] && g_data[SNAPSHOT_THUMB] &&
+        g_info.picture_len <= picture_size && g_info.thumb_len <= thumb_size)
+    {
+        memcpy(picture, g_data[SNAPSHOT_PICTURE], g_info.picture_len);
+        memcpy(thumb, g_data[SNAPSHOT_THUMB], g_info.thumb_len);
+        ret = 0;
+    }
+    pthread_mutex_unlock(&g_snapshot_mutex);
+    return ret;
+}
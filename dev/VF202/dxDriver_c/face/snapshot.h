@@ -0,0 +1,60 @@
+#ifndef FACE_SNAPSHOT_H
+#define FACE_SNAPSHOT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../capturer/include/capturer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 抓拍服务：JPEG在内存中按目标字节数编码（二分查找压缩质量），
+// 最近一次抓拍保留在内存供应用直接上传，落盘目录按总字节数上限淘汰最旧的文件
+
+struct snapshot_config_t
+{
+    uint32_t picture_target;    // 抓拍大图目标字节数，0表示不限制（质量取上限）
+    uint32_t thumb_target;      // 人脸缩略图目标字节数
+    uint32_t cache_max_bytes;   // 通行抓拍目录总字节数上限，0表示不限制
+    int store_to_disk;          // 通行抓拍是否落盘
+};
+
+struct snapshot_info_t
+{
+    unsigned int seq;           // 抓拍序号，每次抓拍加1
+    uint32_t picture_len;
+    uint32_t thumb_len;
+    int picture_quality;
+    int thumb_quality;
+};
+
+enum snapshot_part
+{
+    SNAPSHOT_PICTURE = 0,
+    SNAPSHOT_THUMB = 1,
+};
+
+// 设置抓拍参数
+void snapshot_set_config(const struct snapshot_config_t *config);
+
+// 获取当前抓拍参数
+void snapshot_get_config(struct snapshot_config_t *config);
+
+// 抓拍：大图与人脸缩略图编码到内存，cache为true时受缓存上限管理，
+// disk为true时写入 dir/name.jpeg 与 dir/name_thumb.jpeg，成功返回0
+int snapshot_take(struct vbar_drv_image *picture, struct vbar_drv_image *thumb,
+                  const char *dir, const char *name, bool disk, bool cache);
+
+// 获取最近一次抓拍信息
+void snapshot_get_info(struct snapshot_info_t *info);
+
+// 在同一次加锁中拷贝最近一次抓拍的大图和缩略图，保证两者属于同一次抓拍；
+// 最近一次抓拍已不是 seq 或缓冲区不足时返回-1
+int snapshot_copy(unsigned int seq, uint8_t *picture, uint32_t picture_size, uint8_t *thumb, uint32_t thumb_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FACE_SNAPSHOT_H
@@ -1,5 +1,22 @@
-#include "./include/gpio.h"
+#include "gpio_wrapper.h"
+#include <stdio.h>
 #include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <dlfcn.h>
+#include <modules/gpio_key.h>
+
+#define GPIO_KEY_CALLBACK_NAME "gpio_wrapper"
+// gpio_key 模块不是所有固件都带，运行时加载；没有时只是不能上报输入事件，继电器等输出照常使用
+#define GPIO_KEY_LIB_PATH "/os/driver/libvbar-m-gpio-key.so"
+// 未取走的事件最多保留的条数
+#define GPIO_EVENT_QUEUE_SIZE 128
+// 记录上次电平的按键数，用于过滤重复上报
+#define GPIO_KEY_MAX 16
+#define GPIO_HELD_WATCH_MAX 8
+#define GPIO_PULSE_MAX 4
+// 按键自动重复上报的值
+#define GPIO_KEY_VALUE_REPEAT 2
 
 int init_gpio()
 {
@@ -55,3 +72,412 @@ uint16_t get_drive_strength_gpio(uint32_t gpio)
 {
     return vbar_drv_gpio_get_drive_strength(gpio);
 }
+
+static uint64_t monotonic_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// ---------------- 事件队列 ----------------
+
+static struct gpio_event_t g_events[GPIO_EVENT_QUEUE_SIZE];
+static unsigned int g_event_head = 0;
+static unsigned int g_event_count = 0;
+static uint32_t g_event_seq = 0;
+static uint32_t g_event_dropped = 0;
+static pthread_mutex_t g_event_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void push_event(int type, int code, int value, uint64_t timestamp_us)
+{
+    pthread_mutex_lock(&g_event_mutex);
+    if (g_event_count == GPIO_EVENT_QUEUE_SIZE)
+    {
+        g_event_head = (g_event_head + 1) % GPIO_EVENT_QUEUE_SIZE;
+        g_event_count--;
+        g_event_dropped++;
+    }
+    struct gpio_event_t *event = &g_events[(g_event_head + g_event_count) % GPIO_EVENT_QUEUE_SIZE];
+    event->seq = ++g_event_seq;
+    event->type = type;
+    event->code = code;
+    event->value = value;
+    event->timestamp_us = timestamp_us;
+    g_event_count++;
+    pthread_mutex_unlock(&g_event_mutex);
+}
+
+int gpio_event_read(struct gpio_event_t *events, int max)
+{
+    pthread_mutex_lock(&g_event_mutex);
+    int count = 0;
+    while (count < max && g_event_count > 0)
+    {
+        events[count++] = g_events[g_event_head];
+        g_event_head = (g_event_head + 1) % GPIO_EVENT_QUEUE_SIZE;
+        g_event_count--;
+    }
+    pthread_mutex_unlock(&g_event_mutex);
+    return count;
+}
+
+uint32_t gpio_event_dropped(void)
+{
+    pthread_mutex_lock(&g_event_mutex);
+    uint32_t dropped = g_event_dropped;
+    pthread_mutex_unlock(&g_event_mutex);
+    return dropped;
+}
+
+// ---------------- 定时线程：脉冲自动拉低、保持超时报警 ----------------
+
+struct held_watch
+{
+    int code;
+    int active_value;
+    int timeout_ms;
+    uint64_t deadline_ms; // 0表示未计时
+};
+
+struct pulse
+{
+    uint32_t gpio;
+    int used;
+    uint64_t deadline_ms; // 0表示未在输出
+};
+
+static struct held_watch g_watches[GPIO_HELD_WATCH_MAX];
+static int g_watch_count = 0;
+static struct pulse g_pulses[GPIO_PULSE_MAX];
+// 每个按键最近一次的电平，-1表示未知
+static int g_key_codes[GPIO_KEY_MAX];
+static int g_key_values[GPIO_KEY_MAX];
+static int g_key_count = 0;
+
+static pthread_mutex_t g_timer_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_timer_cond;
+static pthread_t g_timer_thread;
+static int g_timer_running = 0;
+static int g_pulse_gpio_ready = 0;
+
+// 等待最近的到期时刻，没有计时项时一直等待，不占用CPU
+static void *gpio_timer(void *arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&g_timer_mutex);
+    while (g_timer_running)
+    {
+        uint64_t now = monotonic_us() / 1000;
+        uint64_t next = 0;
+        for (int i = 0; i < GPIO_PULSE_MAX; i++)
+        {
+            struct pulse *pulse = &g_pulses[i];
+            if (!pulse->deadline_ms)
+            {
+                continue;
+            }
+            if (now >= pulse->deadline_ms)
+            {
+                vbar_drv_gpio_set_func(pulse->gpio, GPIO_OUTPUT0);
+                pulse->deadline_ms = 0;
+            }
+            else if (!next || pulse->deadline_ms < next)
+            {
+                next = pulse->deadline_ms;
+            }
+        }
+        for (int i = 0; i < g_watch_count; i++)
+        {
+            struct held_watch *watch = &g_watches[i];
+            if (!watch->deadline_ms)
+            {
+                continue;
+            }
+            if (now >= watch->deadline_ms)
+            {
+                // 每次保持只报警一次，电平恢复后重新计时
+                push_event(GPIO_EVENT_HELD, watch->code, watch->active_value, monotonic_us());
+                watch->deadline_ms = 0;
+            }
+            else if (!next || watch->deadline_ms < next)
+            {
+                next = watch->deadline_ms;
+            }
+        }
+
+        if (!next)
+        {
+            pthread_cond_wait(&g_timer_cond, &g_timer_mutex);
+            continue;
+        }
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        uint64_t wait_ms = next - now;
+        ts.tv_sec += wait_ms / 1000;
+        ts.tv_nsec += (wait_ms % 1000) * 1000000;
+        if (ts.tv_nsec >= 1000000000)
+        {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000;
+        }
+        pthread_cond_timedwait(&g_timer_cond, &g_timer_mutex, &ts);
+    }
+    pthread_mutex_unlock(&g_timer_mutex);
+    return NULL;
+}
+
+// 调用时需持有 g_timer_mutex
+static int ensure_timer_locked(void)
+{
+    if (g_timer_running)
+    {
+        pthread_cond_signal(&g_timer_cond);
+        return 0;
+    }
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&g_timer_cond, &attr);
+    pthread_condattr_destroy(&attr);
+    g_timer_running = 1;
+    if (pthread_create(&g_timer_thread, NULL, gpio_timer, NULL) != 0)
+    {
+        printf("创建GPIO定时线程失败\n");
+        g_timer_running = 0;
+        pthread_cond_destroy(&g_timer_cond);
+        return -1;
+    }
+    return 0;
+}
+
+int gpio_pulse(uint32_t gpio, int ms)
+{
+    pthread_mutex_lock(&g_timer_mutex);
+    struct pulse *pulse = NULL;
+    struct pulse *unused = NULL;
+    for (int i = 0; i < GPIO_PULSE_MAX; i++)
+    {
+        if (g_pulses[i].used && g_pulses[i].gpio == gpio)
+        {
+            pulse = &g_pulses[i];
+            break;
+        }
+        if (!g_pulses[i].used && !unused)
+        {
+            unused = &g_pulses[i];
+        }
+    }
+    if (ms <= 0)
+    {
+        if (pulse)
+        {
+            pulse->deadline_ms = 0;
+        }
+        pthread_mutex_unlock(&g_timer_mutex);
+        return 0;
+    }
+    if (!pulse)
+    {
+        if (!unused)
+        {
+            pthread_mutex_unlock(&g_timer_mutex);
+            return -1;
+        }
+        if (!g_pulse_gpio_ready)
+        {
+            vbar_drv_gpio_init();
+            g_pulse_gpio_ready = 1;
+        }
+        vbar_drv_gpio_request(gpio);
+        pulse = unused;
+        pulse->gpio = gpio;
+        pulse->used = 1;
+        pulse->deadline_ms = 0;
+    }
+    if (!pulse->deadline_ms)
+    {
+        vbar_drv_gpio_set_func(gpio, GPIO_OUTPUT1);
+    }
+    pulse->deadline_ms = monotonic_us() / 1000 + ms;
+    int ret = ensure_timer_locked();
+    pthread_mutex_unlock(&g_timer_mutex);
+    return ret;
+}
+
+int gpio_event_watch_held(int code, int active_value, int timeout_ms)
+{
+    pthread_mutex_lock(&g_timer_mutex);
+    int index = -1;
+    for (int i = 0; i < g_watch_count; i++)
+    {
+        if (g_watches[i].code == code)
+        {
+            index = i;
+            break;
+        }
+    }
+    if (timeout_ms <= 0)
+    {
+        if (index >= 0)
+        {
+            g_watches[index] = g_watches[--g_watch_count];
+        }
+        pthread_mutex_unlock(&g_timer_mutex);
+        return 0;
+    }
+    if (index < 0)
+    {
+        if (g_watch_count == GPIO_HELD_WATCH_MAX)
+        {
+            pthread_mutex_unlock(&g_timer_mutex);
+            return -1;
+        }
+        index = g_watch_count++;
+    }
+    struct held_watch *watch = &g_watches[index];
+    watch->code = code;
+    watch->active_value = active_value;
+    watch->timeout_ms = timeout_ms;
+    watch->deadline_ms = 0;
+    // 设置时已处于有效电平则立即开始计时
+    for (int i = 0; i < g_key_count; i++)
+    {
+        if (g_key_codes[i] == code && g_key_values[i] == active_value)
+        {
+            watch->deadline_ms = monotonic_us() / 1000 + timeout_ms;
+        }
+    }
+    int ret = ensure_timer_locked();
+    pthread_mutex_unlock(&g_timer_mutex);
+    return ret;
+}
+
+// ---------------- 按键回调 ----------------
+
+// gpio_key 模块的读线程中回调，只记录事件和更新计时
+static void gpio_key_callback(int code, int type, int value, void *pdata)
+{
+    (void)type;
+    (void)pdata;
+    uint64_t timestamp = monotonic_us();
+    if (value == GPIO_KEY_VALUE_REPEAT)
+    {
+        return;
+    }
+    value = value ? 1 : 0;
+
+    pthread_mutex_lock(&g_timer_mutex);
+    int index = -1;
+    for (int i = 0; i < g_key_count; i++)
+    {
+        if (g_key_codes[i] == code)
+        {
+            index = i;
+            break;
+        }
+    }
+    if (index < 0 && g_key_count < GPIO_KEY_MAX)
+    {
+        index = g_key_count++;
+        g_key_codes[index] = code;
+        g_key_values[index] = -1;
+    }
+    if (index >= 0)
+    {
+        if (g_key_values[index] == value)
+        {
+            pthread_mutex_unlock(&g_timer_mutex);
+            return;
+        }
+        g_key_values[index] = value;
+    }
+    push_event(GPIO_EVENT_EDGE, code, value, timestamp);
+
+    for (int i = 0; i < g_watch_count; i++)
+    {
+        struct held_watch *watch = &g_watches[i];
+        if (watch->code != code)
+        {
+            continue;
+        }
+        watch->deadline_ms = value == watch->active_value ? timestamp / 1000 + watch->timeout_ms : 0;
+        if (g_timer_running)
+        {
+            pthread_cond_signal(&g_timer_cond);
+        }
+    }
+    pthread_mutex_unlock(&g_timer_mutex);
+}
+
+// gpio_key 模块接口，按名字查找，类型取自 gpio_key.h
+#define KEY_SYM(name) static __typeof__(&name) p_##name = NULL
+#define KEY_LOAD(lib, name) (p_##name = (__typeof__(&name))dlsym(lib, #name))
+
+KEY_SYM(vbar_m_gpio_key_init);
+KEY_SYM(vbar_m_gpio_key_deinit);
+KEY_SYM(vbar_m_gpio_key_register_cb);
+KEY_SYM(vbar_m_gpio_key_unregister_cb);
+
+static void *g_key_lib = NULL;
+
+static int gpio_key_load(void)
+{
+    if (g_key_lib)
+    {
+        return 0;
+    }
+    void *lib = dlopen(GPIO_KEY_LIB_PATH, RTLD_NOW);
+    if (!lib)
+    {
+        printf("GPIO按键模块加载失败，输入事件不可用: %s\n", dlerror());
+        return -1;
+    }
+    if (!KEY_LOAD(lib, vbar_m_gpio_key_init) || !KEY_LOAD(lib, vbar_m_gpio_key_deinit) ||
+        !KEY_LOAD(lib, vbar_m_gpio_key_register_cb) || !KEY_LOAD(lib, vbar_m_gpio_key_unregister_cb))
+    {
+        printf("GPIO按键模块接口不完整，输入事件不可用\n");
+        dlclose(lib);
+        return -1;
+    }
+    g_key_lib = lib;
+    return 0;
+}
+
+static int g_event_ready = 0;
+
+int gpio_event_init(void)
+{
+    if (g_event_ready)
+    {
+        return 0;
+    }
+    if (gpio_key_load() != 0)
+    {
+        return -1;
+    }
+    if (p_vbar_m_gpio_key_init() != 0)
+    {
+        printf("GPIO按键模块初始化失败\n");
+        return -1;
+    }
+    if (p_vbar_m_gpio_key_register_cb(GPIO_KEY_CALLBACK_NAME, gpio_key_callback, NULL) != 0)
+    {
+        printf("注册GPIO按键回调失败\n");
+        p_vbar_m_gpio_key_deinit();
+        return -1;
+    }
+    g_event_ready = 1;
+    return 0;
+}
+
+void gpio_event_deinit(void)
+{
+    if (!g_event_ready)
+    {
+        return;
+    }
+    p_vbar_m_gpio_key_unregister_cb(GPIO_KEY_CALLBACK_NAME);
+    p_vbar_m_gpio_key_deinit();
+    g_event_ready = 0;
+}
@@ -0,0 +1,76 @@
+#ifndef GPIO_WRAPPER_H
+#define GPIO_WRAPPER_H
+
+#include <stdint.h>
+#include "./include/gpio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 事件类型
+enum gpio_event_type
+{
+    GPIO_EVENT_EDGE = 0, // 输入电平变化
+    GPIO_EVENT_HELD = 1, // 输入保持有效电平超过设定时间（如门长开）
+};
+
+struct gpio_event_t
+{
+    uint32_t seq;
+    int type;             // gpio_event_type
+    int code;             // 按键码（设备树 gpio-keys 节点中配置）
+    int value;            // 电平，1有效 0无效
+    int64_t timestamp_us; // 单调时钟时间戳
+};
+
+int init_gpio();
+void deinit_gpio();
+int request_gpio(uint32_t gpio);
+void free_gpio(uint32_t gpio);
+void set_func_gpio(uint32_t gpio, enum gpio_function func);
+void set_pull_state_gpio(uint32_t gpio, uint32_t state);
+int get_pull_state_gpio(uint32_t gpio);
+void set_value_gpio(uint32_t gpio, uint8_t value);
+int get_value_gpio(uint32_t gpio);
+void set_drive_strength_gpio(uint32_t gpio, uint16_t strength);
+uint16_t get_drive_strength_gpio(uint32_t gpio);
+
+// 输入事件：基于 gpio_key 模块，边沿由驱动中断上报，去抖在内核 gpio-keys 驱动中完成
+// （设备树 debounce-interval），这里只打时间戳、过滤重复电平后放入队列，不做任何轮询
+
+int gpio_event_init(void);
+void gpio_event_deinit(void);
+
+// 批量取出事件，返回个数
+int gpio_event_read(struct gpio_event_t *events, int max);
+
+// 因队列满被丢弃的事件数
+uint32_t gpio_event_dropped(void);
+
+/**
+ * @brief 监视输入保持有效电平的时长，超过 timeout_ms 时立即产生一次 GPIO_EVENT_HELD 事件
+ *
+ * @param code 按键码
+ * @param active_value 有效电平
+ * @param timeout_ms 超时时间，0表示取消监视
+ *
+ * @return 0成功，-1监视数已满
+ */
+int gpio_event_watch_held(int code, int active_value, int timeout_ms);
+
+/**
+ * @brief 输出脉冲：置高电平，ms 毫秒后由后台线程自动拉低；输出期间再次调用只延长时长
+ *
+ * @param gpio gpio号
+ * @param ms 脉冲时长，0表示取消未到期的自动拉低（电平保持不变）
+ *
+ * @return 0成功，-1失败
+ */
+int gpio_pulse(uint32_t gpio, int ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GPIO_WRAPPER_H
@@ -0,0 +1,168 @@
+#include "vbar_mock.h"
+#include "../face/face.h"
+#include "../face/latency.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <getopt.h>
+
+// 识别链路时延基准：用模拟驱动回放帧（或合成场景），预先注册 N 个合成用户，
+// 按 app 的方式轮询识别结果并打权限判定、结果提示时间戳，结束后输出各阶段时延统计（JSON）
+
+struct recognition_t
+{
+    float score;
+    int is_living;
+    int living_score;
+    unsigned int trace_id;
+};
+struct face_config_t
+{
+    int living_check_enable;
+};
+
+struct vbar_m_capturer_handle *capturer_rgb_init(void);
+struct vbar_m_capturer_handle *capturer_nir_init(void);
+void capturer_rgb_deinit(void);
+void capturer_nir_deinit(void);
+int face_init(void *rgb, void *nir, struct face_config_t *options);
+void face_deinit(void);
+struct recognition_t get_face_recognition_result(char *userid);
+void set_face_recognition_result(int is_success);
+void face_latency_mark(unsigned int trace_id, int stage);
+int face_get_latency_stats(int index, struct latency_stats_t *stats);
+
+static const char *HIST_NAMES[LATENCY_HIST_COUNT] = {"total", "detect", "recognize", "compare", "poll", "access", "result"};
+
+static void usage(const char *name)
+{
+    printf("usage: %s [-u users] [-d seconds] [-a access_us] [-l] [-v version] [-o report.json]\n"
+           "  -u  预先注册的合成用户数，默认100\n"
+           "  -d  运行时长（秒），默认30\n"
+           "  -a  模拟 JS 权限判定耗时（微秒），默认2000\n"
+           "  -l  开启活体检测（读取红外帧）\n"
+           "  -v  固件版本标识，写入报告\n"
+           "  -o  报告文件，默认输出到标准输出\n",
+           name);
+}
+
+static void write_report(FILE *fp, const char *version, int users, int seconds, int living, unsigned int recognitions, unsigned int matched)
+{
+    fprintf(fp, "{\n  \"version\": \"%s\",\n  \"users\": %d,\n  \"duration_s\": %d,\n  \"living_check\": %d,\n", version, users, seconds, living);
+    fprintf(fp, "  \"fps\": %ld,\n  \"recognitions\": %u,\n  \"matched\": %u,\n  \"stages\": {\n", mock_env_long("VBAR_MOCK_FPS", 25), recognitions, matched);
+    for (int i = 0; i < LATENCY_HIST_COUNT; i++)
+    {
+        struct latency_stats_t s;
+        face_get_latency_stats(i, &s);
+        fprintf(fp, "    \"%s\": {\"count\": %u, \"min_us\": %u, \"mean_us\": %u, \"p50_us\": %u, \"p90_us\": %u, \"p99_us\": %u, \"p999_us\": %u, \"max_us\": %u}%s\n",
+                HIST_NAMES[i], s.count, s.min_us, s.mean_us, s.p50_us, s.p90_us, s.p99_us, s.p999_us, s.max_us, i + 1 < LATENCY_HIST_COUNT ? "," : "");
+    }
+    fprintf(fp, "  }\n}\n");
+}
+
+int main(int argc, char **argv)
+{
+    int users = 100;
+    int seconds = 30;
+    long access_us = 2000;
+    int living = 0;
+    const char *version = "unknown";
+    const char *output = NULL;
+    int opt;
+    while ((opt = getopt(argc, argv, "u:d:a:lv:o:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 'u':
+            users = atoi(optarg);
+            break;
+        case 'd':
+            seconds = atoi(optarg);
+            break;
+        case 'a':
+            access_us = atol(optarg);
+            break;
+        case 'l':
+            living = 1;
+            break;
+        case 'v':
+            version = optarg;
+            break;
+        case 'o':
+            output = optarg;
+            break;
+        default:
+            usage(argv[0]);
+            return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (users < 1)
+    {
+        users = 1;
+    }
+
+    // 场景中轮流出现的人员与注册用户一致，未单独指定时全部可识别
+    char users_env[16];
+    snprintf(users_env, sizeof(users_env), "%d", users);
+    setenv("VBAR_MOCK_FACE_USERS", users_env, 0);
+
+    struct vbar_m_capturer_handle *rgb = capturer_rgb_init();
+    struct vbar_m_capturer_handle *nir = capturer_nir_init();
+    struct face_config_t options = {.living_check_enable = living};
+    if (!rgb || !nir || face_init(rgb, nir, &options) != 0)
+    {
+        fprintf(stderr, "face init failed\n");
+        return 1;
+    }
+
+    uint8_t feature[VBAR_DRV_FACE_FEATURE_SIZE];
+    for (int i = 0; i < users; i++)
+    {
+        char userid[32];
+        snprintf(userid, sizeof(userid), "user%d", i);
+        mock_face_make_feature(i, 0x9e3779b9u ^ i, feature);
+        if (vbar_drv_face_features_register(userid, feature) != 0)
+        {
+            fprintf(stderr, "register %s failed, library full\n", userid);
+            break;
+        }
+    }
+
+    // 与 app 一样每5ms轮询一次识别结果
+    unsigned int recognitions = 0;
+    unsigned int matched = 0;
+    uint64_t end = mock_now_us() + (uint64_t)seconds * 1000000;
+    while (mock_now_us() < end)
+    {
+        char userid[256] = {0};
+        struct recognition_t r = get_face_recognition_result(userid);
+        if (r.score > 0)
+        {
+            recognitions++;
+            matched += r.score > 0.6;
+            mock_sleep_us(access_us);
+            face_latency_mark(r.trace_id, LATENCY_STAGE_ACCESS);
+            face_latency_mark(r.trace_id, LATENCY_STAGE_RESULT);
+            set_face_recognition_result(0);
+        }
+        mock_sleep_us(5000);
+    }
+
+    face_deinit();
+    capturer_rgb_deinit();
+    capturer_nir_deinit();
+
+    FILE *fp = output ? fopen(output, "w") : stdout;
+    if (!fp)
+    {
+        perror(output);
+        return 1;
+    }
+    write_report(fp, version, users, seconds, living, recognitions, matched);
+    if (fp != stdout)
+    {
+        fclose(fp);
+    }
+    return 0;
+}
@@ -0,0 +1,39 @@
+# x86 主机版本：用 libvbar-mock.so 代替设备上的 vbar 驱动库，编译出的 wrapper 放在 out/，可直接在容器中做吞吐、延时测试
+# 各库 runpath 为 $ORIGIN，从 out/ 直接加载即可，模拟行为见 vbar_mock.h 中的环境变量说明
+set -e
+DIR=$(cd $(dirname $0) && pwd)
+SRC=$DIR/..
+INC="-I$SRC/../driver/include -I$SRC/../driver/include/thirdlib"
+OUT=$DIR/out
+CC=${CC:-gcc}
+CFLAGS="-Wall -Wextra -fPIC -shared -O2 -g"
+# wrapper 之间有依赖（如 face -> capturer -> vbar-mock），runpath 指向自身目录，不设 LD_LIBRARY_PATH 也能解析间接依赖
+RPATH='-Wl,--enable-new-dtags,-rpath,$ORIGIN'
+mkdir -p $OUT
+
+$CC $CFLAGS -o $OUT/libvbar-mock.so $DIR/mock_common.c $DIR/mock_capturer.c $DIR/mock_image.c $DIR/mock_face.c $DIR/mock_audio.c $DIR/mock_io.c -pthread -lm $INC $RPATH
+
+$CC $CFLAGS -o $OUT/libmetrics_wrapper.so $SRC/metrics/metrics.c -pthread -lrt $RPATH
+$CC $CFLAGS -o $OUT/libcapturer_wrapper.so $SRC/capturer/capturer_wrapper.c -pthread -lvbar-mock $INC -L$OUT $RPATH
+$CC $CFLAGS -o $OUT/libface_wrapper.so $SRC/face/face_wrapper.c $SRC/face/snapshot.c $SRC/face/latency.c -pthread -lcapturer_wrapper -lmetrics_wrapper -lvbar-mock $INC -L$OUT $RPATH
+# 识别链路时延基准，用法见 bench_face -h
+$CC -Wall -Wextra -O2 -g -o $OUT/bench_face $DIR/bench_face.c -pthread -lface_wrapper -lcapturer_wrapper -lvbar-mock $INC -L$OUT $RPATH
+$CC $CFLAGS -o $OUT/libaudio_wrapper.so $SRC/audio/audio_wrapper.c -lvbar-mock $INC -L$OUT $RPATH
+$CC $CFLAGS -o $OUT/libgpio_wrapper.so $SRC/gpio/gpio_wrapper.c -pthread -ldl -lvbar-mock $INC -L$OUT $RPATH
+$CC $CFLAGS -o $OUT/libpwm_wrapper.so $SRC/pwm/pwm_wrapper.c -lvbar-mock $INC -L$OUT $RPATH
+$CC $CFLAGS -o $OUT/libdisplay_wrapper.so $SRC/display/display_wrapper.c -lvbar-mock $INC -L$OUT $RPATH
+$CC $CFLAGS -o $OUT/libchannel_wrapper.so $SRC/channel/channel_wrapper.c -pthread -lvbar-mock $INC -L$OUT $RPATH
+
+# NFC 凭证库使用主机上的 sqlite3；GPIO按键、NFC模块按设备路径动态加载，主机上按不可用处理
+if echo 'int main(void){return 0;}' | $CC -x c - -o /dev/null -lsqlite3 > /dev/null 2>&1; then
+    $CC $CFLAGS -o $OUT/libnfc_wrapper.so $SRC/nfc/nfc_wrapper.c $SRC/nfc/credential.c -pthread -ldl -lgpio_wrapper -lvbar-mock -lsqlite3 $INC -L$OUT $RPATH
+else
+    echo "skip nfc: sqlite3 not found"
+fi
+
+# MQTT 直接使用主机上的 paho 库，连本地 broker 测试
+if echo '#include <MQTTAsync.h>' | $CC -E - > /dev/null 2>&1; then
+    $CC $CFLAGS -o $OUT/libmqtt_wrapper.so $SRC/mqtt/mqtt_wrapper.c -lpaho-mqtt3as -lmetrics_wrapper -L$OUT -lpthread -lssl -lcrypto $RPATH
+else
+    echo "skip mqtt: paho-mqtt (MQTTAsync.h) not found"
+fi
@@ -0,0 +1,196 @@
+#include "vbar_mock.h"
+#include <stdbool.h>
+#include "../audio/audio.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+// 音频模拟：与真实模块一样播放请求入队后立即返回，由播放线程按音频时长占用，不输出声音
+
+#define MOCK_AUDIO_QUEUE_SIZE 8
+#define MOCK_AUDIO_VOLUME_MAX 255
+
+struct vbar_m_audio_handle
+{
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    int running;
+    int interrupt;
+    uint32_t volume;
+    long durations_ms[MOCK_AUDIO_QUEUE_SIZE];
+    int head;
+    int count;
+};
+
+// WAV 时长：数据长度 / 每秒字节数，读取失败返回-1
+static long wav_duration_ms(const uint8_t *header, size_t len)
+{
+    if (len < 44 || memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVE", 4) != 0)
+    {
+        return -1;
+    }
+    uint32_t byte_rate = header[28] | header[29] << 8 | header[30] << 16 | (uint32_t)header[31] << 24;
+    uint32_t data_len = header[40] | header[41] << 8 | header[42] << 16 | (uint32_t)header[43] << 24;
+    return byte_rate ? (long)((uint64_t)data_len * 1000 / byte_rate) : -1;
+}
+
+static long play_duration_ms(const struct vbar_m_audio_play_params *params)
+{
+    long ms = -1;
+    if (params->play_mode == VBAR_M_AUDIO_PLAY_BY_WAV_PATH && params->wav_data)
+    {
+        uint8_t header[44];
+        FILE *fp = fopen(params->wav_data, "rb");
+        if (fp)
+        {
+            ms = wav_duration_ms(header, fread(header, 1, sizeof(header), fp));
+            fclose(fp);
+        }
+    }
+    else if (params->play_mode == VBAR_M_AUDIO_PLAY_BY_WAV_DATA && params->wav_data)
+    {
+        ms = wav_duration_ms((const uint8_t *)params->wav_data, params->wav_data_len);
+    }
+    return ms >= 0 ? ms : mock_env_long("VBAR_MOCK_AUDIO_MS", 500);
+}
+
+static void *play_thread(void *arg)
+{
+    struct vbar_m_audio_handle *h = arg;
+    pthread_mutex_lock(&h->mutex);
+    while (h->running)
+    {
+        if (h->count == 0)
+        {
+            pthread_cond_wait(&h->cond, &h->mutex);
+            continue;
+        }
+        long ms = h->durations_ms[h->head];
+        h->head = (h->head + 1) % MOCK_AUDIO_QUEUE_SIZE;
+        h->count--;
+        h->interrupt = 0;
+
+        // 分段等待，便于打断
+        uint64_t end = mock_now_us() + ms * 1000;
+        while (h->running && !h->interrupt && mock_now_us() < end)
+        {
+            pthread_mutex_unlock(&h->mutex);
+            mock_sleep_us(10000);
+            pthread_mutex_lock(&h->mutex);
+        }
+    }
+    pthread_mutex_unlock(&h->mutex);
+    return NULL;
+}
+
+struct vbar_m_audio_handle *vbar_m_audio_init(struct vbar_m_audio_config *audio_config)
+{
+    struct vbar_m_audio_handle *h = calloc(1, sizeof(*h));
+    if (!h)
+    {
+        return NULL;
+    }
+    h->volume = audio_config ? audio_config->volume : 30;
+    h->running = 1;
+    pthread_mutex_init(&h->mutex, NULL);
+    pthread_cond_init(&h->cond, NULL);
+    if (pthread_create(&h->thread, NULL, play_thread, h) != 0)
+    {
+        free(h);
+        return NULL;
+    }
+    return h;
+}
+
+void vbar_m_audio_deinit(struct vbar_m_audio_handle *handle)
+{
+    if (!handle)
+    {
+        return;
+    }
+    pthread_mutex_lock(&handle->mutex);
+    handle->running = 0;
+    pthread_cond_signal(&handle->cond);
+    pthread_mutex_unlock(&handle->mutex);
+    pthread_join(handle->thread, NULL);
+    pthread_mutex_destroy(&handle->mutex);
+    pthread_cond_destroy(&handle->cond);
+    free(handle);
+}
+
+bool vbar_m_audio_is_valid_volume(uint32_t volume)
+{
+    return volume <= MOCK_AUDIO_VOLUME_MAX;
+}
+
+int vbar_m_audio_get_volume_range(struct vbar_m_audio_handle *handle, uint32_t *max, uint32_t *min)
+{
+    if (!handle || !max || !min)
+    {
+        return -1;
+    }
+    *max = MOCK_AUDIO_VOLUME_MAX;
+    *min = 0;
+    return 0;
+}
+
+int vbar_m_audio_get_volume(struct vbar_m_audio_handle *handle)
+{
+    return handle ? (int)handle->volume : -1;
+}
+
+int vbar_m_audio_set_volume(struct vbar_m_audio_handle *handle, uint32_t volume_num)
+{
+    if (!handle || !vbar_m_audio_is_valid_volume(volume_num))
+    {
+        return -1;
+    }
+    handle->volume = volume_num;
+    return 0;
+}
+
+int vbar_m_audio_play(struct vbar_m_audio_handle *handle, struct vbar_m_audio_play_params *play_params)
+{
+    if (!handle || !play_params)
+    {
+        return AUDIO_PLAY_FAILED;
+    }
+    long ms = play_duration_ms(play_params);
+    pthread_mutex_lock(&handle->mutex);
+    if (handle->count == MOCK_AUDIO_QUEUE_SIZE)
+    {
+        pthread_mutex_unlock(&handle->mutex);
+        return AUDIO_PLAY_QUEUE_IS_FULL;
+    }
+    handle->durations_ms[(handle->head + handle->count) % MOCK_AUDIO_QUEUE_SIZE] = ms;
+    handle->count++;
+    pthread_cond_signal(&handle->cond);
+    pthread_mutex_unlock(&handle->mutex);
+    return AUDIO_PLAY_SUCCESS;
+}
+
+int vbar_m_audio_playing_interrupt(struct vbar_m_audio_handle *handle)
+{
+    if (!handle)
+    {
+        return -1;
+    }
+    pthread_mutex_lock(&handle->mutex);
+    handle->interrupt = 1;
+    pthread_mutex_unlock(&handle->mutex);
+    return 0;
+}
+
+int vbar_m_audio_clear_play_cache(struct vbar_m_audio_handle *handle)
+{
+    if (!handle)
+    {
+        return -1;
+    }
+    pthread_mutex_lock(&handle->mutex);
+    handle->count = 0;
+    pthread_mutex_unlock(&handle->mutex);
+    return 0;
+}
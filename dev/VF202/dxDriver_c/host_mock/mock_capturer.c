@@ -0,0 +1,199 @@
+#include "vbar_mock.h"
+#include "../capturer/capturer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#define MOCK_MAX_FRAME_FILES 4096
+
+struct vbar_m_capturer_handle
+{
+    uint32_t width;
+    uint32_t height;
+    size_t frame_size;
+    char **files;
+    int file_count;
+    int file_index;
+    uint64_t interval_us;
+    uint64_t next_us;
+    pthread_mutex_t mutex;
+};
+
+static int compare_name(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+// 录制帧目录：VBAR_MOCK_FRAMES_DIR/<设备节点名>/，只取大小等于一帧的文件
+static void load_frame_files(struct vbar_m_capturer_handle *h, const char *path)
+{
+    const char *root = mock_env_str("VBAR_MOCK_FRAMES_DIR", NULL);
+    if (!root || !path)
+    {
+        return;
+    }
+    const char *node = strrchr(path, '/');
+    node = node ? node + 1 : path;
+    char dir_path[512];
+    snprintf(dir_path, sizeof(dir_path), "%s/%s", root, node);
+    DIR *dir = opendir(dir_path);
+    if (!dir)
+    {
+        printf("mock capturer: %s not found, use synthetic frames\n", dir_path);
+        return;
+    }
+    h->files = calloc(MOCK_MAX_FRAME_FILES, sizeof(char *));
+    struct dirent *entry;
+    while (h->files && h->file_count < MOCK_MAX_FRAME_FILES && (entry = readdir(dir)))
+    {
+        char file_path[1024];
+        struct stat st;
+        snprintf(file_path, sizeof(file_path), "%s/%s", dir_path, entry->d_name);
+        if (stat(file_path, &st) != 0 || !S_ISREG(st.st_mode))
+        {
+            continue;
+        }
+        if ((size_t)st.st_size != h->frame_size)
+        {
+            printf("mock capturer: skip %s, size %ld != %zu\n", file_path, (long)st.st_size, h->frame_size);
+            continue;
+        }
+        h->files[h->file_count++] = strdup(file_path);
+    }
+    closedir(dir);
+    qsort(h->files, h->file_count, sizeof(char *), compare_name);
+    printf("mock capturer: replay %d frames from %s\n", h->file_count, dir_path);
+}
+
+// 合成画面：固定渐变背景，有人时叠加移动的亮块，供帧差门控和人脸检测使用
+static void fill_synthetic(struct vbar_m_capturer_handle *h, uint8_t *data, uint64_t now)
+{
+    uint8_t *luma = data;
+    for (uint32_t y = 0; y < h->height; y++)
+    {
+        memset(luma + y * h->width, 16 + (y * 160 / h->height), h->width);
+    }
+    memset(data + h->width * h->height, 128, h->frame_size - h->width * h->height);
+
+    int identity, track_id, rect[4];
+    if (mock_scene_face(now, h->width, h->height, &identity, &track_id, rect))
+    {
+        for (int y = rect[1]; y < rect[3]; y++)
+        {
+            memset(luma + y * h->width + rect[0], 200 + identity * 10, rect[2] - rect[0]);
+        }
+    }
+}
+
+static int fill_recorded(struct vbar_m_capturer_handle *h, uint8_t *data)
+{
+    const char *file_path = h->files[h->file_index];
+    h->file_index = (h->file_index + 1) % h->file_count;
+    FILE *fp = fopen(file_path, "rb");
+    if (!fp)
+    {
+        return -1;
+    }
+    size_t n = fread(data, 1, h->frame_size, fp);
+    fclose(fp);
+    return n == h->frame_size ? 0 : -1;
+}
+
+struct vbar_m_capturer_handle *vbar_m_capturer_init(struct vbar_m_capturer_config *config,
+                                                    enum vbar_m_isp_type isp_type,
+                                                    const struct vbar_m_isp_config *isp_config)
+{
+    (void)isp_type;
+    (void)isp_config;
+    if (!config || !config->width || !config->height)
+    {
+        return NULL;
+    }
+    struct vbar_m_capturer_handle *h = calloc(1, sizeof(*h));
+    if (!h)
+    {
+        return NULL;
+    }
+    h->width = config->width;
+    h->height = config->height;
+    // 统一按 NV12 输出
+    h->frame_size = (size_t)h->width * h->height * 3 / 2;
+    long fps = mock_env_long("VBAR_MOCK_FPS", 25);
+    h->interval_us = fps > 0 ? 1000000 / fps : 0;
+    pthread_mutex_init(&h->mutex, NULL);
+    load_frame_files(h, config->path);
+    return h;
+}
+
+void vbar_m_capturer_deinit(struct vbar_m_capturer_handle *capturer)
+{
+    if (!capturer)
+    {
+        return;
+    }
+    for (int i = 0; i < capturer->file_count; i++)
+    {
+        free(capturer->files[i]);
+    }
+    free(capturer->files);
+    pthread_mutex_destroy(&capturer->mutex);
+    free(capturer);
+}
+
+// 按帧率阻塞到下一帧，与真实驱动一样调用方读不过来时不会积压
+struct vbar_drv_image *vbar_m_capturer_read(struct vbar_m_capturer_handle *capturer)
+{
+    if (!capturer)
+    {
+        return NULL;
+    }
+    pthread_mutex_lock(&capturer->mutex);
+    uint64_t now = mock_now_us();
+    if (capturer->next_us > now)
+    {
+        mock_sleep_us(capturer->next_us - now);
+        now = mock_now_us();
+    }
+    capturer->next_us = (capturer->next_us + capturer->interval_us > now ? capturer->next_us : now) + capturer->interval_us;
+
+    // 多留一个指针大小，兼容带 pdata 成员的 vbar_drv_image 定义
+    struct vbar_drv_image *image = calloc(1, sizeof(*image) + sizeof(void *));
+    uint8_t *data = image ? malloc(capturer->frame_size) : NULL;
+    if (!data)
+    {
+        free(image);
+        pthread_mutex_unlock(&capturer->mutex);
+        return NULL;
+    }
+    if (capturer->file_count == 0 || fill_recorded(capturer, data) != 0)
+    {
+        fill_synthetic(capturer, data, now);
+    }
+    pthread_mutex_unlock(&capturer->mutex);
+
+    image->layout_type = VBAR_DRV_IMAGE_LAYOUT_CAPTURER;
+    image->width = capturer->width;
+    image->height = capturer->height;
+    image->widthbytes = 2;
+    image->data = data;
+    image->datalen = capturer->frame_size;
+    image->timestamp = now;
+    return image;
+}
+
+void vbar_m_capturer_image_destroy(struct vbar_drv_image *image)
+{
+    if (image)
+    {
+        free(image->data);
+        free(image);
+    }
+}
+
+void vbar_drv_capturer_image_destroy(struct vbar_drv_image *image)
+{
+    vbar_m_capturer_image_destroy(image);
+}
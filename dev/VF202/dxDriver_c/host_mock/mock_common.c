@@ -0,0 +1,72 @@
+#include "vbar_mock.h"
+#include <stdlib.h>
+#include <time.h>
+#include <errno.h>
+
+uint64_t mock_now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+void mock_sleep_us(long us)
+{
+    if (us <= 0)
+    {
+        return;
+    }
+    struct timespec ts = {us / 1000000, (us % 1000000) * 1000};
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR)
+    {
+    }
+}
+
+long mock_env_long(const char *name, long def)
+{
+    const char *value = getenv(name);
+    if (!value || !*value)
+    {
+        return def;
+    }
+    char *end;
+    long ret = strtol(value, &end, 10);
+    return *end ? def : ret;
+}
+
+const char *mock_env_str(const char *name, const char *def)
+{
+    const char *value = getenv(name);
+    return value && *value ? value : def;
+}
+
+int mock_scene_face(uint64_t now_us, uint32_t width, uint32_t height, int *identity, int *track_id, int rect[4])
+{
+    long present_ms = mock_env_long("VBAR_MOCK_FACE_PRESENT_MS", 3000);
+    long absent_ms = mock_env_long("VBAR_MOCK_FACE_ABSENT_MS", 2000);
+    long users = mock_env_long("VBAR_MOCK_FACE_USERS", 3);
+    if (present_ms <= 0)
+    {
+        return 0;
+    }
+    uint64_t period = present_ms + (absent_ms > 0 ? absent_ms : 0);
+    uint64_t now_ms = now_us / 1000;
+    uint64_t cycle = now_ms / period;
+    uint64_t phase = now_ms % period;
+    if (phase >= (uint64_t)present_ms)
+    {
+        return 0;
+    }
+    *identity = users > 0 ? (int)(cycle % users) : 0;
+    *track_id = (int)(cycle % 100000) + 1;
+
+    // 人脸方块在出现期间从左向右移动
+    uint32_t size = height / 4;
+    uint32_t x = (uint32_t)((uint64_t)(width - size) * phase / present_ms);
+    uint32_t y = (height - size) / 2;
+    rect[0] = x;
+    rect[1] = y;
+    rect[2] = x + size;
+    rect[3] = y + size;
+    return 1;
+}
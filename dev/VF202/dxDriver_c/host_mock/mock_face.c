@@ -0,0 +1,445 @@
+#include "vbar_mock.h"
+#include "../face/face.h"
+#include "../capturer/capturer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+// 人脸引擎模拟：后台线程通过配置中的取图回调拉帧，按合成场景上报检测结果，
+// 上层设置识别模式后为每个跟踪ID上报一次带特征值的识别结果；特征库在内存中线性比对
+
+#define MOCK_FACE_CALLBACK_MAX 8
+
+struct callback_entry
+{
+    char name[32];
+    vbar_drv_face_callback func;
+    void *pdata;
+};
+
+struct feature_entry
+{
+    char userid[VBAR_DRV_FACE_USERID_SIZE];
+    uint8_t feature[VBAR_DRV_FACE_FEATURE_SIZE];
+};
+
+static struct vbar_drv_face_config g_config;
+static pthread_t g_engine;
+static volatile int g_running = 0;
+static volatile int g_paused = 0;
+
+static pthread_mutex_t g_callback_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct callback_entry g_detect_callbacks[MOCK_FACE_CALLBACK_MAX];
+static struct callback_entry g_nir_callbacks[MOCK_FACE_CALLBACK_MAX];
+static struct callback_entry g_recg_callbacks[MOCK_FACE_CALLBACK_MAX];
+
+// 上层为当前跟踪ID设置的处理模式
+static pthread_mutex_t g_mode_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int g_mode_id = -1;
+static struct vbar_drv_face_process_mode g_mode;
+
+static pthread_rwlock_t g_db_lock = PTHREAD_RWLOCK_INITIALIZER;
+static struct feature_entry *g_db = NULL;
+static int g_db_count = 0;
+static int g_db_max = 0;
+
+// ---------------- 合成特征值 ----------------
+
+static uint32_t xorshift(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+// 同一人员的特征值固定，每次采样叠加少量噪声，同人比对约0.99，不同人约0
+void mock_face_make_feature(int identity, uint32_t noise_seed, uint8_t *feature)
+{
+    uint32_t base = (uint32_t)(identity + 1) * 2654435761u;
+    uint32_t noise = noise_seed | 1;
+    for (int i = 0; i < VBAR_DRV_FACE_FEATURE_SIZE; i++)
+    {
+        int value = (int8_t)(xorshift(&base) & 0xff) + (int)(xorshift(&noise) % 17) - 8;
+        feature[i] = (uint8_t)(int8_t)(value > 127 ? 127 : value < -127 ? -127 : value);
+    }
+}
+
+static float feature_similarity(const uint8_t *a, const uint8_t *b)
+{
+    long long dot = 0, na = 0, nb = 0;
+    for (int i = 0; i < VBAR_DRV_FACE_FEATURE_SIZE; i++)
+    {
+        int x = (int8_t)a[i];
+        int y = (int8_t)b[i];
+        dot += x * y;
+        na += x * x;
+        nb += y * y;
+    }
+    if (!na || !nb)
+    {
+        return 0;
+    }
+    float cos = dot / sqrt((double)na * nb);
+    return cos > 0 ? cos : 0;
+}
+
+// ---------------- 回调 ----------------
+
+static int callback_register(struct callback_entry *list, const char *name, vbar_drv_face_callback func_cb, void *pdata)
+{
+    if (!name || !func_cb)
+    {
+        return -1;
+    }
+    pthread_mutex_lock(&g_callback_mutex);
+    struct callback_entry *unused = NULL;
+    for (int i = 0; i < MOCK_FACE_CALLBACK_MAX; i++)
+    {
+        if (list[i].func && strcmp(list[i].name, name) == 0)
+        {
+            pthread_mutex_unlock(&g_callback_mutex);
+            return -1;
+        }
+        if (!list[i].func && !unused)
+        {
+            unused = &list[i];
+        }
+    }
+    if (unused)
+    {
+        snprintf(unused->name, sizeof(unused->name), "%s", name);
+        unused->func = func_cb;
+        unused->pdata = pdata;
+    }
+    pthread_mutex_unlock(&g_callback_mutex);
+    return unused ? 0 : -1;
+}
+
+static int callback_unregister(struct callback_entry *list, const char *name)
+{
+    int ret = -1;
+    pthread_mutex_lock(&g_callback_mutex);
+    for (int i = 0; i < MOCK_FACE_CALLBACK_MAX; i++)
+    {
+        if (list[i].func && name && strcmp(list[i].name, name) == 0)
+        {
+            list[i].func = NULL;
+            ret = 0;
+        }
+    }
+    pthread_mutex_unlock(&g_callback_mutex);
+    return ret;
+}
+
+static void callback_call(struct callback_entry *list, struct vbar_drv_face_analysis_result *result)
+{
+    struct callback_entry copy[MOCK_FACE_CALLBACK_MAX];
+    pthread_mutex_lock(&g_callback_mutex);
+    memcpy(copy, list, sizeof(copy));
+    pthread_mutex_unlock(&g_callback_mutex);
+    for (int i = 0; i < MOCK_FACE_CALLBACK_MAX; i++)
+    {
+        if (copy[i].func)
+        {
+            copy[i].func(result, copy[i].pdata);
+        }
+    }
+}
+
+// ---------------- 引擎线程 ----------------
+
+static void *engine_thread(void *arg)
+{
+    (void)arg;
+    static struct vbar_drv_face_analysis_result result;
+    int recognized_id = -1;
+    uint32_t sample = 1;
+
+    while (g_running)
+    {
+        if (g_paused || !g_config.rgb_image_read)
+        {
+            mock_sleep_us(20000);
+            continue;
+        }
+        struct vbar_drv_image *rgb = g_config.rgb_image_read();
+        if (!rgb)
+        {
+            mock_sleep_us(10000);
+            continue;
+        }
+        mock_sleep_us(mock_env_long("VBAR_MOCK_DETECT_US", 15000));
+
+        // 活体检测需要红外帧，和真实引擎一样每帧取一次
+        if (g_config.living_check_enable && g_config.nir_image_read)
+        {
+            struct vbar_drv_image *nir = g_config.nir_image_read();
+            if (nir && g_config.image_destory)
+            {
+                g_config.image_destory(nir);
+            }
+        }
+
+        int identity, track_id, rect[4];
+        memset(&result, 0, sizeof(result));
+        if (mock_scene_face(rgb->timestamp, rgb->width, rgb->height, &identity, &track_id, rect))
+        {
+            struct vbar_drv_face_info *info = &result.face_infos[0];
+            result.face_info_num = 1;
+            info->id = track_id;
+            info->info_type = VBAR_DRV_FACE_INFO_TYPE_RGB_DETECTION;
+            info->rgb_detection.score = 95;
+            info->rgb_detection.score_quality = 80;
+            memcpy(info->rgb_detection.rect, rect, sizeof(info->rgb_detection.rect));
+            memcpy(info->rgb_detection.rect_render, rect, sizeof(info->rgb_detection.rect_render));
+            memcpy(info->rgb_detection.rect_smooth, rect, sizeof(info->rgb_detection.rect_smooth));
+        }
+        callback_call(g_detect_callbacks, &result);
+
+        if (result.face_info_num > 0)
+        {
+            struct vbar_drv_face_info *info = &result.face_infos[0];
+            pthread_mutex_lock(&g_mode_mutex);
+            int recognize = g_mode_id == info->id && g_mode.is_recognition && recognized_id != info->id;
+            int living = g_mode.is_living_check;
+            pthread_mutex_unlock(&g_mode_mutex);
+
+            if (recognize && g_config.recg_enable)
+            {
+                mock_sleep_us(mock_env_long("VBAR_MOCK_RECOGNIZE_US", 60000));
+                info->info_type = VBAR_DRV_FACE_INFO_TYPE_RECOGNITION;
+                info->recognition.rgb_image = rgb;
+                info->recognition.is_living_check_success = true;
+                info->recognition.score_living = living ? 90 : 0;
+                info->recognition.is_recognition_sccess = true;
+                memcpy(info->recognition.rect_smooth, rect, sizeof(info->recognition.rect_smooth));
+                mock_face_make_feature(identity, sample++ * 2246822519u, info->recognition.feature);
+                info->recognition.feature_len = VBAR_DRV_FACE_FEATURE_SIZE;
+                callback_call(g_recg_callbacks, &result);
+                recognized_id = info->id;
+            }
+        }
+
+        if (g_config.image_destory)
+        {
+            g_config.image_destory(rgb);
+        }
+    }
+    return NULL;
+}
+
+// ---------------- 接口 ----------------
+
+int vbar_drv_face_init(struct vbar_drv_face_config *config)
+{
+    if (!config || g_running)
+    {
+        return -1;
+    }
+    g_config = *config;
+    g_db_max = config->db_max > 0 ? config->db_max : 1000;
+    g_db = calloc(g_db_max, sizeof(struct feature_entry));
+    if (!g_db)
+    {
+        return -1;
+    }
+    g_db_count = 0;
+    g_paused = 0;
+    g_running = 1;
+    if (pthread_create(&g_engine, NULL, engine_thread, NULL) != 0)
+    {
+        g_running = 0;
+        free(g_db);
+        g_db = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+void vbar_drv_face_deinit(void)
+{
+    if (!g_running)
+    {
+        return;
+    }
+    g_running = 0;
+    pthread_join(g_engine, NULL);
+    pthread_rwlock_wrlock(&g_db_lock);
+    free(g_db);
+    g_db = NULL;
+    g_db_count = 0;
+    pthread_rwlock_unlock(&g_db_lock);
+}
+
+int vbar_drv_face_update_config(struct vbar_drv_face_config *config)
+{
+    if (!config)
+    {
+        return -1;
+    }
+    // 取图回调等在运行中不变，只更新开关类参数
+    g_config.living_check_enable = config->living_check_enable;
+    g_config.recg_enable = config->recg_enable;
+    return 0;
+}
+
+int vbar_drv_face_set_pause(bool pause)
+{
+    g_paused = pause;
+    return 0;
+}
+
+int vbar_drv_face_get_face_process_mode(int id, struct vbar_drv_face_process_mode *mode)
+{
+    pthread_mutex_lock(&g_mode_mutex);
+    int ret = id == g_mode_id ? 0 : -1;
+    if (ret == 0 && mode)
+    {
+        *mode = g_mode;
+    }
+    pthread_mutex_unlock(&g_mode_mutex);
+    return ret;
+}
+
+int vbar_drv_face_set_face_process_mode(int id, struct vbar_drv_face_process_mode *mode)
+{
+    if (!mode)
+    {
+        return -1;
+    }
+    pthread_mutex_lock(&g_mode_mutex);
+    g_mode_id = id;
+    g_mode = *mode;
+    pthread_mutex_unlock(&g_mode_mutex);
+    return 0;
+}
+
+int vbar_drv_face_get_environment_brightness(int *brightness)
+{
+    if (brightness)
+    {
+        *brightness = 128;
+    }
+    return 0;
+}
+
+int vbar_drv_face_detection_callback_register(const char *name, vbar_drv_face_callback func_cb, void *pdata)
+{
+    return callback_register(g_detect_callbacks, name, func_cb, pdata);
+}
+
+int vbar_drv_face_detection_callback_unregister(const char *name)
+{
+    return callback_unregister(g_detect_callbacks, name);
+}
+
+int vbar_drv_face_nir_detection_callback_register(const char *name, vbar_drv_face_callback func_cb, void *pdata)
+{
+    return callback_register(g_nir_callbacks, name, func_cb, pdata);
+}
+
+int vbar_drv_face_nir_detection_callback_unregister(const char *name)
+{
+    return callback_unregister(g_nir_callbacks, name);
+}
+
+int vbar_drv_face_recognition_callback_register(const char *name, vbar_drv_face_callback func_cb, void *pdata)
+{
+    return callback_register(g_recg_callbacks, name, func_cb, pdata);
+}
+
+int vbar_drv_face_recognition_callback_unregister(const char *name)
+{
+    return callback_unregister(g_recg_callbacks, name);
+}
+
+// 已存在的用户覆盖特征值
+int vbar_drv_face_features_register(const char *userid, const uint8_t *feature)
+{
+    if (!userid || !feature)
+    {
+        return -1;
+    }
+    int ret = -1;
+    pthread_rwlock_wrlock(&g_db_lock);
+    for (int i = 0; i < g_db_count; i++)
+    {
+        if (strcmp(g_db[i].userid, userid) == 0)
+        {
+            memcpy(g_db[i].feature, feature, VBAR_DRV_FACE_FEATURE_SIZE);
+            ret = 0;
+            break;
+        }
+    }
+    if (ret != 0 && g_db && g_db_count < g_db_max)
+    {
+        snprintf(g_db[g_db_count].userid, VBAR_DRV_FACE_USERID_SIZE, "%s", userid);
+        memcpy(g_db[g_db_count].feature, feature, VBAR_DRV_FACE_FEATURE_SIZE);
+        g_db_count++;
+        ret = 0;
+    }
+    pthread_rwlock_unlock(&g_db_lock);
+    return ret;
+}
+
+int vbar_drv_face_features_unregister(const char *userid)
+{
+    int ret = -1;
+    pthread_rwlock_wrlock(&g_db_lock);
+    for (int i = 0; userid && i < g_db_count; i++)
+    {
+        if (strcmp(g_db[i].userid, userid) == 0)
+        {
+            g_db[i] = g_db[--g_db_count];
+            ret = 0;
+            break;
+        }
+    }
+    pthread_rwlock_unlock(&g_db_lock);
+    return ret;
+}
+
+int vbar_drv_face_features_update(void)
+{
+    return g_db ? 0 : -1;
+}
+
+int vbar_drv_face_features_clean(void)
+{
+    pthread_rwlock_wrlock(&g_db_lock);
+    g_db_count = 0;
+    pthread_rwlock_unlock(&g_db_lock);
+    return g_db ? 0 : -1;
+}
+
+int vbar_drv_face_feature_compare(const uint8_t *feature, struct vbar_drv_face_cmp_result *result)
+{
+    if (!feature || !result)
+    {
+        return -1;
+    }
+    memset(result, 0, sizeof(*result));
+    mock_sleep_us(mock_env_long("VBAR_MOCK_COMPARE_US", 0));
+
+    pthread_rwlock_rdlock(&g_db_lock);
+    int best = -1;
+    for (int i = 0; i < g_db_count; i++)
+    {
+        float score = feature_similarity(feature, g_db[i].feature);
+        if (best < 0 || score > result->score)
+        {
+            best = i;
+            result->score = score;
+        }
+    }
+    if (best >= 0)
+    {
+        snprintf(result->userid, sizeof(result->userid), "%s", g_db[best].userid);
+    }
+    pthread_rwlock_unlock(&g_db_lock);
+    return best >= 0 ? 0 : -1;
+}
@@ -0,0 +1,183 @@
+#include "vbar_mock.h"
+#include "../capturer/capturer.h"
+#include "../capturer/include/image_process.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// 只处理 NV12（连续内存）图像，与 mock_capturer 的输出一致
+
+static struct vbar_drv_image *image_create(uint32_t width, uint32_t height)
+{
+    struct vbar_drv_image *image = calloc(1, sizeof(*image) + sizeof(void *));
+    size_t size = (size_t)width * height * 3 / 2;
+    uint8_t *data = image ? malloc(size) : NULL;
+    if (!data)
+    {
+        free(image);
+        return NULL;
+    }
+    image->layout_type = VBAR_DRV_IMAGE_LAYOUT_CAPTURER;
+    image->width = width;
+    image->height = height;
+    image->widthbytes = 2;
+    image->data = data;
+    image->datalen = size;
+    return image;
+}
+
+static const uint8_t *image_luma(const struct vbar_drv_image *image)
+{
+    return image->layout_type == VBAR_DRV_IMAGE_LAYOUT_CAPTURER_PLANE ? image->mplane.addr[0] : image->data;
+}
+
+static const uint8_t *image_chroma(const struct vbar_drv_image *image)
+{
+    return image->layout_type == VBAR_DRV_IMAGE_LAYOUT_CAPTURER_PLANE ? image->mplane.addr[1] : image->data + image->width * image->height;
+}
+
+struct vbar_drv_image *vbar_drv_image_process_yuv420sp_cut(struct vbar_drv_image *in_image,
+                                                           uint32_t dest_x, uint32_t dest_y,
+                                                           uint32_t dest_width, uint32_t dest_height)
+{
+    if (!in_image || !image_luma(in_image))
+    {
+        return NULL;
+    }
+    // 与真实实现一样按偶数对齐，越界部分截掉
+    dest_x &= ~1u;
+    dest_y &= ~1u;
+    if (dest_x >= in_image->width || dest_y >= in_image->height)
+    {
+        return NULL;
+    }
+    if (dest_x + dest_width > in_image->width)
+    {
+        dest_width = in_image->width - dest_x;
+    }
+    if (dest_y + dest_height > in_image->height)
+    {
+        dest_height = in_image->height - dest_y;
+    }
+    dest_width &= ~1u;
+    dest_height &= ~1u;
+    if (!dest_width || !dest_height)
+    {
+        return NULL;
+    }
+    struct vbar_drv_image *out = image_create(dest_width, dest_height);
+    if (!out)
+    {
+        return NULL;
+    }
+    const uint8_t *luma = image_luma(in_image);
+    const uint8_t *chroma = image_chroma(in_image);
+    for (uint32_t y = 0; y < dest_height; y++)
+    {
+        memcpy(out->data + y * dest_width, luma + (dest_y + y) * in_image->width + dest_x, dest_width);
+    }
+    uint8_t *out_chroma = out->data + dest_width * dest_height;
+    for (uint32_t y = 0; y < dest_height / 2; y++)
+    {
+        memcpy(out_chroma + y * dest_width, chroma + (dest_y / 2 + y) * in_image->width + dest_x, dest_width);
+    }
+    out->timestamp = in_image->timestamp;
+    return out;
+}
+
+// 最近邻缩放，忽略滤波模式
+struct vbar_drv_image *vbar_drv_image_resize_resolution(const struct vbar_drv_image *src_image,
+                                                        int dst_width, int dst_height, enum vbar_drv_filter_mode mode)
+{
+    (void)mode;
+    if (!src_image || !image_luma(src_image) || dst_width <= 0 || dst_height <= 0)
+    {
+        return NULL;
+    }
+    dst_width &= ~1;
+    dst_height &= ~1;
+    struct vbar_drv_image *out = image_create(dst_width, dst_height);
+    if (!out)
+    {
+        return NULL;
+    }
+    const uint8_t *luma = image_luma(src_image);
+    const uint8_t *chroma = image_chroma(src_image);
+    uint8_t *out_chroma = out->data + dst_width * dst_height;
+    for (int y = 0; y < dst_height; y++)
+    {
+        uint32_t sy = (uint64_t)y * src_image->height / dst_height;
+        for (int x = 0; x < dst_width; x++)
+        {
+            uint32_t sx = (uint64_t)x * src_image->width / dst_width;
+            out->data[y * dst_width + x] = luma[sy * src_image->width + sx];
+        }
+    }
+    for (int y = 0; y < dst_height / 2; y++)
+    {
+        uint32_t sy = (uint64_t)y * (src_image->height / 2) / (dst_height / 2);
+        for (int x = 0; x < dst_width / 2; x++)
+        {
+            uint32_t sx = (uint64_t)x * (src_image->width / 2) / (dst_width / 2);
+            out_chroma[y * dst_width + x * 2] = chroma[sy * src_image->width + sx * 2];
+            out_chroma[y * dst_width + x * 2 + 1] = chroma[sy * src_image->width + sx * 2 + 1];
+        }
+    }
+    out->timestamp = src_image->timestamp;
+    return out;
+}
+
+/**
+ * 编码为灰度 PGM 代替 JPEG：按质量缩小亮度图，使输出大小随质量单调增长，
+ * 压缩率与设备上的 JPEG 大致相当（质量100约为原始亮度的30%），便于测试按字节目标调质量的逻辑
+ */
+int vbar_drv_image_process_image_to_picture_data(struct vbar_drv_image *image, enum image_type type, enum vbar_drv_picture_type save_type, int quality, uint8_t **pic_data, uint32_t *data_len)
+{
+    (void)type;
+    (void)save_type;
+    if (!image || !image_luma(image) || !pic_data || !data_len)
+    {
+        return -1;
+    }
+    mock_sleep_us(mock_env_long("VBAR_MOCK_ENCODE_US", 8000));
+
+    if (quality < 1)
+    {
+        quality = 1;
+    }
+    if (quality > 100)
+    {
+        quality = 100;
+    }
+    double ratio = 0.02 + 0.28 * quality / 100.0;
+    double scale = sqrt(ratio);
+    uint32_t width = image->width * scale;
+    uint32_t height = image->height * scale;
+    if (!width || !height)
+    {
+        width = height = 1;
+    }
+
+    char header[32];
+    int header_len = snprintf(header, sizeof(header), "P5\n%u %u\n255\n", width, height);
+    uint32_t len = header_len + width * height;
+    uint8_t *data = malloc(len);
+    if (!data)
+    {
+        return -1;
+    }
+    memcpy(data, header, header_len);
+    const uint8_t *luma = image_luma(image);
+    for (uint32_t y = 0; y < height; y++)
+    {
+        uint32_t sy = (uint64_t)y * image->height / height;
+        for (uint32_t x = 0; x < width; x++)
+        {
+            data[header_len + y * width + x] = luma[sy * image->width + (uint64_t)x * image->width / width];
+        }
+    }
+    *pic_data = data;
+    *data_len = len;
+    return 0;
+}
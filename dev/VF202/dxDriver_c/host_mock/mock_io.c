@@ -0,0 +1,305 @@
+#include "vbar_mock.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <drivers/gpio.h>
+#include <drivers/pwm.h>
+#include <drivers/display.h>
+#include <modules/channel.h>
+#include <common/spi.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+
+// IO 类驱动模拟（GPIO、PWM、屏幕、通信通道、SPI）：只在内存中记录状态，读回最近一次设置的值，
+// 使 gpio/pwm/display/channel/nfc wrapper 能在主机上加载和调用；GPIO按键、NFC模块由 wrapper 按设备路径
+// 动态加载，主机上加载失败即按不可用处理，不在此模拟
+
+#define MOCK_GPIO_MAX 256
+#define MOCK_PWM_MAX 16
+
+static pthread_mutex_t g_io_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static struct
+{
+    uint8_t requested;
+    uint8_t value;
+    uint32_t func;
+    uint32_t pull;
+    uint16_t strength;
+} g_gpio[MOCK_GPIO_MAX];
+
+static struct
+{
+    uint8_t requested;
+    uint8_t enabled;
+    uint32_t period_ns;
+    uint32_t duty_ns;
+} g_pwm[MOCK_PWM_MAX];
+
+static bool g_display_enable = true;
+static int g_display_backlight = 100;
+static enum vbar_drv_display_power_mode g_display_mode = VBAR_DRV_DISPLAY_POWER_MODE_NORMAL;
+
+/* GPIO */
+
+int vbar_drv_gpio_init(void)
+{
+    return 0;
+}
+
+void vbar_drv_gpio_deinit(void)
+{
+    pthread_mutex_lock(&g_io_mutex);
+    memset(g_gpio, 0, sizeof(g_gpio));
+    pthread_mutex_unlock(&g_io_mutex);
+}
+
+int vbar_drv_gpio_request(uint32_t gpio)
+{
+    if (gpio >= MOCK_GPIO_MAX)
+    {
+        return -EINVAL;
+    }
+    pthread_mutex_lock(&g_io_mutex);
+    g_gpio[gpio].requested = 1;
+    pthread_mutex_unlock(&g_io_mutex);
+    return 0;
+}
+
+void vbar_drv_gpio_free(uint32_t gpio)
+{
+    if (gpio >= MOCK_GPIO_MAX)
+    {
+        return;
+    }
+    pthread_mutex_lock(&g_io_mutex);
+    g_gpio[gpio].requested = 0;
+    pthread_mutex_unlock(&g_io_mutex);
+}
+
+void vbar_drv_gpio_set_func(uint32_t gpio, enum gpio_function func)
+{
+    if (gpio < MOCK_GPIO_MAX)
+    {
+        g_gpio[gpio].func = func;
+    }
+}
+
+void vbar_drv_gpio_set_pull_state(uint32_t gpio, uint32_t state)
+{
+    if (gpio < MOCK_GPIO_MAX)
+    {
+        g_gpio[gpio].pull = state;
+    }
+}
+
+int vbar_drv_gpio_get_pull_state(uint32_t gpio)
+{
+    return gpio < MOCK_GPIO_MAX ? (int)g_gpio[gpio].pull : -EINVAL;
+}
+
+void vbar_drv_gpio_set_value(uint32_t gpio, uint8_t value)
+{
+    if (gpio < MOCK_GPIO_MAX)
+    {
+        g_gpio[gpio].value = value ? 1 : 0;
+    }
+}
+
+int vbar_drv_gpio_get_value(uint32_t gpio)
+{
+    return gpio < MOCK_GPIO_MAX ? g_gpio[gpio].value : -EINVAL;
+}
+
+void vbar_drv_gpio_set_drive_strength(uint32_t gpio, uint16_t strength)
+{
+    if (gpio < MOCK_GPIO_MAX)
+    {
+        g_gpio[gpio].strength = strength;
+    }
+}
+
+uint16_t vbar_drv_gpio_get_drive_strength(uint32_t gpio)
+{
+    return gpio < MOCK_GPIO_MAX ? g_gpio[gpio].strength : 0;
+}
+
+/* PWM */
+
+int vbar_drv_pwm_request(uint32_t channel)
+{
+    if (channel >= MOCK_PWM_MAX)
+    {
+        return -EINVAL;
+    }
+    g_pwm[channel].requested = 1;
+    return 0;
+}
+
+int vbar_drv_pwm_free(uint32_t channel)
+{
+    if (channel >= MOCK_PWM_MAX)
+    {
+        return -EINVAL;
+    }
+    memset(&g_pwm[channel], 0, sizeof(g_pwm[channel]));
+    return 0;
+}
+
+int vbar_drv_pwm_enable(uint32_t channel, bool on)
+{
+    if (channel >= MOCK_PWM_MAX || !g_pwm[channel].requested)
+    {
+        return -EINVAL;
+    }
+    g_pwm[channel].enabled = on;
+    return 0;
+}
+
+int vbar_drv_pwm_set_period_by_channel(uint32_t channel, uint32_t period_ns)
+{
+    if (channel >= MOCK_PWM_MAX || !g_pwm[channel].requested)
+    {
+        return -EINVAL;
+    }
+    g_pwm[channel].period_ns = period_ns;
+    return 0;
+}
+
+int vbar_drv_pwm_set_duty_by_channel(uint32_t channel, uint32_t duty_ns)
+{
+    if (channel >= MOCK_PWM_MAX || !g_pwm[channel].requested || duty_ns > g_pwm[channel].period_ns)
+    {
+        return -EINVAL;
+    }
+    g_pwm[channel].duty_ns = duty_ns;
+    return 0;
+}
+
+/* 屏幕 */
+
+int vbar_drv_display_get_enable_status(bool *enable)
+{
+    *enable = g_display_enable;
+    return 0;
+}
+
+int vbar_drv_display_set_enable_status(bool enable)
+{
+    g_display_enable = enable;
+    return 0;
+}
+
+int vbar_drv_display_get_backlight(int *backlight)
+{
+    *backlight = g_display_backlight;
+    return 0;
+}
+
+int vbar_drv_display_set_backlight(int backlight)
+{
+    if (backlight < 0 || backlight > 100)
+    {
+        return -EINVAL;
+    }
+    g_display_backlight = backlight;
+    return 0;
+}
+
+int vbar_drv_display_get_power_mode(enum vbar_drv_display_power_mode *mode)
+{
+    *mode = g_display_mode;
+    return 0;
+}
+
+int vbar_drv_display_set_power_mode(enum vbar_drv_display_power_mode mode)
+{
+    g_display_mode = mode;
+    return 0;
+}
+
+/* 通信通道：发送的数据直接丢弃，接收始终超时 */
+
+static int mock_channel_send(struct vbar_m_channel_handle *channel, const unsigned char *buffer, size_t length)
+{
+    (void)channel;
+    (void)buffer;
+    return (int)length;
+}
+
+static int mock_channel_recv(struct vbar_m_channel_handle *channel, unsigned char *buffer, size_t size, int milliseconds)
+{
+    (void)channel;
+    (void)buffer;
+    (void)size;
+    if (milliseconds > 0)
+    {
+        mock_sleep_us((long)milliseconds * 1000);
+    }
+    return 0;
+}
+
+struct vbar_m_channel_handle *vbar_m_channel_open(int type, unsigned long arg)
+{
+    (void)arg;
+    struct vbar_m_channel_handle *channel = calloc(1, sizeof(*channel));
+    if (!channel)
+    {
+        return NULL;
+    }
+    channel->type = type;
+    channel->send = mock_channel_send;
+    channel->recv = mock_channel_recv;
+    return channel;
+}
+
+int vbar_m_channel_send(struct vbar_m_channel_handle *channel, const unsigned char *buffer, size_t length)
+{
+    return channel ? channel->send(channel, buffer, length) : -EINVAL;
+}
+
+int vbar_m_channel_recv(struct vbar_m_channel_handle *channel, unsigned char *buffer, size_t size, int milliseconds)
+{
+    return channel ? channel->recv(channel, buffer, size, milliseconds) : -EINVAL;
+}
+
+int vbar_m_channel_ioctl(struct vbar_m_channel_handle *channel, enum vbar_m_channel_ioc_set_cmd request, unsigned long arg)
+{
+    (void)request;
+    (void)arg;
+    return channel ? 0 : -EINVAL;
+}
+
+void vbar_m_channel_close(struct vbar_m_channel_handle *channel)
+{
+    free(channel);
+}
+
+/* SPI：主机上没有设备节点，打开失败 */
+
+int vbar_spi_open(const char *path, uint32_t speed_hz, uint8_t mode, uint8_t bits)
+{
+    (void)speed_hz;
+    (void)mode;
+    (void)bits;
+    printf("mock spi %s 不可用\n", path);
+    return -ENODEV;
+}
+
+void vbar_spi_close(int fd)
+{
+    (void)fd;
+}
+
+int vbar_spi_exchange(int fd, uint8_t bits, uint32_t speed, const uint8_t *tdata, uint8_t *rdata, uint32_t datalen)
+{
+    (void)fd;
+    (void)bits;
+    (void)speed;
+    (void)tdata;
+    (void)rdata;
+    (void)datalen;
+    return -ENODEV;
+}
@@ -0,0 +1,51 @@
+#ifndef VBAR_MOCK_H
+#define VBAR_MOCK_H
+
+#include <stdint.h>
+
+// x86 主机上模拟 vbar 驱动接口（人脸、取图、图像处理、音频，以及 GPIO、PWM、屏幕、通信通道等 IO 驱动），用于在设备外对各 wrapper 做吞吐、延时测试
+//
+// 行为由环境变量控制：
+//   VBAR_MOCK_FRAMES_DIR    录制帧目录，按设备节点名分子目录（如 video3/、video0/），每个文件一帧 NV12 原始数据，
+//                           按文件名顺序循环回放；未设置或目录为空时生成合成画面
+//   VBAR_MOCK_FPS           取图帧率，默认25
+//   VBAR_MOCK_FACE_PRESENT_MS / VBAR_MOCK_FACE_ABSENT_MS
+//                           合成场景中有人、无人的交替时长，默认3000/2000；有人时画面中有移动的人脸方块
+//   VBAR_MOCK_FACE_USERS    合成场景轮流出现的人数（每人一组固定特征值），默认3
+//   VBAR_MOCK_DETECT_US     每帧人脸检测耗时，默认15000
+//   VBAR_MOCK_RECOGNIZE_US  提取特征值耗时，默认60000
+//   VBAR_MOCK_COMPARE_US    每次特征比对的附加耗时（另有按特征库大小线性增长的真实比对开销），默认0
+//   VBAR_MOCK_ENCODE_US     每次图片编码耗时，默认8000
+//   VBAR_MOCK_AUDIO_MS      无法从文件得到时长时的播放时长，默认500
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint64_t mock_now_us(void);
+void mock_sleep_us(long us);
+long mock_env_long(const char *name, long def);
+const char *mock_env_str(const char *name, const char *def);
+
+/**
+ * @brief 合成场景：按时间计算当前是否有人以及人脸位置，取图画面和人脸检测共用，保证两者一致
+ *
+ * @param now_us 单调时钟时间
+ * @param width 画面宽
+ * @param height 画面高
+ * @param identity 输出，当前人员编号
+ * @param track_id 输出，本次出现的跟踪ID，每次有人进入时递增
+ * @param rect 输出，人脸坐标 [左上x, 左上y, 右下x, 右下y]
+ *
+ * @return 1有人，0无人
+ */
+int mock_scene_face(uint64_t now_us, uint32_t width, uint32_t height, int *identity, int *track_id, int rect[4]);
+
+// 生成合成场景中人员 identity 的特征值（1024字节），可用于预先注册特征库
+void mock_face_make_feature(int identity, uint32_t noise_seed, uint8_t *feature);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VBAR_MOCK_H
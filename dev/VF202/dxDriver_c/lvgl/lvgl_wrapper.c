@@ -0,0 +1,2979 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <dlfcn.h>
+#include <lvgl/lvgl.h>
+#include <lvgl/src/draw/sw/lv_draw_sw.h>
+#include "./lvgl_wrapper.h"
+#include "../face/face_wrapper.h"
+
+// LVGL接口从lvgljs进程中按名字查找，类型取自lvgl.h
+#define LV_SYM(name) static __typeof__(&name) p_##name = NULL
+#define LV_LOAD(name) (p_##name = (__typeof__(&name))dlsym(RTLD_DEFAULT, #name))
+
+LV_SYM(lv_img_cache_set_size);
+LV_SYM(lv_img_cache_invalidate_src);
+
+LV_SYM(lv_disp_get_default);
+LV_SYM(lv_disp_get_layer_top);
+LV_SYM(lv_obj_create);
+LV_SYM(lv_obj_del);
+LV_SYM(lv_obj_remove_style);
+LV_SYM(lv_obj_add_flag);
+LV_SYM(lv_obj_clear_flag);
+LV_SYM(lv_obj_set_pos);
+LV_SYM(lv_obj_set_size);
+LV_SYM(lv_obj_align_to);
+LV_SYM(lv_obj_set_style_text_color);
+LV_SYM(lv_obj_set_style_text_font);
+LV_SYM(lv_img_create);
+LV_SYM(lv_img_set_src);
+LV_SYM(lv_img_set_zoom);
+LV_SYM(lv_label_create);
+LV_SYM(lv_label_set_text);
+LV_SYM(lv_timer_create);
+LV_SYM(lv_timer_del);
+LV_SYM(lv_ft_font_init);
+LV_SYM(lv_ft_font_destroy);
+LV_SYM(lv_freetype_init);
+LV_SYM(lv_freetype_destroy);
+LV_SYM(lv_font_get_glyph_dsc);
+LV_SYM(lv_font_get_glyph_bitmap);
+LV_SYM(lv_font_get_glyph_dsc_fmt_txt);
+LV_SYM(lv_disp_get_scr_act);
+LV_SYM(lv_disp_get_layer_sys);
+LV_SYM(lv_obj_get_child);
+LV_SYM(lv_obj_get_child_cnt);
+LV_SYM(lv_obj_get_style_prop);
+
+// lv_obj_remove_style_all 是头文件中的内联函数，引擎不导出，这里按同样方式实现
+static void obj_remove_style_all(lv_obj_t *obj)
+{
+    p_lv_obj_remove_style(obj, NULL, LV_PART_ANY | LV_STATE_ANY);
+}
+
+static bool g_img_cache_loaded = false;
+static bool g_img_cache_ok = false;
+
+static bool lvgl_load_img_cache_symbols()
+{
+    if (!g_img_cache_loaded)
+    {
+        g_img_cache_loaded = true;
+        g_img_cache_ok = LV_LOAD(lv_img_cache_set_size) && LV_LOAD(lv_img_cache_invalidate_src);
+        if (!g_img_cache_ok)
+        {
+            printf("LVGL图片缓存接口未导出\n");
+        }
+    }
+    return g_img_cache_ok;
+}
+
+int lvgl_img_cache_set_size(uint16_t size)
+{
+    if (!lvgl_load_img_cache_symbols() || size == 0)
+    {
+        return -1;
+    }
+    // 必须在LVGL线程（JS主线程）中调用
+    p_lv_img_cache_set_size(size);
+    printf("LVGL图片缓存槽位数: %d\n", size);
+    return 0;
+}
+
+int lvgl_img_cache_invalidate(const void *src)
+{
+    if (!lvgl_load_img_cache_symbols())
+    {
+        return -1;
+    }
+    p_lv_img_cache_invalidate_src(src);
+    return 0;
+}
+
+// ---------------- 字体管理 ----------------
+
+// 进程内同一 (路径, 字号, 风格) 只创建一个 FreeType 字体，按引用计数释放
+#define FONT_MAX 32
+#define FONT_PATH_MAX 256
+
+struct font_entry_t
+{
+    char path[FONT_PATH_MAX];
+    int size;
+    int style;
+    int refs;
+    bool pinned; // 预热过的字体常驻，保持其字形缓存有效
+    lv_ft_info_t info;
+};
+static struct font_entry_t g_fonts[FONT_MAX];
+
+static bool lvgl_load_font_symbols()
+{
+    static bool loaded = false;
+    static bool ok = false;
+    if (!loaded)
+    {
+        loaded = true;
+        ok = LV_LOAD(lv_ft_font_init) && LV_LOAD(lv_ft_font_destroy);
+        if (!ok)
+        {
+            printf("LVGL FreeType接口未导出\n");
+        }
+    }
+    return ok;
+}
+
+// 解析 "路径#字号#风格"，字号、风格可省略（默认16、常规）
+static int font_parse_spec(const char *spec, char *path, int *size, int *style)
+{
+    if (!spec || !spec[0])
+    {
+        return -1;
+    }
+    const char *sep = strchr(spec, '#');
+    size_t len = sep ? (size_t)(sep - spec) : strlen(spec);
+    if (len == 0 || len >= FONT_PATH_MAX)
+    {
+        return -1;
+    }
+    memcpy(path, spec, len);
+    path[len] = '\0';
+    *size = 16;
+    *style = FT_FONT_STYLE_NORMAL;
+    if (sep)
+    {
+        *size = atoi(sep + 1);
+        const char *sep2 = strchr(sep + 1, '#');
+        if (sep2)
+        {
+            *style = atoi(sep2 + 1);
+        }
+    }
+    return *size > 0 ? 0 : -1;
+}
+
+static struct font_entry_t *font_acquire(const char *spec)
+{
+    char path[FONT_PATH_MAX];
+    int size, style;
+    if (!lvgl_load_font_symbols() || font_parse_spec(spec, path, &size, &style) != 0)
+    {
+        return NULL;
+    }
+    struct font_entry_t *slot = NULL;
+    for (int i = 0; i < FONT_MAX; i++)
+    {
+        struct font_entry_t *entry = &g_fonts[i];
+        if (entry->info.font && entry->size == size && entry->style == style && strcmp(entry->path, path) == 0)
+        {
+            entry->refs++;
+            return entry;
+        }
+        if (!entry->info.font && !slot)
+        {
+            slot = entry;
+        }
+    }
+    if (!slot)
+    {
+        printf("字体数超过上限%d: %s\n", FONT_MAX, spec);
+        return NULL;
+    }
+
+    memset(slot, 0, sizeof(*slot));
+    strcpy(slot->path, path);
+    slot->size = size;
+    slot->style = style;
+    // FreeType按文件名缓存字体，文件名在字体销毁前必须保持有效，这里指向表项内的路径
+    slot->info.name = slot->path;
+    slot->info.weight = size;
+    slot->info.style = style;
+    if (!p_lv_ft_font_init(&slot->info))
+    {
+        printf("字体加载失败: %s\n", spec);
+        memset(slot, 0, sizeof(*slot));
+        return NULL;
+    }
+    slot->refs = 1;
+    return slot;
+}
+
+static void font_release_entry(struct font_entry_t *entry)
+{
+    if (--entry->refs > 0 || entry->pinned)
+    {
+        return;
+    }
+    p_lv_ft_font_destroy(entry->info.font);
+    memset(entry, 0, sizeof(*entry));
+}
+
+// 对象树中是否有对象在用内置位图字体以外的字体（引擎已通过样式创建了FreeType字体）
+static bool font_tree_has_engine_font(lv_obj_t *obj)
+{
+    const lv_font_t *font = p_lv_obj_get_style_prop(obj, LV_PART_MAIN, LV_STYLE_TEXT_FONT).ptr;
+    if (font && font->get_glyph_dsc != p_lv_font_get_glyph_dsc_fmt_txt)
+    {
+        return true;
+    }
+    uint32_t count = p_lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (font_tree_has_engine_font(p_lv_obj_get_child(obj, i)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 引擎是否已创建字体；重建FreeType缓存会使这些字体失效，无法检查时按已创建处理
+static bool font_engine_has_fonts()
+{
+    if (!LV_LOAD(lv_disp_get_default) || !LV_LOAD(lv_disp_get_layer_top) || !LV_LOAD(lv_disp_get_layer_sys) ||
+        !LV_LOAD(lv_obj_get_child) || !LV_LOAD(lv_obj_get_child_cnt) || !LV_LOAD(lv_obj_get_style_prop) ||
+        !LV_LOAD(lv_font_get_glyph_dsc_fmt_txt))
+    {
+        return true;
+    }
+    lv_disp_t *disp = p_lv_disp_get_default();
+    if (!disp)
+    {
+        return true;
+    }
+    for (uint32_t i = 0; i < disp->screen_cnt; i++)
+    {
+        if (font_tree_has_engine_font(disp->screens[i]))
+        {
+            return true;
+        }
+    }
+    return font_tree_has_engine_font(p_lv_disp_get_layer_top(disp)) || font_tree_has_engine_font(p_lv_disp_get_layer_sys(disp));
+}
+
+int lvgl_font_cache_init(uint16_t max_faces, uint16_t max_sizes, uint32_t max_bytes)
+{
+    if (!LV_LOAD(lv_freetype_init) || !LV_LOAD(lv_freetype_destroy))
+    {
+        printf("LVGL FreeType接口未导出\n");
+        return -1;
+    }
+    for (int i = 0; i < FONT_MAX; i++)
+    {
+        if (g_fonts[i].info.font)
+        {
+            printf("已有字体，不能再修改字形缓存\n");
+            return -1;
+        }
+    }
+    if (font_engine_has_fonts())
+    {
+        printf("界面已在使用字体，不能再修改字形缓存\n");
+        return -1;
+    }
+    // 重建 FreeType 缓存管理器，字形缓存按最近最少使用淘汰，总大小不超过 max_bytes
+    p_lv_freetype_destroy();
+    if (!p_lv_freetype_init(max_faces, max_sizes, max_bytes))
+    {
+        printf("FreeType初始化失败\n");
+        return -1;
+    }
+    printf("FreeType字形缓存: %u字节\n", max_bytes);
+    return 0;
+}
+
+void *lvgl_font_get(const char *spec)
+{
+    struct font_entry_t *entry = font_acquire(spec);
+    return entry ? entry->info.font : NULL;
+}
+
+void lvgl_font_release(void *font)
+{
+    if (!font)
+    {
+        return;
+    }
+    for (int i = 0; i < FONT_MAX; i++)
+    {
+        if (g_fonts[i].info.font == font)
+        {
+            font_release_entry(&g_fonts[i]);
+            return;
+        }
+    }
+}
+
+int lvgl_font_prewarm(const char *spec, const char *text)
+{
+    if (!LV_LOAD(lv_font_get_glyph_dsc) || !LV_LOAD(lv_font_get_glyph_bitmap))
+    {
+        return -1;
+    }
+    struct font_entry_t *entry = font_acquire(spec);
+    if (!entry)
+    {
+        return -1;
+    }
+    // 预热的字体常驻：同一文件、字号的字体共用 FreeType 字形缓存，引擎按样式创建的字体也能命中
+    entry->pinned = true;
+    entry->refs--;
+
+    int count = 0;
+    const unsigned char *p = (const unsigned char *)(text ? text : "");
+    while (*p)
+    {
+        // UTF-8 解码，非法字节跳过
+        uint32_t letter = *p;
+        int extra = letter < 0x80 ? 0 : (letter & 0xE0) == 0xC0 ? 1 : (letter & 0xF0) == 0xE0 ? 2 : (letter & 0xF8) == 0xF0 ? 3 : -1;
+        if (extra < 0)
+        {
+            p++;
+            continue;
+        }
+        letter &= extra ? (0x3F >> extra) : 0x7F;
+        p++;
+        for (int i = 0; i < extra && (*p & 0xC0) == 0x80; i++, p++)
+        {
+            letter = (letter << 6) | (*p & 0x3F);
+        }
+        lv_font_glyph_dsc_t dsc;
+        if (p_lv_font_get_glyph_dsc(entry->info.font, &dsc, letter, 0) && p_lv_font_get_glyph_bitmap(entry->info.font, letter))
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+int lvgl_font_count(void)
+{
+    int count = 0;
+    for (int i = 0; i < FONT_MAX; i++)
+    {
+        count += g_fonts[i].info.font != NULL;
+    }
+    return count;
+}
+
+// ---------------- 人脸跟踪框叠加层 ----------------
+
+#define FACE_WRAPPER_PATH "/os/driver/libface_wrapper.so"
+// 刷新定时器周期，小于一个显示帧
+#define OVERLAY_TIMER_PERIOD 10
+// 超过该时间没有新的检测结果则隐藏跟踪框并复位为白色，与JS侧原逻辑一致
+#define OVERLAY_HIDE_TIMEOUT 400
+// 跟踪框图片按人脸宽度缩放：缩放比 = 人脸宽度 / 图片高度 * 1.2，中心下移20像素
+#define OVERLAY_BOX_SCALE 1.2f
+#define OVERLAY_BOX_OFFSET_Y 20
+// lv_img_header_t 中宽高为11位
+#define OVERLAY_IMG_MAX_SIZE 2047
+
+// 跟踪框图片（PNG数据由JS传入，LVGL的PNG解码器解码，经图片缓存只解码一次）
+struct overlay_image_t
+{
+    lv_img_dsc_t dsc;
+    uint8_t *data;
+};
+
+struct overlay_t
+{
+    bool inited;
+    int mode;
+    int state;
+    __typeof__(&face_get_track_snapshot) get_track;
+    lv_obj_t *box;
+    lv_obj_t *label;
+    lv_timer_t *timer;
+    lv_font_t *font;
+    struct overlay_image_t images[OVERLAY_STATE_NUM];
+    unsigned int last_seq;
+    long long last_update_ms;
+    // 跟踪框因超时隐藏的次数，JS据此复位识别状态
+    unsigned int lost;
+    bool visible;
+    bool label_visible;
+};
+static struct overlay_t g_overlay = {0};
+
+static long long overlay_now_ms()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static bool lvgl_load_overlay_symbols()
+{
+    return LV_LOAD(lv_disp_get_default) && LV_LOAD(lv_disp_get_layer_top) &&
+           LV_LOAD(lv_obj_del) && LV_LOAD(lv_obj_add_flag) && LV_LOAD(lv_obj_clear_flag) &&
+           LV_LOAD(lv_obj_set_pos) && LV_LOAD(lv_obj_align_to) &&
+           LV_LOAD(lv_obj_set_style_text_color) && LV_LOAD(lv_obj_set_style_text_font) &&
+           LV_LOAD(lv_img_create) && LV_LOAD(lv_img_set_src) && LV_LOAD(lv_img_set_zoom) &&
+           LV_LOAD(lv_label_create) && LV_LOAD(lv_label_set_text) &&
+           LV_LOAD(lv_timer_create) && LV_LOAD(lv_timer_del);
+}
+
+static void overlay_set_visible(bool visible)
+{
+    if (g_overlay.visible == visible)
+    {
+        return;
+    }
+    g_overlay.visible = visible;
+    if (visible)
+    {
+        p_lv_obj_clear_flag(g_overlay.box, LV_OBJ_FLAG_HIDDEN);
+        if (g_overlay.label_visible)
+        {
+            p_lv_obj_clear_flag(g_overlay.label, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+    else
+    {
+        p_lv_obj_add_flag(g_overlay.box, LV_OBJ_FLAG_HIDDEN);
+        p_lv_obj_add_flag(g_overlay.label, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+static void overlay_apply_state()
+{
+    struct overlay_image_t *image = &g_overlay.images[g_overlay.state];
+    // 图片未设置时跟踪框不显示内容
+    p_lv_img_set_src(g_overlay.box, image->data ? &image->dsc : NULL);
+}
+
+static void overlay_hide_label()
+{
+    g_overlay.label_visible = false;
+    p_lv_obj_add_flag(g_overlay.label, LV_OBJ_FLAG_HIDDEN);
+}
+
+// LVGL线程中运行，直接读取检测回调写入的跟踪框
+static void overlay_timer_cb(lv_timer_t *timer)
+{
+    (void)timer;
+    if (g_overlay.mode == 0)
+    {
+        return;
+    }
+
+    struct track_t track;
+    unsigned int seq = g_overlay.get_track(&track);
+    long long now = overlay_now_ms();
+    if (seq == g_overlay.last_seq)
+    {
+        if (g_overlay.visible && now - g_overlay.last_update_ms > OVERLAY_HIDE_TIMEOUT)
+        {
+            // 人脸离开：隐藏并复位为白色跟踪框、清除姓名，下次出现时不闪现上一次的结果
+            overlay_set_visible(false);
+            overlay_hide_label();
+            if (g_overlay.state != OVERLAY_STATE_IDLE)
+            {
+                g_overlay.state = OVERLAY_STATE_IDLE;
+                overlay_apply_state();
+            }
+            g_overlay.lost++;
+        }
+        return;
+    }
+    g_overlay.last_seq = seq;
+    g_overlay.last_update_ms = now;
+
+    const lv_img_header_t *header = &g_overlay.images[g_overlay.state].dsc.header;
+    if (header->w == 0 || header->h == 0)
+    {
+        return;
+    }
+    int width = track.x2 - track.x1;
+    int center_x = track.x1 + width / 2;
+    int center_y = track.y1 + (track.y2 - track.y1) / 2 + OVERLAY_BOX_OFFSET_Y;
+
+    // 缩放以图片中心为轴，位置按原始大小居中；位置和缩放未变化时LVGL不会重绘
+    p_lv_obj_set_pos(g_overlay.box, center_x - header->w / 2, center_y - header->h / 2);
+    p_lv_img_set_zoom(g_overlay.box, (uint16_t)(LV_IMG_ZOOM_NONE * width * OVERLAY_BOX_SCALE / header->h));
+    if (g_overlay.label_visible)
+    {
+        p_lv_obj_align_to(g_overlay.label, g_overlay.box, LV_ALIGN_CENTER, 0, 0);
+    }
+    overlay_set_visible(true);
+}
+
+static void overlay_font_destroy()
+{
+    lvgl_font_release(g_overlay.font);
+    g_overlay.font = NULL;
+}
+
+static void overlay_image_free(struct overlay_image_t *image)
+{
+    if (!image->data)
+    {
+        return;
+    }
+    // 解码结果以数据描述符地址为键缓存，释放前先移出缓存
+    if (lvgl_load_img_cache_symbols())
+    {
+        p_lv_img_cache_invalidate_src(&image->dsc);
+    }
+    free(image->data);
+    memset(image, 0, sizeof(*image));
+}
+
+int lvgl_overlay_init(void)
+{
+    if (g_overlay.inited)
+    {
+        return 0;
+    }
+    if (!lvgl_load_overlay_symbols())
+    {
+        printf("LVGL叠加层接口未导出\n");
+        return -1;
+    }
+
+    // 人脸模块已由JS加载，这里只取句柄不重复加载
+    void *face_lib = dlopen(FACE_WRAPPER_PATH, RTLD_NOW | RTLD_NOLOAD);
+    if (!face_lib)
+    {
+        printf("人脸模块未加载: %s\n", dlerror());
+        return -1;
+    }
+    g_overlay.get_track = (__typeof__(&face_get_track_snapshot))dlsym(face_lib, "face_get_track_snapshot");
+    dlclose(face_lib);
+    if (!g_overlay.get_track)
+    {
+        printf("人脸模块不支持跟踪框快照\n");
+        return -1;
+    }
+
+    lv_obj_t *layer = p_lv_disp_get_layer_top(p_lv_disp_get_default());
+
+    g_overlay.box = p_lv_img_create(layer);
+    p_lv_obj_clear_flag(g_overlay.box, LV_OBJ_FLAG_CLICKABLE);
+    p_lv_obj_add_flag(g_overlay.box, LV_OBJ_FLAG_HIDDEN);
+
+    g_overlay.label = p_lv_label_create(layer);
+    p_lv_obj_set_style_text_color(g_overlay.label, lv_color_hex(0xFFFFFF), 0);
+    p_lv_label_set_text(g_overlay.label, "");
+    p_lv_obj_add_flag(g_overlay.label, LV_OBJ_FLAG_HIDDEN);
+
+    g_overlay.timer = p_lv_timer_create(overlay_timer_cb, OVERLAY_TIMER_PERIOD, NULL);
+    g_overlay.last_seq = g_overlay.get_track(&(struct track_t){0});
+    g_overlay.state = OVERLAY_STATE_IDLE;
+    g_overlay.visible = false;
+    g_overlay.inited = true;
+    return 0;
+}
+
+void lvgl_overlay_deinit(void)
+{
+    if (!g_overlay.inited)
+    {
+        return;
+    }
+    p_lv_timer_del(g_overlay.timer);
+    p_lv_obj_del(g_overlay.label);
+    p_lv_obj_del(g_overlay.box);
+    overlay_font_destroy();
+    for (int i = 0; i < OVERLAY_STATE_NUM; i++)
+    {
+        overlay_image_free(&g_overlay.images[i]);
+    }
+    memset(&g_overlay, 0, sizeof(g_overlay));
+}
+
+int lvgl_overlay_set_mode(int mode)
+{
+    if (!g_overlay.inited)
+    {
+        return -1;
+    }
+    g_overlay.mode = mode;
+    if (mode == 0)
+    {
+        overlay_set_visible(false);
+    }
+    return 0;
+}
+
+// PNG文件头：8字节签名后是IHDR块，宽高为大端32位整数
+static bool overlay_png_size(const uint8_t *data, uint32_t size, uint32_t *w, uint32_t *h)
+{
+    static const uint8_t sig[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    if (size < 24 || memcmp(data, sig, sizeof(sig)) != 0 || memcmp(data + 12, "IHDR", 4) != 0)
+    {
+        return false;
+    }
+    *w = (uint32_t)data[16] << 24 | (uint32_t)data[17] << 16 | (uint32_t)data[18] << 8 | data[19];
+    *h = (uint32_t)data[20] << 24 | (uint32_t)data[21] << 16 | (uint32_t)data[22] << 8 | data[23];
+    return *w > 0 && *w <= OVERLAY_IMG_MAX_SIZE && *h > 0 && *h <= OVERLAY_IMG_MAX_SIZE;
+}
+
+int lvgl_overlay_set_image(int state, const uint8_t *data, uint32_t size)
+{
+    if (!g_overlay.inited || state < 0 || state >= OVERLAY_STATE_NUM || !data)
+    {
+        return -1;
+    }
+    uint32_t w, h;
+    if (!overlay_png_size(data, size, &w, &h))
+    {
+        printf("跟踪框图片不是PNG\n");
+        return -1;
+    }
+    uint8_t *copy = malloc(size);
+    if (!copy)
+    {
+        return -1;
+    }
+    memcpy(copy, data, size);
+
+    struct overlay_image_t *image = &g_overlay.images[state];
+    if (state == g_overlay.state)
+    {
+        // 先解除引用再释放旧数据
+        p_lv_img_set_src(g_overlay.box, NULL);
+    }
+    overlay_image_free(image);
+    image->data = copy;
+    image->dsc.header.always_zero = 0;
+    image->dsc.header.cf = LV_IMG_CF_RAW_ALPHA;
+    image->dsc.header.w = w;
+    image->dsc.header.h = h;
+    image->dsc.data_size = size;
+    image->dsc.data = copy;
+    if (state == g_overlay.state)
+    {
+        overlay_apply_state();
+    }
+    return 0;
+}
+
+int lvgl_overlay_set_state(int state)
+{
+    if (!g_overlay.inited || state < 0 || state >= OVERLAY_STATE_NUM)
+    {
+        return -1;
+    }
+    if (g_overlay.state != state)
+    {
+        g_overlay.state = state;
+        overlay_apply_state();
+    }
+    return 0;
+}
+
+unsigned int lvgl_overlay_lost_count(void)
+{
+    return g_overlay.lost;
+}
+
+int lvgl_overlay_set_label(const char *text)
+{
+    if (!g_overlay.inited)
+    {
+        return -1;
+    }
+    if (!text || !text[0])
+    {
+        overlay_hide_label();
+        return 0;
+    }
+    g_overlay.label_visible = true;
+    p_lv_label_set_text(g_overlay.label, text);
+    p_lv_obj_align_to(g_overlay.label, g_overlay.box, LV_ALIGN_CENTER, 0, 0);
+    if (g_overlay.visible)
+    {
+        p_lv_obj_clear_flag(g_overlay.label, LV_OBJ_FLAG_HIDDEN);
+    }
+    return 0;
+}
+
+int lvgl_overlay_set_font(const char *path, int size)
+{
+    if (!g_overlay.inited)
+    {
+        return -1;
+    }
+    char spec[FONT_PATH_MAX + 16];
+    snprintf(spec, sizeof(spec), "%s#%d#%d", path, size, FT_FONT_STYLE_NORMAL);
+    lv_font_t *font = lvgl_font_get(spec);
+    if (!font)
+    {
+        return -1;
+    }
+
+    p_lv_obj_set_style_text_font(g_overlay.label, font, 0);
+    overlay_font_destroy();
+    g_overlay.font = font;
+    return 0;
+}
+
+// ---------------- 虚拟列表 ----------------
+
+// 固定数量的行对象循环复用：第 index 行总是绑定到 rows[index % pool]，滚动一行只重绑一个行对象；
+// 数据按页由 JS 提供，原生侧只缓存最近使用的几页文本
+#define VLIST_MAX 4
+#define VLIST_POOL_MAX 48
+#define VLIST_COLS_MAX 6
+#define VLIST_CACHE_PAGES 8
+#define VLIST_REQ_MAX 4
+#define VLIST_PLACEHOLDER "..."
+
+struct vlist_page_t
+{
+    int page; // -1表示空槽
+    unsigned int used;
+    int count;
+    char *text;         // 行以'\n'分隔、列以'\t'分隔，存入后分隔符替换为'\0'
+    const char **cells; // count * cols 个单元格指针，指向 text 内
+};
+
+struct vlist_row_t
+{
+    lv_obj_t *obj;
+    lv_obj_t *cells[VLIST_COLS_MAX];
+    int index; // 当前绑定的记录序号，-1表示未绑定
+    bool loaded;
+};
+
+struct vlist_req_t
+{
+    int page;
+    bool taken; // 已被 JS 取走，等待数据
+};
+
+struct vlist_t
+{
+    bool used;
+    lv_obj_t *cont;
+    lv_obj_t *spacer; // 撑开滚动区域高度
+    struct vlist_row_t rows[VLIST_POOL_MAX];
+    int pool;
+    int cols;
+    int col_x[VLIST_COLS_MAX];
+    int col_w[VLIST_COLS_MAX];
+    int row_h;
+    int page_size;
+    int overscan;
+    int total;
+    lv_color_t bg_even;
+    lv_color_t bg_odd;
+    lv_opa_t bg_opa;
+    lv_font_t *font;
+    struct vlist_page_t pages[VLIST_CACHE_PAGES];
+    unsigned int tick;
+    struct vlist_req_t reqs[VLIST_REQ_MAX];
+    int req_count;
+    int clicked;
+};
+static struct vlist_t g_vlists[VLIST_MAX];
+
+LV_SYM(lv_obj_add_event_cb);
+LV_SYM(lv_event_get_user_data);
+LV_SYM(lv_obj_get_scroll_y);
+LV_SYM(lv_obj_scroll_to_y);
+LV_SYM(lv_obj_set_scroll_dir);
+LV_SYM(lv_obj_set_y);
+LV_SYM(lv_obj_align);
+LV_SYM(lv_obj_move_to_index);
+LV_SYM(lv_obj_set_style_bg_color);
+LV_SYM(lv_obj_set_style_bg_opa);
+LV_SYM(lv_label_set_long_mode);
+
+static bool lvgl_load_vlist_symbols()
+{
+    static bool loaded = false;
+    static bool ok = false;
+    if (!loaded)
+    {
+        loaded = true;
+        ok = LV_LOAD(lv_disp_get_default) && LV_LOAD(lv_disp_get_scr_act) &&
+             LV_LOAD(lv_obj_create) && LV_LOAD(lv_obj_del) && LV_LOAD(lv_obj_remove_style) &&
+             LV_LOAD(lv_obj_add_flag) && LV_LOAD(lv_obj_clear_flag) &&
+             LV_LOAD(lv_obj_set_pos) && LV_LOAD(lv_obj_set_size) && LV_LOAD(lv_obj_set_y) && LV_LOAD(lv_obj_align) &&
+             LV_LOAD(lv_obj_move_to_index) && LV_LOAD(lv_obj_add_event_cb) && LV_LOAD(lv_event_get_user_data) &&
+             LV_LOAD(lv_obj_get_scroll_y) && LV_LOAD(lv_obj_scroll_to_y) && LV_LOAD(lv_obj_set_scroll_dir) &&
+             LV_LOAD(lv_obj_set_style_bg_color) && LV_LOAD(lv_obj_set_style_bg_opa) &&
+             LV_LOAD(lv_obj_set_style_text_color) && LV_LOAD(lv_obj_set_style_text_font) &&
+             LV_LOAD(lv_label_create) && LV_LOAD(lv_label_set_text) && LV_LOAD(lv_label_set_long_mode);
+        if (!ok)
+        {
+            printf("LVGL虚拟列表接口未导出\n");
+        }
+    }
+    return ok;
+}
+
+static struct vlist_t *vlist_get(int id)
+{
+    if (id < 0 || id >= VLIST_MAX || !g_vlists[id].used)
+    {
+        return NULL;
+    }
+    return &g_vlists[id];
+}
+
+static void vlist_page_free(struct vlist_page_t *page)
+{
+    free(page->text);
+    free(page->cells);
+    memset(page, 0, sizeof(*page));
+    page->page = -1;
+}
+
+static void vlist_cache_clear(struct vlist_t *vl)
+{
+    for (int i = 0; i < VLIST_CACHE_PAGES; i++)
+    {
+        vlist_page_free(&vl->pages[i]);
+    }
+    vl->req_count = 0;
+}
+
+static struct vlist_page_t *vlist_page_find(struct vlist_t *vl, int page)
+{
+    for (int i = 0; i < VLIST_CACHE_PAGES; i++)
+    {
+        if (vl->pages[i].page == page)
+        {
+            vl->pages[i].used = ++vl->tick;
+            return &vl->pages[i];
+        }
+    }
+    return NULL;
+}
+
+// 缺页登记到请求队列，已登记的不重复；队列满时顶替最早一个尚未取走的请求（多半已滚出可见范围）
+static void vlist_request(struct vlist_t *vl, int page)
+{
+    for (int i = 0; i < vl->req_count; i++)
+    {
+        if (vl->reqs[i].page == page)
+        {
+            return;
+        }
+    }
+    if (vl->req_count < VLIST_REQ_MAX)
+    {
+        vl->reqs[vl->req_count++] = (struct vlist_req_t){.page = page, .taken = false};
+        return;
+    }
+    for (int i = 0; i < vl->req_count; i++)
+    {
+        if (!vl->reqs[i].taken)
+        {
+            memmove(&vl->reqs[i], &vl->reqs[i + 1], (vl->req_count - i - 1) * sizeof(vl->reqs[0]));
+            vl->reqs[vl->req_count - 1] = (struct vlist_req_t){.page = page, .taken = false};
+            return;
+        }
+    }
+}
+
+static void vlist_bind(struct vlist_t *vl, struct vlist_row_t *row, int index)
+{
+    struct vlist_page_t *page = vlist_page_find(vl, index / vl->page_size);
+    int offset = index % vl->page_size;
+    bool loaded = page && offset < page->count;
+    // 缺页时每次都登记请求（已登记的不重复），取数失败撤销后再次布局时重新请求
+    if (!loaded)
+    {
+        vlist_request(vl, index / vl->page_size);
+    }
+    if (row->index == index && row->loaded == loaded)
+    {
+        return;
+    }
+    if (row->index != index)
+    {
+        p_lv_obj_set_y(row->obj, index * vl->row_h);
+        p_lv_obj_set_style_bg_color(row->obj, index % 2 ? vl->bg_odd : vl->bg_even, 0);
+        if (row->index < 0)
+        {
+            p_lv_obj_clear_flag(row->obj, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+    for (int c = 0; c < vl->cols; c++)
+    {
+        const char *text = loaded ? page->cells[offset * vl->cols + c] : (c == 0 ? VLIST_PLACEHOLDER : "");
+        p_lv_label_set_text(row->cells[c], text);
+    }
+    row->index = index;
+    row->loaded = loaded;
+}
+
+// 根据滚动位置计算可见范围（含上下预留行），只重绑序号发生变化或数据刚到达的行
+static void vlist_layout(struct vlist_t *vl)
+{
+    int first = p_lv_obj_get_scroll_y(vl->cont) / vl->row_h - vl->overscan;
+    if (first > vl->total - vl->pool)
+    {
+        first = vl->total - vl->pool;
+    }
+    if (first < 0)
+    {
+        first = 0;
+    }
+    int end = first + vl->pool < vl->total ? first + vl->pool : vl->total;
+    for (int index = first; index < end; index++)
+    {
+        vlist_bind(vl, &vl->rows[index % vl->pool], index);
+    }
+    // 总数少于行对象数时多余的行隐藏
+    for (int i = 0; i < vl->pool; i++)
+    {
+        struct vlist_row_t *row = &vl->rows[i];
+        if (row->index >= vl->total)
+        {
+            p_lv_obj_add_flag(row->obj, LV_OBJ_FLAG_HIDDEN);
+            row->index = -1;
+            row->loaded = false;
+        }
+    }
+}
+
+static void vlist_scroll_cb(lv_event_t *e)
+{
+    vlist_layout(p_lv_event_get_user_data(e));
+}
+
+static void vlist_click_cb(lv_event_t *e)
+{
+    struct vlist_row_t *row = p_lv_event_get_user_data(e);
+    for (int i = 0; i < VLIST_MAX; i++)
+    {
+        struct vlist_t *vl = &g_vlists[i];
+        if (vl->used && row >= vl->rows && row < vl->rows + vl->pool)
+        {
+            vl->clicked = row->index;
+            return;
+        }
+    }
+}
+
+// 列宽 "120,200,160"，未指定时整行一列
+static int vlist_parse_columns(struct vlist_t *vl, const char *columns, int width)
+{
+    vl->cols = 0;
+    int x = 0;
+    const char *p = columns;
+    while (p && *p && vl->cols < VLIST_COLS_MAX)
+    {
+        int w = atoi(p);
+        if (w <= 0)
+        {
+            return -1;
+        }
+        vl->col_x[vl->cols] = x;
+        vl->col_w[vl->cols] = w;
+        vl->cols++;
+        x += w;
+        p = strchr(p, ',');
+        p = p ? p + 1 : NULL;
+    }
+    if (vl->cols == 0)
+    {
+        vl->col_x[0] = 0;
+        vl->col_w[0] = width;
+        vl->cols = 1;
+    }
+    return 0;
+}
+
+int lvgl_vlist_create(int x, int y, int width, int height, int row_height, const char *columns, int page_size, int overscan)
+{
+    if (!lvgl_load_vlist_symbols() || width <= 0 || height <= 0 || row_height <= 0 || page_size <= 0 || overscan < 0)
+    {
+        return -1;
+    }
+    int id = -1;
+    for (int i = 0; i < VLIST_MAX && id < 0; i++)
+    {
+        id = g_vlists[i].used ? -1 : i;
+    }
+    if (id < 0)
+    {
+        printf("虚拟列表数超过上限%d\n", VLIST_MAX);
+        return -1;
+    }
+    struct vlist_t *vl = &g_vlists[id];
+    memset(vl, 0, sizeof(*vl));
+    if (vlist_parse_columns(vl, columns, width) != 0)
+    {
+        printf("虚拟列表列宽格式错误: %s\n", columns);
+        return -1;
+    }
+    vl->pool = (height + row_height - 1) / row_height + 1 + overscan * 2;
+    if (vl->pool > VLIST_POOL_MAX)
+    {
+        printf("虚拟列表行数%d超过上限%d，预留行将被裁减\n", vl->pool, VLIST_POOL_MAX);
+        vl->pool = VLIST_POOL_MAX;
+    }
+    vl->row_h = row_height;
+    vl->page_size = page_size;
+    vl->overscan = overscan;
+    vl->bg_even = lv_color_hex(0xFFFFFF);
+    vl->bg_odd = lv_color_hex(0xF2F2F2);
+    vl->bg_opa = LV_OPA_COVER;
+    vl->clicked = -1;
+    for (int i = 0; i < VLIST_CACHE_PAGES; i++)
+    {
+        vl->pages[i].page = -1;
+    }
+
+    vl->cont = p_lv_obj_create(p_lv_disp_get_scr_act(p_lv_disp_get_default()));
+    obj_remove_style_all(vl->cont);
+    p_lv_obj_set_pos(vl->cont, x, y);
+    p_lv_obj_set_size(vl->cont, width, height);
+    p_lv_obj_set_scroll_dir(vl->cont, LV_DIR_VER);
+    p_lv_obj_add_event_cb(vl->cont, vlist_scroll_cb, LV_EVENT_SCROLL, vl);
+
+    vl->spacer = p_lv_obj_create(vl->cont);
+    obj_remove_style_all(vl->spacer);
+    p_lv_obj_clear_flag(vl->spacer, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    p_lv_obj_set_size(vl->spacer, 1, 1);
+    p_lv_obj_set_pos(vl->spacer, 0, 0);
+
+    for (int i = 0; i < vl->pool; i++)
+    {
+        struct vlist_row_t *row = &vl->rows[i];
+        row->index = -1;
+        row->obj = p_lv_obj_create(vl->cont);
+        obj_remove_style_all(row->obj);
+        p_lv_obj_clear_flag(row->obj, LV_OBJ_FLAG_SCROLLABLE);
+        p_lv_obj_set_size(row->obj, width, row_height);
+        p_lv_obj_set_pos(row->obj, 0, 0);
+        p_lv_obj_set_style_bg_opa(row->obj, vl->bg_opa, 0);
+        p_lv_obj_add_flag(row->obj, LV_OBJ_FLAG_HIDDEN);
+        p_lv_obj_add_event_cb(row->obj, vlist_click_cb, LV_EVENT_CLICKED, row);
+        for (int c = 0; c < vl->cols; c++)
+        {
+            row->cells[c] = p_lv_label_create(row->obj);
+            p_lv_label_set_long_mode(row->cells[c], LV_LABEL_LONG_DOT);
+            p_lv_obj_set_size(row->cells[c], vl->col_w[c], LV_SIZE_CONTENT);
+            p_lv_obj_align(row->cells[c], LV_ALIGN_LEFT_MID, vl->col_x[c], 0);
+            p_lv_label_set_text(row->cells[c], "");
+        }
+    }
+    vl->used = true;
+    return id;
+}
+
+void lvgl_vlist_destroy(int id)
+{
+    struct vlist_t *vl = vlist_get(id);
+    if (!vl)
+    {
+        return;
+    }
+    p_lv_obj_del(vl->cont);
+    vlist_cache_clear(vl);
+    lvgl_font_release(vl->font);
+    memset(vl, 0, sizeof(*vl));
+}
+
+int lvgl_vlist_set_style(int id, const char *font_spec, uint32_t text_color, uint32_t bg_even, uint32_t bg_odd, int bg_opa)
+{
+    struct vlist_t *vl = vlist_get(id);
+    if (!vl)
+    {
+        return -1;
+    }
+    if (font_spec && font_spec[0])
+    {
+        lv_font_t *font = lvgl_font_get(font_spec);
+        if (!font)
+        {
+            return -1;
+        }
+        lvgl_font_release(vl->font);
+        vl->font = font;
+        p_lv_obj_set_style_text_font(vl->cont, font, 0);
+    }
+    p_lv_obj_set_style_text_color(vl->cont, lv_color_hex(text_color), 0);
+    vl->bg_even = lv_color_hex(bg_even);
+    vl->bg_odd = lv_color_hex(bg_odd);
+    vl->bg_opa = bg_opa < 0 ? LV_OPA_TRANSP : bg_opa > LV_OPA_COVER ? LV_OPA_COVER : bg_opa;
+    for (int i = 0; i < vl->pool; i++)
+    {
+        struct vlist_row_t *row = &vl->rows[i];
+        p_lv_obj_set_style_bg_opa(row->obj, vl->bg_opa, 0);
+        if (row->index >= 0)
+        {
+            p_lv_obj_set_style_bg_color(row->obj, row->index % 2 ? vl->bg_odd : vl->bg_even, 0);
+        }
+    }
+    return 0;
+}
+
+int lvgl_vlist_set_total(int id, int total)
+{
+    struct vlist_t *vl = vlist_get(id);
+    if (!vl || total < 0)
+    {
+        return -1;
+    }
+    // 数据整体变化，缓存和已绑定的行全部作废
+    vl->total = total;
+    vlist_cache_clear(vl);
+    for (int i = 0; i < vl->pool; i++)
+    {
+        vl->rows[i].index = -1;
+        vl->rows[i].loaded = false;
+        p_lv_obj_add_flag(vl->rows[i].obj, LV_OBJ_FLAG_HIDDEN);
+    }
+    p_lv_obj_set_y(vl->spacer, total > 0 ? total * vl->row_h - 1 : 0);
+    if (p_lv_obj_get_scroll_y(vl->cont) > total * vl->row_h)
+    {
+        p_lv_obj_scroll_to_y(vl->cont, 0, LV_ANIM_OFF);
+    }
+    vlist_layout(vl);
+    return 0;
+}
+
+int lvgl_vlist_next_request(int id)
+{
+    struct vlist_t *vl = vlist_get(id);
+    if (!vl)
+    {
+        return -1;
+    }
+    for (int i = 0; i < vl->req_count; i++)
+    {
+        if (!vl->reqs[i].taken)
+        {
+            vl->reqs[i].taken = true;
+            return vl->reqs[i].page;
+        }
+    }
+    return -1;
+}
+
+int lvgl_vlist_set_page(int id, int page, const char *text)
+{
+    struct vlist_t *vl = vlist_get(id);
+    if (!vl)
+    {
+        return -1;
+    }
+    for (int i = 0; i < vl->req_count; i++)
+    {
+        if (vl->reqs[i].page == page)
+        {
+            memmove(&vl->reqs[i], &vl->reqs[i + 1], (vl->req_count - i - 1) * sizeof(vl->reqs[0]));
+            vl->req_count--;
+            break;
+        }
+    }
+    // 取数失败时只撤销请求，行保持占位内容，再次滚动到该页时重新请求
+    if (!text)
+    {
+        return 0;
+    }
+
+    struct vlist_page_t *slot = NULL;
+    for (int i = 0; i < VLIST_CACHE_PAGES; i++)
+    {
+        struct vlist_page_t *p = &vl->pages[i];
+        if (p->page == page || p->page < 0)
+        {
+            slot = p;
+            break;
+        }
+        if (!slot || p->used < slot->used)
+        {
+            slot = p;
+        }
+    }
+    vlist_page_free(slot);
+
+    slot->text = strdup(text);
+    slot->cells = calloc((size_t)vl->page_size * vl->cols, sizeof(char *));
+    if (!slot->text || !slot->cells)
+    {
+        vlist_page_free(slot);
+        return -1;
+    }
+    char *p = slot->text;
+    while (*p && slot->count < vl->page_size)
+    {
+        const char **cells = &slot->cells[slot->count * vl->cols];
+        for (int c = 0; c < vl->cols; c++)
+        {
+            cells[c] = p;
+            // 列数不足时其余单元格为空串，多余的列忽略
+            while (*p && *p != '\t' && *p != '\n')
+            {
+                p++;
+            }
+            if (*p == '\t' && c + 1 < vl->cols)
+            {
+                *p++ = '\0';
+            }
+        }
+        while (*p && *p != '\n')
+        {
+            *p++ = '\0';
+        }
+        if (*p == '\n')
+        {
+            *p++ = '\0';
+        }
+        slot->count++;
+    }
+    for (int i = slot->count * vl->cols; i < vl->page_size * vl->cols; i++)
+    {
+        slot->cells[i] = "";
+    }
+    slot->page = page;
+    slot->used = ++vl->tick;
+    vlist_layout(vl);
+    return slot->count;
+}
+
+int lvgl_vlist_take_click(int id)
+{
+    struct vlist_t *vl = vlist_get(id);
+    if (!vl)
+    {
+        return -1;
+    }
+    int index = vl->clicked;
+    vl->clicked = -1;
+    return index;
+}
+
+int lvgl_vlist_set_visible(int id, int visible)
+{
+    struct vlist_t *vl = vlist_get(id);
+    if (!vl)
+    {
+        return -1;
+    }
+    if (visible)
+    {
+        p_lv_obj_clear_flag(vl->cont, LV_OBJ_FLAG_HIDDEN);
+        p_lv_obj_move_to_index(vl->cont, -1);
+    }
+    else
+    {
+        p_lv_obj_add_flag(vl->cont, LV_OBJ_FLAG_HIDDEN);
+    }
+    return 0;
+}
+
+int lvgl_vlist_scroll_to(int id, int index)
+{
+    struct vlist_t *vl = vlist_get(id);
+    if (!vl || index < 0)
+    {
+        return -1;
+    }
+    p_lv_obj_scroll_to_y(vl->cont, index * vl->row_h, LV_ANIM_OFF);
+    vlist_layout(vl);
+    return 0;
+}
+
+int lvgl_vlist_widget_count(int id)
+{
+    struct vlist_t *vl = vlist_get(id);
+    return vl ? vl->pool * (vl->cols + 1) + 2 : -1;
+}
+
+// ---------------- 原生动画 ----------------
+
+// 动画由若干并行的轨道组成，每条轨道对一个对象的一个属性按关键帧插值，整个过程在LVGL定时器中完成；
+// JS只在开始、结束时从事件队列取到通知。动画结束后可自动启动链上的下一个动画
+// 对象句柄数，JS组件创建时即分配（见 lvgl_obj_capture_begin），需容纳全部界面组件
+#define ANIM_TARGET_MAX 128
+#define ANIM_MAX 32
+#define ANIM_TRACK_MAX 64
+#define ANIM_KEYFRAME_MAX 8
+#define ANIM_EVENT_MAX 32
+
+struct anim_keyframe_t
+{
+    int time;
+    int value;
+    lv_anim_path_cb_t path; // 从该帧到下一帧的缓动
+};
+
+struct anim_track_t
+{
+    bool used;
+    bool running;
+    int anim;
+    int target;
+    int prop;
+    int count;
+    struct anim_keyframe_t frames[ANIM_KEYFRAME_MAX];
+    int delay;
+    int repeat;
+    bool playback;
+};
+
+struct anim_t
+{
+    bool used;
+    bool running;
+    int pending; // 尚未结束的轨道数
+    int next;    // 结束后启动的动画，-1表示无
+};
+
+static lv_obj_t *g_anim_targets[ANIM_TARGET_MAX];
+static struct anim_t g_anims[ANIM_MAX];
+static struct anim_track_t g_anim_tracks[ANIM_TRACK_MAX];
+static int g_anim_events[ANIM_EVENT_MAX];
+static int g_anim_event_head = 0;
+static int g_anim_event_count = 0;
+
+LV_SYM(lv_obj_get_parent);
+LV_SYM(lv_obj_remove_event_cb);
+LV_SYM(lv_event_get_param);
+LV_SYM(lv_event_get_current_target);
+LV_SYM(lv_obj_set_x);
+LV_SYM(lv_obj_set_width);
+LV_SYM(lv_obj_set_height);
+LV_SYM(lv_obj_set_style_translate_x);
+LV_SYM(lv_obj_set_style_translate_y);
+LV_SYM(lv_obj_set_style_opa);
+LV_SYM(lv_obj_set_style_transform_zoom);
+LV_SYM(lv_obj_set_style_transform_angle);
+LV_SYM(lv_anim_init);
+LV_SYM(lv_anim_start);
+LV_SYM(lv_anim_del);
+LV_SYM(lv_anim_path_linear);
+LV_SYM(lv_anim_path_ease_in);
+LV_SYM(lv_anim_path_ease_out);
+LV_SYM(lv_anim_path_ease_in_out);
+LV_SYM(lv_anim_path_overshoot);
+LV_SYM(lv_anim_path_bounce);
+LV_SYM(lv_anim_path_step);
+
+static bool lvgl_load_anim_symbols()
+{
+    static bool loaded = false;
+    static bool ok = false;
+    if (!loaded)
+    {
+        loaded = true;
+        ok = LV_LOAD(lv_disp_get_default) && LV_LOAD(lv_disp_get_scr_act) && LV_LOAD(lv_disp_get_layer_top) &&
+             LV_LOAD(lv_disp_get_layer_sys) && LV_LOAD(lv_obj_get_child) && LV_LOAD(lv_obj_get_child_cnt) &&
+             LV_LOAD(lv_obj_get_parent) && LV_LOAD(lv_obj_remove_event_cb) && LV_LOAD(lv_event_get_param) &&
+             LV_LOAD(lv_event_get_current_target) && LV_LOAD(lv_obj_add_event_cb) &&
+             LV_LOAD(lv_event_get_user_data) && LV_LOAD(lv_obj_set_x) && LV_LOAD(lv_obj_set_y) &&
+             LV_LOAD(lv_obj_set_width) && LV_LOAD(lv_obj_set_height) &&
+             LV_LOAD(lv_obj_set_style_translate_x) && LV_LOAD(lv_obj_set_style_translate_y) && LV_LOAD(lv_obj_set_style_opa) &&
+             LV_LOAD(lv_obj_set_style_transform_zoom) && LV_LOAD(lv_obj_set_style_transform_angle) &&
+             LV_LOAD(lv_anim_init) && LV_LOAD(lv_anim_start) && LV_LOAD(lv_anim_del) &&
+             LV_LOAD(lv_anim_path_linear) && LV_LOAD(lv_anim_path_ease_in) && LV_LOAD(lv_anim_path_ease_out) &&
+             LV_LOAD(lv_anim_path_ease_in_out) && LV_LOAD(lv_anim_path_overshoot) && LV_LOAD(lv_anim_path_bounce) &&
+             LV_LOAD(lv_anim_path_step);
+        if (!ok)
+        {
+            printf("LVGL动画接口未导出\n");
+        }
+    }
+    return ok;
+}
+
+static void anim_push_event(int anim, int type)
+{
+    if (g_anim_event_count == ANIM_EVENT_MAX)
+    {
+        // 队列满时丢弃最早的事件
+        g_anim_event_head = (g_anim_event_head + 1) % ANIM_EVENT_MAX;
+        g_anim_event_count--;
+    }
+    g_anim_events[(g_anim_event_head + g_anim_event_count) % ANIM_EVENT_MAX] = anim * 4 + type;
+    g_anim_event_count++;
+}
+
+static void anim_stop_tracks(int anim, bool by_target, int target);
+static void page_forget_shared(int target);
+
+static void anim_target_delete_cb(lv_event_t *e)
+{
+    int target = (int)(intptr_t)p_lv_event_get_user_data(e);
+    anim_stop_tracks(-1, true, target);
+    page_forget_shared(target);
+    g_anim_targets[target] = NULL;
+}
+
+static int anim_target_add(lv_obj_t *obj)
+{
+    int free_slot = -1;
+    for (int i = 0; i < ANIM_TARGET_MAX; i++)
+    {
+        if (g_anim_targets[i] == obj)
+        {
+            return i;
+        }
+        if (!g_anim_targets[i] && free_slot < 0)
+        {
+            free_slot = i;
+        }
+    }
+    if (free_slot < 0)
+    {
+        printf("动画对象数超过上限%d\n", ANIM_TARGET_MAX);
+        return -1;
+    }
+    g_anim_targets[free_slot] = obj;
+    // 对象删除时停止其动画并释放句柄
+    p_lv_obj_add_event_cb(obj, anim_target_delete_cb, LV_EVENT_DELETE, (void *)(intptr_t)free_slot);
+    return free_slot;
+}
+
+// 对象捕获：JS组件构造前后各调用一次，期间在当前屏幕或顶层上新建的第一个直接子对象即组件的对象
+static struct
+{
+    bool active;
+    lv_obj_t *roots[2];
+    lv_obj_t *obj;
+} g_capture = {0};
+
+static void capture_child_created_cb(lv_event_t *e)
+{
+    lv_obj_t *child = p_lv_event_get_param(e);
+    // 该事件逐级冒泡，组件内部创建的子对象也会通知到这里，只取根对象的直接子对象
+    if (!g_capture.obj && child && p_lv_obj_get_parent(child) == p_lv_event_get_current_target(e))
+    {
+        g_capture.obj = child;
+    }
+}
+
+int lvgl_obj_capture_begin(void)
+{
+    if (!lvgl_load_anim_symbols() || g_capture.active)
+    {
+        return -1;
+    }
+    lv_disp_t *disp = p_lv_disp_get_default();
+    g_capture.roots[0] = p_lv_disp_get_scr_act(disp);
+    g_capture.roots[1] = p_lv_disp_get_layer_top(disp);
+    for (size_t i = 0; i < sizeof(g_capture.roots) / sizeof(g_capture.roots[0]); i++)
+    {
+        p_lv_obj_add_event_cb(g_capture.roots[i], capture_child_created_cb, LV_EVENT_CHILD_CREATED, NULL);
+    }
+    g_capture.obj = NULL;
+    g_capture.active = true;
+    return 0;
+}
+
+int lvgl_obj_capture_end(void)
+{
+    if (!g_capture.active)
+    {
+        return -1;
+    }
+    for (size_t i = 0; i < sizeof(g_capture.roots) / sizeof(g_capture.roots[0]); i++)
+    {
+        p_lv_obj_remove_event_cb(g_capture.roots[i], capture_child_created_cb);
+    }
+    lv_obj_t *obj = g_capture.obj;
+    memset(&g_capture, 0, sizeof(g_capture));
+    return obj ? anim_target_add(obj) : -1;
+}
+
+int lvgl_anim_bind_overlay(int which)
+{
+    if (!g_overlay.inited || !lvgl_load_anim_symbols())
+    {
+        return -1;
+    }
+    return anim_target_add(which == 0 ? g_overlay.box : g_overlay.label);
+}
+
+int lvgl_anim_create(void)
+{
+    if (!lvgl_load_anim_symbols())
+    {
+        return -1;
+    }
+    for (int i = 0; i < ANIM_MAX; i++)
+    {
+        if (!g_anims[i].used)
+        {
+            g_anims[i] = (struct anim_t){.used = true, .next = -1};
+            return i;
+        }
+    }
+    printf("动画数超过上限%d\n", ANIM_MAX);
+    return -1;
+}
+
+static struct anim_t *anim_get(int anim)
+{
+    return anim >= 0 && anim < ANIM_MAX && g_anims[anim].used ? &g_anims[anim] : NULL;
+}
+
+static lv_anim_path_cb_t anim_parse_easing(const char *name, size_t len)
+{
+    static const struct
+    {
+        const char *name;
+        lv_anim_path_cb_t *path;
+    } easings[] = {
+        {"linear", &p_lv_anim_path_linear},
+        {"ease-in", &p_lv_anim_path_ease_in},
+        {"ease-out", &p_lv_anim_path_ease_out},
+        {"ease-in-out", &p_lv_anim_path_ease_in_out},
+        {"overshoot", &p_lv_anim_path_overshoot},
+        {"bounce", &p_lv_anim_path_bounce},
+        {"step", &p_lv_anim_path_step},
+    };
+    for (size_t i = 0; i < sizeof(easings) / sizeof(easings[0]); i++)
+    {
+        if (strlen(easings[i].name) == len && strncmp(easings[i].name, name, len) == 0)
+        {
+            return *easings[i].path;
+        }
+    }
+    return len == 0 ? p_lv_anim_path_linear : NULL;
+}
+
+// 关键帧 "时间:值[:缓动];..."，时间（毫秒）递增，第一帧为起始值
+static int anim_parse_keyframes(struct anim_track_t *track, const char *text)
+{
+    const char *p = text;
+    track->count = 0;
+    while (p && *p)
+    {
+        if (track->count == ANIM_KEYFRAME_MAX)
+        {
+            return -1;
+        }
+        struct anim_keyframe_t *frame = &track->frames[track->count];
+        char *end;
+        frame->time = strtol(p, &end, 10);
+        if (*end != ':')
+        {
+            return -1;
+        }
+        frame->value = strtol(end + 1, &end, 10);
+        const char *easing = *end == ':' ? end + 1 : end;
+        const char *next = strchr(easing, ';');
+        size_t len = next ? (size_t)(next - easing) : strlen(easing);
+        frame->path = anim_parse_easing(easing, len);
+        if (!frame->path || (track->count > 0 && frame->time < track->frames[track->count - 1].time))
+        {
+            return -1;
+        }
+        track->count++;
+        p = next ? next + 1 : NULL;
+    }
+    return track->count > 0 ? 0 : -1;
+}
+
+int lvgl_anim_add_track(int anim, int target, int prop, const char *keyframes, int delay, int repeat, int playback)
+{
+    if (!anim_get(anim) || target < 0 || target >= ANIM_TARGET_MAX || !g_anim_targets[target] ||
+        prop < 0 || prop >= ANIM_PROP_COUNT || !keyframes)
+    {
+        return -1;
+    }
+    for (int i = 0; i < ANIM_TRACK_MAX; i++)
+    {
+        struct anim_track_t *track = &g_anim_tracks[i];
+        if (track->used)
+        {
+            continue;
+        }
+        memset(track, 0, sizeof(*track));
+        if (anim_parse_keyframes(track, keyframes) != 0)
+        {
+            printf("关键帧格式错误: %s\n", keyframes);
+            return -1;
+        }
+        track->anim = anim;
+        track->target = target;
+        track->prop = prop;
+        track->delay = delay > 0 ? delay : 0;
+        track->repeat = repeat;
+        track->playback = playback != 0;
+        track->used = true;
+        return 0;
+    }
+    printf("动画轨道数超过上限%d\n", ANIM_TRACK_MAX);
+    return -1;
+}
+
+int lvgl_anim_chain(int anim, int next)
+{
+    struct anim_t *a = anim_get(anim);
+    if (!a || (next >= 0 && !anim_get(next)))
+    {
+        return -1;
+    }
+    a->next = next;
+    return 0;
+}
+
+static int32_t anim_track_value(struct anim_track_t *track, int32_t time)
+{
+    const struct anim_keyframe_t *frames = track->frames;
+    int i = 0;
+    while (i + 1 < track->count && time >= frames[i + 1].time)
+    {
+        i++;
+    }
+    if (i + 1 >= track->count)
+    {
+        return frames[track->count - 1].value;
+    }
+    // 借用LVGL的缓动曲线，按当前区段构造一个临时的动画描述
+    lv_anim_t seg;
+    memset(&seg, 0, sizeof(seg));
+    seg.start_value = frames[i].value;
+    seg.end_value = frames[i + 1].value;
+    seg.time = frames[i + 1].time - frames[i].time;
+    seg.act_time = time - frames[i].time;
+    return frames[i].path(&seg);
+}
+
+static void anim_apply(lv_obj_t *obj, int prop, int32_t value)
+{
+    switch (prop)
+    {
+    case ANIM_PROP_X:
+        p_lv_obj_set_x(obj, value);
+        break;
+    case ANIM_PROP_Y:
+        p_lv_obj_set_y(obj, value);
+        break;
+    case ANIM_PROP_WIDTH:
+        p_lv_obj_set_width(obj, value);
+        break;
+    case ANIM_PROP_HEIGHT:
+        p_lv_obj_set_height(obj, value);
+        break;
+    case ANIM_PROP_TRANSLATE_X:
+        p_lv_obj_set_style_translate_x(obj, value, 0);
+        break;
+    case ANIM_PROP_TRANSLATE_Y:
+        p_lv_obj_set_style_translate_y(obj, value, 0);
+        break;
+    case ANIM_PROP_OPA:
+        p_lv_obj_set_style_opa(obj, value < 0 ? 0 : value > 255 ? 255 : value, 0);
+        break;
+    case ANIM_PROP_ZOOM:
+        p_lv_obj_set_style_transform_zoom(obj, value, 0);
+        break;
+    case ANIM_PROP_ANGLE:
+        p_lv_obj_set_style_transform_angle(obj, value, 0);
+        break;
+    default:
+        break;
+    }
+}
+
+static void anim_exec_cb(void *var, int32_t time)
+{
+    struct anim_track_t *track = var;
+    lv_obj_t *obj = g_anim_targets[track->target];
+    if (obj)
+    {
+        anim_apply(obj, track->prop, anim_track_value(track, time));
+    }
+}
+
+static int anim_start(int anim);
+
+static void anim_track_done(struct anim_track_t *track)
+{
+    track->running = false;
+    struct anim_t *a = &g_anims[track->anim];
+    if (--a->pending > 0)
+    {
+        return;
+    }
+    a->running = false;
+    anim_push_event(track->anim, ANIM_EVENT_END);
+    if (a->next >= 0)
+    {
+        anim_start(a->next);
+    }
+}
+
+static void anim_ready_cb(lv_anim_t *a)
+{
+    anim_track_done(a->var);
+}
+
+static int anim_start(int anim)
+{
+    struct anim_t *a = anim_get(anim);
+    if (!a)
+    {
+        return -1;
+    }
+    anim_stop_tracks(anim, false, -1);
+    a->pending = 0;
+    for (int i = 0; i < ANIM_TRACK_MAX; i++)
+    {
+        struct anim_track_t *track = &g_anim_tracks[i];
+        if (track->used && track->anim == anim && g_anim_targets[track->target])
+        {
+            a->pending++;
+        }
+    }
+    a->running = a->pending > 0;
+    anim_push_event(anim, ANIM_EVENT_START);
+    if (!a->running)
+    {
+        anim_push_event(anim, ANIM_EVENT_END);
+        return 0;
+    }
+    for (int i = 0; i < ANIM_TRACK_MAX; i++)
+    {
+        struct anim_track_t *track = &g_anim_tracks[i];
+        if (!track->used || track->anim != anim || !g_anim_targets[track->target])
+        {
+            continue;
+        }
+        int duration = track->frames[track->count - 1].time;
+        lv_anim_t la;
+        p_lv_anim_init(&la);
+        la.var = track;
+        la.exec_cb = anim_exec_cb;
+        la.ready_cb = anim_ready_cb;
+        la.path_cb = p_lv_anim_path_linear;
+        la.start_value = 0;
+        la.end_value = duration;
+        la.time = duration > 0 ? duration : 1;
+        la.act_time = -track->delay;
+        la.early_apply = 1;
+        la.playback_time = track->playback ? la.time : 0;
+        la.repeat_cnt = track->repeat < 0 ? LV_ANIM_REPEAT_INFINITE : track->repeat;
+        track->running = true;
+        p_lv_anim_start(&la);
+    }
+    return 0;
+}
+
+int lvgl_anim_start(int anim)
+{
+    return anim_start(anim);
+}
+
+// 删除LVGL动画不会触发ready_cb，这里自己收尾；只停目标对象的轨道时，所属动画不再继续链上的下一个
+static void anim_stop_tracks(int anim, bool by_target, int target)
+{
+    for (int i = 0; i < ANIM_TRACK_MAX; i++)
+    {
+        struct anim_track_t *track = &g_anim_tracks[i];
+        if (!track->used || !track->running || (by_target ? track->target != target : track->anim != anim))
+        {
+            continue;
+        }
+        p_lv_anim_del(track, anim_exec_cb);
+        track->running = false;
+        struct anim_t *a = &g_anims[track->anim];
+        if (a->running && --a->pending <= 0)
+        {
+            a->running = false;
+            anim_push_event(track->anim, ANIM_EVENT_STOPPED);
+        }
+    }
+}
+
+int lvgl_anim_stop(int anim)
+{
+    if (!anim_get(anim))
+    {
+        return -1;
+    }
+    anim_stop_tracks(anim, false, -1);
+    return 0;
+}
+
+void lvgl_anim_destroy(int anim)
+{
+    if (!anim_get(anim))
+    {
+        return;
+    }
+    anim_stop_tracks(anim, false, -1);
+    for (int i = 0; i < ANIM_TRACK_MAX; i++)
+    {
+        if (g_anim_tracks[i].used && g_anim_tracks[i].anim == anim)
+        {
+            memset(&g_anim_tracks[i], 0, sizeof(g_anim_tracks[i]));
+        }
+    }
+    for (int i = 0; i < ANIM_MAX; i++)
+    {
+        if (g_anims[i].used && g_anims[i].next == anim)
+        {
+            g_anims[i].next = -1;
+        }
+    }
+    g_anims[anim].used = false;
+}
+
+int lvgl_anim_poll_event(void)
+{
+    if (g_anim_event_count == 0)
+    {
+        return -1;
+    }
+    int event = g_anim_events[g_anim_event_head];
+    g_anim_event_head = (g_anim_event_head + 1) % ANIM_EVENT_MAX;
+    g_anim_event_count--;
+    return event;
+}
+
+int lvgl_anim_running_count(void)
+{
+    int count = 0;
+    for (int i = 0; i < ANIM_MAX; i++)
+    {
+        count += g_anims[i].used && g_anims[i].running;
+    }
+    return count;
+}
+
+// ---------------- 帧计数 ----------------
+
+// 接管显示驱动的 monitor_cb（原回调照常调用），每完成一次有重绘内容的刷新（渲染并送显）计数一次，
+// 供JS等待首帧真正显示后再做后台工作。接管后不恢复，需在 lvgl_prof_start 之前调用
+static struct
+{
+    bool watching;
+    unsigned int frames;
+    void (*orig_monitor_cb)(lv_disp_drv_t *, uint32_t, uint32_t);
+} g_frame = {0};
+
+static void frame_monitor_cb(lv_disp_drv_t *drv, uint32_t time, uint32_t px)
+{
+    if (px > 0)
+    {
+        g_frame.frames++;
+    }
+    if (g_frame.orig_monitor_cb)
+    {
+        g_frame.orig_monitor_cb(drv, time, px);
+    }
+}
+
+int lvgl_frame_watch(void)
+{
+    if (g_frame.watching)
+    {
+        return 0;
+    }
+    if (!LV_LOAD(lv_disp_get_default))
+    {
+        printf("LVGL显示接口未导出\n");
+        return -1;
+    }
+    lv_disp_t *disp = p_lv_disp_get_default();
+    if (!disp || !disp->driver)
+    {
+        return -1;
+    }
+    g_frame.orig_monitor_cb = disp->driver->monitor_cb;
+    disp->driver->monitor_cb = frame_monitor_cb;
+    g_frame.watching = true;
+    return 0;
+}
+
+int lvgl_frame_count(void)
+{
+    return g_frame.watching ? (int)(g_frame.frames & 0x7FFFFFFF) : -1;
+}
+
+// ---------------- 刷新分析 ----------------
+
+// 接管显示驱动的 render_start_cb / flush_cb / monitor_cb（原回调照常调用），统计每帧的重绘区域、
+// 渲染和送显耗时，以及每个对象被重绘的次数，用于找出空闲时仍在不断刷新的界面元素
+#define PROF_OBJ_MAX 128
+#define PROF_FRAME_AREAS 16
+#define PROF_FLASH_MIX 96 // 闪烁模式下重绘区域叠加红色的比例（0-255）
+
+struct prof_obj_t
+{
+    lv_obj_t *obj;
+    unsigned int count;
+};
+
+struct prof_t
+{
+    bool running;
+    int flags;
+    lv_disp_drv_t *drv;
+    void (*orig_flush_cb)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *);
+    void (*orig_monitor_cb)(lv_disp_drv_t *, uint32_t, uint32_t);
+    void (*orig_render_start_cb)(lv_disp_drv_t *);
+    FILE *trace;
+    long long start_us;
+    long long frame_start_us;
+    // 当前帧
+    unsigned int frame_flush_us;
+    unsigned int frame_px;
+    int frame_area_count;
+    lv_area_t frame_areas[PROF_FRAME_AREAS];
+    // 累计
+    unsigned int frames;
+    unsigned long long render_us_total;
+    unsigned int render_us_max;
+    unsigned long long flush_us_total;
+    unsigned int flush_us_max;
+    unsigned long long px_total;
+    unsigned int obj_overflow;
+    struct prof_obj_t objs[PROF_OBJ_MAX];
+};
+static struct prof_t g_prof = {0};
+
+LV_SYM(lv_label_get_text);
+LV_SYM(lv_obj_check_type);
+LV_SYM(lv_label_class);
+
+static long long prof_now_us()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static bool prof_area_intersect(const lv_area_t *a, const lv_area_t *b)
+{
+    return a->x1 <= b->x2 && b->x1 <= a->x2 && a->y1 <= b->y2 && b->y1 <= a->y2;
+}
+
+static void prof_count_obj(lv_obj_t *obj)
+{
+    struct prof_obj_t *slot = NULL;
+    for (int i = 0; i < PROF_OBJ_MAX; i++)
+    {
+        struct prof_obj_t *entry = &g_prof.objs[i];
+        if (entry->obj == obj)
+        {
+            entry->count++;
+            return;
+        }
+        if (!entry->obj && !slot)
+        {
+            slot = entry;
+        }
+    }
+    if (!slot)
+    {
+        g_prof.obj_overflow++;
+        return;
+    }
+    slot->obj = obj;
+    slot->count = 1;
+}
+
+// 统计与重绘区域相交的最深一层可见对象（容器只在没有子对象相交时计入），返回是否相交
+static bool prof_walk(lv_obj_t *obj, const lv_area_t *area)
+{
+    if ((obj->flags & LV_OBJ_FLAG_HIDDEN) || !prof_area_intersect(&obj->coords, area))
+    {
+        return false;
+    }
+    bool child_hit = false;
+    uint32_t count = p_lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        child_hit |= prof_walk(p_lv_obj_get_child(obj, i), area);
+    }
+    if (!child_hit)
+    {
+        prof_count_obj(obj);
+    }
+    return true;
+}
+
+static void prof_flash(const lv_area_t *area, lv_color_t *color_p)
+{
+    lv_color_t red = lv_color_hex(0xFF0000);
+    uint32_t size = (uint32_t)(area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
+    for (uint32_t i = 0; i < size; i++)
+    {
+        color_p[i] = lv_color_mix(red, color_p[i], PROF_FLASH_MIX);
+    }
+}
+
+static void prof_render_start_cb(lv_disp_drv_t *drv)
+{
+    g_prof.frame_start_us = prof_now_us();
+    g_prof.frame_flush_us = 0;
+    g_prof.frame_px = 0;
+    g_prof.frame_area_count = 0;
+    if (g_prof.orig_render_start_cb)
+    {
+        g_prof.orig_render_start_cb(drv);
+    }
+}
+
+static void prof_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    if (g_prof.frame_area_count < PROF_FRAME_AREAS)
+    {
+        g_prof.frame_areas[g_prof.frame_area_count++] = *area;
+    }
+    g_prof.frame_px += (uint32_t)(area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
+    if (g_prof.flags & LVGL_PROF_OBJECTS)
+    {
+        lv_disp_t *disp = p_lv_disp_get_default();
+        lv_obj_t *roots[] = {p_lv_disp_get_scr_act(disp), p_lv_disp_get_layer_top(disp), p_lv_disp_get_layer_sys(disp)};
+        for (size_t i = 0; i < sizeof(roots) / sizeof(roots[0]); i++)
+        {
+            if (roots[i])
+            {
+                prof_walk(roots[i], area);
+            }
+        }
+    }
+    // 直接模式下 color_p 是整屏缓冲区，叠加颜色会残留，不做闪烁
+    if ((g_prof.flags & LVGL_PROF_FLASH) && !drv->direct_mode)
+    {
+        prof_flash(area, color_p);
+    }
+    long long start = prof_now_us();
+    g_prof.orig_flush_cb(drv, area, color_p);
+    g_prof.frame_flush_us += (unsigned int)(prof_now_us() - start);
+}
+
+// 每次刷新结束时调用；time为渲染加送显的总耗时（毫秒，精度不够，这里自己计时）
+static void prof_monitor_cb(lv_disp_drv_t *drv, uint32_t time, uint32_t px)
+{
+    long long now = prof_now_us();
+    unsigned int total_us = g_prof.frame_start_us > 0 ? (unsigned int)(now - g_prof.frame_start_us) : time * 1000;
+    unsigned int render_us = total_us > g_prof.frame_flush_us ? total_us - g_prof.frame_flush_us : 0;
+    g_prof.frames++;
+    g_prof.render_us_total += render_us;
+    g_prof.flush_us_total += g_prof.frame_flush_us;
+    g_prof.px_total += g_prof.frame_px;
+    if (render_us > g_prof.render_us_max)
+    {
+        g_prof.render_us_max = render_us;
+    }
+    if (g_prof.frame_flush_us > g_prof.flush_us_max)
+    {
+        g_prof.flush_us_max = g_prof.frame_flush_us;
+    }
+    if (g_prof.trace)
+    {
+        fprintf(g_prof.trace, "%u %lld %u %u %u", g_prof.frames, (now - g_prof.start_us) / 1000, render_us, g_prof.frame_flush_us, g_prof.frame_px);
+        for (int i = 0; i < g_prof.frame_area_count; i++)
+        {
+            const lv_area_t *a = &g_prof.frame_areas[i];
+            fprintf(g_prof.trace, " %d,%d,%d,%d", a->x1, a->y1, a->x2, a->y2);
+        }
+        fputc('\n', g_prof.trace);
+    }
+    g_prof.frame_start_us = 0;
+    if (g_prof.orig_monitor_cb)
+    {
+        g_prof.orig_monitor_cb(drv, time, px);
+    }
+}
+
+int lvgl_prof_start(int flags, const char *trace_path)
+{
+    if (g_prof.running)
+    {
+        return -1;
+    }
+    if (!LV_LOAD(lv_disp_get_default) || !LV_LOAD(lv_disp_get_scr_act) || !LV_LOAD(lv_disp_get_layer_top) ||
+        !LV_LOAD(lv_disp_get_layer_sys) || !LV_LOAD(lv_obj_get_child) || !LV_LOAD(lv_obj_get_child_cnt))
+    {
+        printf("LVGL显示接口未导出\n");
+        return -1;
+    }
+    lv_disp_t *disp = p_lv_disp_get_default();
+    if (!disp || !disp->driver || !disp->driver->flush_cb)
+    {
+        return -1;
+    }
+    memset(&g_prof, 0, sizeof(g_prof));
+    if (trace_path && trace_path[0])
+    {
+        g_prof.trace = fopen(trace_path, "w");
+        if (!g_prof.trace)
+        {
+            printf("刷新分析文件打开失败: %s\n", trace_path);
+            return -1;
+        }
+        fprintf(g_prof.trace, "# %dx%d frame time_ms render_us flush_us px areas(x1,y1,x2,y2)...\n", disp->driver->hor_res, disp->driver->ver_res);
+    }
+    g_prof.flags = flags;
+    g_prof.drv = disp->driver;
+    g_prof.orig_flush_cb = g_prof.drv->flush_cb;
+    g_prof.orig_monitor_cb = g_prof.drv->monitor_cb;
+    g_prof.orig_render_start_cb = g_prof.drv->render_start_cb;
+    g_prof.start_us = prof_now_us();
+    g_prof.drv->render_start_cb = prof_render_start_cb;
+    g_prof.drv->flush_cb = prof_flush_cb;
+    g_prof.drv->monitor_cb = prof_monitor_cb;
+    g_prof.running = true;
+    return 0;
+}
+
+void lvgl_prof_stop(void)
+{
+    if (!g_prof.running)
+    {
+        return;
+    }
+    g_prof.drv->flush_cb = g_prof.orig_flush_cb;
+    g_prof.drv->monitor_cb = g_prof.orig_monitor_cb;
+    g_prof.drv->render_start_cb = g_prof.orig_render_start_cb;
+    if (g_prof.trace)
+    {
+        fclose(g_prof.trace);
+        g_prof.trace = NULL;
+    }
+    // 保留统计结果，停止后仍可输出报告
+    g_prof.running = false;
+}
+
+static bool prof_obj_alive(lv_obj_t *root, lv_obj_t *obj)
+{
+    if (root == obj)
+    {
+        return true;
+    }
+    uint32_t count = p_lv_obj_get_child_cnt(root);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (prof_obj_alive(p_lv_obj_get_child(root, i), obj))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+struct writer
+{
+    char *buf;
+    size_t size;
+    size_t len;
+};
+
+// 放不下时截断，保证以'\0'结尾
+static void prof_emit(struct writer *w, const char *fmt, ...)
+{
+    if (w->len + 1 >= w->size)
+    {
+        return;
+    }
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(w->buf + w->len, w->size - w->len, fmt, ap);
+    va_end(ap);
+    if (n > 0)
+    {
+        w->len += (size_t)n < w->size - w->len ? (size_t)n : w->size - w->len - 1;
+    }
+}
+
+int lvgl_prof_report(char *buf, size_t size)
+{
+    if (!buf || size == 0 || !g_prof.drv)
+    {
+        return -1;
+    }
+    struct writer w = {.buf = buf, .size = size, .len = 0};
+    unsigned int frames = g_prof.frames ? g_prof.frames : 1;
+    uint32_t screen_px = (uint32_t)g_prof.drv->hor_res * g_prof.drv->ver_res;
+    double seconds = (prof_now_us() - g_prof.start_us) / 1e6;
+    prof_emit(&w, "frames %u in %.1fs (%.1f fps)\n", g_prof.frames, seconds, seconds > 0 ? g_prof.frames / seconds : 0);
+    prof_emit(&w, "render avg %llu us max %u us, flush avg %llu us max %u us\n",
+              g_prof.render_us_total / frames, g_prof.render_us_max, g_prof.flush_us_total / frames, g_prof.flush_us_max);
+    prof_emit(&w, "redrawn avg %llu px/frame (%.1f%% of screen)\n", g_prof.px_total / frames,
+              screen_px ? 100.0 * g_prof.px_total / frames / screen_px : 0);
+
+    // 按重绘次数从高到低输出，对象已删除的标记出来
+    bool printed[PROF_OBJ_MAX] = {0};
+    LV_LOAD(lv_obj_check_type);
+    LV_LOAD(lv_label_get_text);
+    LV_LOAD(lv_label_class);
+    lv_disp_t *disp = p_lv_disp_get_default();
+    for (int n = 0; n < 20; n++)
+    {
+        int best = -1;
+        for (int i = 0; i < PROF_OBJ_MAX; i++)
+        {
+            if (g_prof.objs[i].obj && !printed[i] && (best < 0 || g_prof.objs[i].count > g_prof.objs[best].count))
+            {
+                best = i;
+            }
+        }
+        if (best < 0)
+        {
+            break;
+        }
+        printed[best] = true;
+        lv_obj_t *obj = g_prof.objs[best].obj;
+        bool alive = prof_obj_alive(p_lv_disp_get_scr_act(disp), obj) || prof_obj_alive(p_lv_disp_get_layer_top(disp), obj) ||
+                     prof_obj_alive(p_lv_disp_get_layer_sys(disp), obj);
+        if (!alive)
+        {
+            prof_emit(&w, "%6u %p (deleted)\n", g_prof.objs[best].count, (void *)obj);
+            continue;
+        }
+        const lv_area_t *a = &obj->coords;
+        prof_emit(&w, "%6u %p [%d,%d %dx%d]", g_prof.objs[best].count, (void *)obj, a->x1, a->y1, a->x2 - a->x1 + 1, a->y2 - a->y1 + 1);
+        if (p_lv_obj_check_type && p_lv_label_get_text && p_lv_label_class && p_lv_obj_check_type(obj, p_lv_label_class))
+        {
+            prof_emit(&w, " label \"%.32s\"", p_lv_label_get_text(obj));
+        }
+        prof_emit(&w, "\n");
+    }
+    if (g_prof.obj_overflow)
+    {
+        prof_emit(&w, "%u hits on untracked objects (table full)\n", g_prof.obj_overflow);
+    }
+    return (int)w.len;
+}
+
+// ---------------- 画布 ----------------
+
+// JS 把一帧的绘制记录成 int32 命令数组，一次调用在这里执行完：整帧共用一个绘制上下文，画到后台缓冲区，
+// 执行完再与前台缓冲区交换，只刷新一次；命令格式错误时放弃这一帧，屏幕上保持上一帧
+#define CANVAS_MAX 4
+#define CANVAS_FONTS_MAX 4
+#define CANVAS_FONT_SPEC_MAX 288
+
+struct canvas_font_t
+{
+    char spec[CANVAS_FONT_SPEC_MAX];
+    lv_font_t *font;
+};
+
+struct canvas_t
+{
+    bool used;
+    lv_obj_t *obj;
+    uint8_t *buf[2];
+    int front; // 当前显示的缓冲区
+    int width;
+    int height;
+    lv_img_cf_t cf;
+    size_t size;
+    struct canvas_font_t fonts[CANVAS_FONTS_MAX]; // 命令中用到的字体，画布销毁时释放
+};
+static struct canvas_t g_canvases[CANVAS_MAX];
+
+LV_SYM(lv_canvas_create);
+LV_SYM(lv_canvas_set_buffer);
+LV_SYM(lv_canvas_get_img);
+LV_SYM(lv_obj_invalidate);
+LV_SYM(lv_disp_drv_init);
+LV_SYM(lv_disp_drv_use_generic_set_px_cb);
+LV_SYM(lv_draw_sw_init_ctx);
+LV_SYM(lv_draw_sw_deinit_ctx);
+LV_SYM(_lv_refr_get_disp_refreshing);
+LV_SYM(_lv_refr_set_disp_refreshing);
+LV_SYM(lv_draw_rect_dsc_init);
+LV_SYM(lv_draw_rect);
+LV_SYM(lv_draw_line_dsc_init);
+LV_SYM(lv_draw_line);
+LV_SYM(lv_draw_label_dsc_init);
+LV_SYM(lv_draw_label);
+LV_SYM(lv_draw_img_dsc_init);
+LV_SYM(lv_draw_img);
+LV_SYM(lv_draw_arc_dsc_init);
+LV_SYM(lv_draw_arc);
+LV_SYM(lv_img_decoder_get_info);
+
+static bool lvgl_load_canvas_symbols()
+{
+    static bool loaded = false;
+    static bool ok = false;
+    if (!loaded)
+    {
+        loaded = true;
+        ok = LV_LOAD(lv_disp_get_default) && LV_LOAD(lv_disp_get_scr_act) && LV_LOAD(lv_obj_del) &&
+             LV_LOAD(lv_obj_add_flag) && LV_LOAD(lv_obj_clear_flag) && LV_LOAD(lv_obj_set_pos) && LV_LOAD(lv_obj_move_to_index) &&
+             LV_LOAD(lv_canvas_create) && LV_LOAD(lv_canvas_set_buffer) && LV_LOAD(lv_canvas_get_img) &&
+             LV_LOAD(lv_obj_invalidate) && LV_LOAD(lv_obj_get_style_prop) && LV_LOAD(lv_img_cache_invalidate_src) &&
+             LV_LOAD(lv_disp_drv_init) && LV_LOAD(lv_disp_drv_use_generic_set_px_cb) &&
+             LV_LOAD(lv_draw_sw_init_ctx) && LV_LOAD(lv_draw_sw_deinit_ctx) &&
+             LV_LOAD(_lv_refr_get_disp_refreshing) && LV_LOAD(_lv_refr_set_disp_refreshing) &&
+             LV_LOAD(lv_draw_rect_dsc_init) && LV_LOAD(lv_draw_rect) && LV_LOAD(lv_draw_line_dsc_init) && LV_LOAD(lv_draw_line) &&
+             LV_LOAD(lv_draw_label_dsc_init) && LV_LOAD(lv_draw_label) && LV_LOAD(lv_draw_img_dsc_init) && LV_LOAD(lv_draw_img) &&
+             LV_LOAD(lv_draw_arc_dsc_init) && LV_LOAD(lv_draw_arc) && LV_LOAD(lv_img_decoder_get_info);
+        if (!ok)
+        {
+            printf("LVGL画布接口未导出\n");
+        }
+    }
+    return ok;
+}
+
+static struct canvas_t *canvas_get(int id)
+{
+    if (id < 0 || id >= CANVAS_MAX || !g_canvases[id].used)
+    {
+        return NULL;
+    }
+    return &g_canvases[id];
+}
+
+static void canvas_fill(struct canvas_t *cv, uint8_t *buf, lv_color_t color, lv_opa_t opa)
+{
+    size_t px_size = cv->cf == LV_IMG_CF_TRUE_COLOR_ALPHA ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+#if LV_COLOR_DEPTH == 32
+    color.ch.alpha = cv->cf == LV_IMG_CF_TRUE_COLOR_ALPHA ? opa : LV_OPA_COVER;
+#endif
+    uint8_t px[LV_IMG_PX_SIZE_ALPHA_BYTE];
+    memcpy(px, &color, sizeof(lv_color_t));
+    px[px_size - 1] = px_size > sizeof(lv_color_t) ? opa : px[px_size - 1];
+    size_t count = (size_t)cv->width * cv->height;
+    for (size_t i = 0; i < count; i++)
+    {
+        memcpy(buf + i * px_size, px, px_size);
+    }
+}
+
+// 取命令中的字符串：strings 中以'\0'结尾，偏移越界或没有结束符返回NULL
+static const char *canvas_string(const char *strings, int strings_len, int32_t offset)
+{
+    if (!strings || offset < 0 || offset >= strings_len || !memchr(strings + offset, '\0', strings_len - offset))
+    {
+        return NULL;
+    }
+    return strings + offset;
+}
+
+static const lv_font_t *canvas_font(struct canvas_t *cv, const char *spec)
+{
+    struct canvas_font_t *slot = NULL;
+    for (int i = 0; i < CANVAS_FONTS_MAX; i++)
+    {
+        if (cv->fonts[i].font && strcmp(cv->fonts[i].spec, spec) == 0)
+        {
+            return cv->fonts[i].font;
+        }
+        if (!cv->fonts[i].font && !slot)
+        {
+            slot = &cv->fonts[i];
+        }
+    }
+    if (!slot || strlen(spec) >= CANVAS_FONT_SPEC_MAX)
+    {
+        printf("画布字体数超过上限%d: %s\n", CANVAS_FONTS_MAX, spec);
+        return NULL;
+    }
+    slot->font = lvgl_font_get(spec);
+    if (slot->font)
+    {
+        strcpy(slot->spec, spec);
+    }
+    return slot->font;
+}
+
+static const lv_text_align_t CANVAS_ALIGNS[] = {LV_TEXT_ALIGN_LEFT, LV_TEXT_ALIGN_CENTER, LV_TEXT_ALIGN_RIGHT};
+
+// 执行命令，返回执行的条数，格式错误返回-1
+static int canvas_exec(struct canvas_t *cv, lv_draw_ctx_t *draw_ctx, const int32_t *cmds, int count, const char *strings, int strings_len)
+{
+    const lv_font_t *font = p_lv_obj_get_style_prop(cv->obj, LV_PART_MAIN, LV_STYLE_TEXT_FONT).ptr;
+    int executed = 0;
+    int i = 0;
+    while (i < count)
+    {
+        const int32_t *c = &cmds[i];
+        int left = count - i;
+        switch (c[0])
+        {
+        case CANVAS_CMD_CLEAR:
+        {
+            if (left < 3)
+            {
+                return -1;
+            }
+            canvas_fill(cv, draw_ctx->buf, lv_color_hex(c[1]), c[2]);
+            i += 3;
+            break;
+        }
+        case CANVAS_CMD_RECT:
+        {
+            if (left < 10)
+            {
+                return -1;
+            }
+            lv_draw_rect_dsc_t dsc;
+            p_lv_draw_rect_dsc_init(&dsc);
+            dsc.bg_color = lv_color_hex(c[5]);
+            dsc.bg_opa = c[6];
+            dsc.radius = c[7];
+            dsc.border_color = lv_color_hex(c[8]);
+            dsc.border_width = c[9];
+            dsc.border_opa = c[9] > 0 ? LV_OPA_COVER : LV_OPA_TRANSP;
+            lv_area_t area = {c[1], c[2], c[1] + c[3] - 1, c[2] + c[4] - 1};
+            if (c[3] > 0 && c[4] > 0)
+            {
+                p_lv_draw_rect(draw_ctx, &dsc, &area);
+            }
+            i += 10;
+            break;
+        }
+        case CANVAS_CMD_LINE:
+        {
+            if (left < 8)
+            {
+                return -1;
+            }
+            lv_draw_line_dsc_t dsc;
+            p_lv_draw_line_dsc_init(&dsc);
+            dsc.color = lv_color_hex(c[5]);
+            dsc.width = c[6];
+            dsc.opa = c[7];
+            lv_point_t p1 = {c[1], c[2]};
+            lv_point_t p2 = {c[3], c[4]};
+            p_lv_draw_line(draw_ctx, &dsc, &p1, &p2);
+            i += 8;
+            break;
+        }
+        case CANVAS_CMD_POLYLINE:
+        {
+            if (left < 5 || c[4] < 0 || c[4] > (left - 5) / 2)
+            {
+                return -1;
+            }
+            lv_draw_line_dsc_t dsc;
+            p_lv_draw_line_dsc_init(&dsc);
+            dsc.color = lv_color_hex(c[1]);
+            dsc.width = c[2];
+            dsc.opa = c[3];
+            // 线宽较大时用圆头，折线拐角处不留缺口
+            dsc.round_start = dsc.round_end = c[2] > 2;
+            const int32_t *pts = &c[5];
+            for (int n = 1; n < c[4]; n++)
+            {
+                lv_point_t p1 = {pts[n * 2 - 2], pts[n * 2 - 1]};
+                lv_point_t p2 = {pts[n * 2], pts[n * 2 + 1]};
+                p_lv_draw_line(draw_ctx, &dsc, &p1, &p2);
+            }
+            i += 5 + c[4] * 2;
+            break;
+        }
+        case CANVAS_CMD_TEXT:
+        {
+            const char *text = left < 7 ? NULL : canvas_string(strings, strings_len, c[6]);
+            if (!text || c[5] < 0 || c[5] > 2)
+            {
+                return -1;
+            }
+            lv_draw_label_dsc_t dsc;
+            p_lv_draw_label_dsc_init(&dsc);
+            dsc.font = font;
+            dsc.color = lv_color_hex(c[4]);
+            dsc.align = CANVAS_ALIGNS[c[5]];
+            int max_w = c[3] > 0 ? c[3] : cv->width - c[1];
+            lv_area_t area = {c[1], c[2], c[1] + max_w - 1, cv->height - 1};
+            if (font && max_w > 0)
+            {
+                p_lv_draw_label(draw_ctx, &dsc, &area, text, NULL);
+            }
+            i += 7;
+            break;
+        }
+        case CANVAS_CMD_FONT:
+        {
+            const char *spec = left < 2 ? NULL : canvas_string(strings, strings_len, c[1]);
+            if (!spec)
+            {
+                return -1;
+            }
+            const lv_font_t *f = canvas_font(cv, spec);
+            font = f ? f : font;
+            i += 2;
+            break;
+        }
+        case CANVAS_CMD_IMAGE:
+        {
+            const char *src = left < 6 ? NULL : canvas_string(strings, strings_len, c[5]);
+            if (!src)
+            {
+                return -1;
+            }
+            lv_img_header_t header;
+            if (p_lv_img_decoder_get_info(src, &header) == LV_RES_OK)
+            {
+                lv_draw_img_dsc_t dsc;
+                p_lv_draw_img_dsc_init(&dsc);
+                dsc.zoom = c[3] > 0 ? c[3] : LV_IMG_ZOOM_NONE;
+                dsc.opa = c[4];
+                dsc.pivot.x = header.w / 2;
+                dsc.pivot.y = header.h / 2;
+                lv_area_t area = {c[1], c[2], c[1] + header.w - 1, c[2] + header.h - 1};
+                p_lv_draw_img(draw_ctx, &dsc, &area, src);
+            }
+            else
+            {
+                printf("画布图片打开失败: %s\n", src);
+            }
+            i += 6;
+            break;
+        }
+        case CANVAS_CMD_ARC:
+        {
+            if (left < 9)
+            {
+                return -1;
+            }
+            lv_draw_arc_dsc_t dsc;
+            p_lv_draw_arc_dsc_init(&dsc);
+            dsc.color = lv_color_hex(c[6]);
+            dsc.width = c[7];
+            dsc.opa = c[8];
+            lv_point_t center = {c[1], c[2]};
+            if (c[3] > 0)
+            {
+                p_lv_draw_arc(draw_ctx, &dsc, &center, c[3], c[4], c[5]);
+            }
+            i += 9;
+            break;
+        }
+        default:
+            return -1;
+        }
+        executed++;
+    }
+    return executed;
+}
+
+int lvgl_canvas_create(int x, int y, int width, int height, int alpha)
+{
+    if (!lvgl_load_canvas_symbols() || width <= 0 || height <= 0)
+    {
+        return -1;
+    }
+    int id = -1;
+    for (int i = 0; i < CANVAS_MAX && id < 0; i++)
+    {
+        id = g_canvases[i].used ? -1 : i;
+    }
+    if (id < 0)
+    {
+        printf("画布数超过上限%d\n", CANVAS_MAX);
+        return -1;
+    }
+    struct canvas_t *cv = &g_canvases[id];
+    memset(cv, 0, sizeof(*cv));
+    cv->width = width;
+    cv->height = height;
+    cv->cf = alpha ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+    cv->size = alpha ? LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(width, height) : LV_CANVAS_BUF_SIZE_TRUE_COLOR(width, height);
+    cv->buf[0] = calloc(1, cv->size);
+    cv->buf[1] = calloc(1, cv->size);
+    if (!cv->buf[0] || !cv->buf[1])
+    {
+        printf("画布缓冲区分配失败: %dx%d\n", width, height);
+        free(cv->buf[0]);
+        free(cv->buf[1]);
+        memset(cv, 0, sizeof(*cv));
+        return -1;
+    }
+    cv->obj = p_lv_canvas_create(p_lv_disp_get_scr_act(p_lv_disp_get_default()));
+    p_lv_canvas_set_buffer(cv->obj, cv->buf[0], width, height, cv->cf);
+    p_lv_obj_set_pos(cv->obj, x, y);
+    cv->used = true;
+    return id;
+}
+
+void lvgl_canvas_destroy(int id)
+{
+    struct canvas_t *cv = canvas_get(id);
+    if (!cv)
+    {
+        return;
+    }
+    p_lv_obj_del(cv->obj);
+    for (int i = 0; i < CANVAS_FONTS_MAX; i++)
+    {
+        lvgl_font_release(cv->fonts[i].font);
+    }
+    free(cv->buf[0]);
+    free(cv->buf[1]);
+    memset(cv, 0, sizeof(*cv));
+}
+
+int lvgl_canvas_flush(int id, const int32_t *cmds, int count, const char *strings, int strings_len)
+{
+    struct canvas_t *cv = canvas_get(id);
+    if (!cv || (!cmds && count > 0) || count < 0)
+    {
+        return -1;
+    }
+    uint8_t *back = cv->buf[cv->front ^ 1];
+    // 不以清屏开头时在上一帧的基础上继续画
+    if (count == 0 || cmds[0] != CANVAS_CMD_CLEAR)
+    {
+        memcpy(back, cv->buf[cv->front], cv->size);
+    }
+
+    // 与 lv_canvas_draw_* 相同的做法，把缓冲区当作一个临时显示器，但整帧只初始化一次
+    lv_area_t area = {0, 0, cv->width - 1, cv->height - 1};
+    lv_disp_drv_t drv;
+    lv_disp_t disp;
+    lv_draw_sw_ctx_t ctx;
+    memset(&disp, 0, sizeof(disp));
+    memset(&ctx, 0, sizeof(ctx));
+    p_lv_disp_drv_init(&drv);
+    drv.hor_res = cv->width;
+    drv.ver_res = cv->height;
+    disp.driver = &drv;
+    p_lv_draw_sw_init_ctx(&drv, &ctx.base_draw);
+    drv.draw_ctx = &ctx.base_draw;
+    ctx.base_draw.clip_area = &area;
+    ctx.base_draw.buf_area = &area;
+    ctx.base_draw.buf = back;
+    p_lv_disp_drv_use_generic_set_px_cb(&drv, cv->cf);
+    if (cv->cf != LV_IMG_CF_TRUE_COLOR_ALPHA)
+    {
+        drv.screen_transp = 0;
+    }
+
+    lv_disp_t *refr_ori = p__lv_refr_get_disp_refreshing();
+    p__lv_refr_set_disp_refreshing(&disp);
+    int executed = canvas_exec(cv, &ctx.base_draw, cmds, count, strings, strings_len);
+    p__lv_refr_set_disp_refreshing(refr_ori);
+    p_lv_draw_sw_deinit_ctx(&drv, &ctx.base_draw);
+    if (executed < 0)
+    {
+        printf("画布命令格式错误，丢弃本帧\n");
+        return -1;
+    }
+
+    // 交换前后台缓冲区；图片缓存按描述符记录了数据指针，需一并清除
+    cv->front ^= 1;
+    p_lv_canvas_set_buffer(cv->obj, back, cv->width, cv->height, cv->cf);
+    p_lv_img_cache_invalidate_src(p_lv_canvas_get_img(cv->obj));
+    p_lv_obj_invalidate(cv->obj);
+    return executed;
+}
+
+int lvgl_canvas_set_visible(int id, int visible)
+{
+    struct canvas_t *cv = canvas_get(id);
+    if (!cv)
+    {
+        return -1;
+    }
+    if (visible)
+    {
+        p_lv_obj_clear_flag(cv->obj, LV_OBJ_FLAG_HIDDEN);
+        p_lv_obj_move_to_index(cv->obj, -1);
+    }
+    else
+    {
+        p_lv_obj_add_flag(cv->obj, LV_OBJ_FLAG_HIDDEN);
+    }
+    return 0;
+}
+
+int lvgl_canvas_set_pos(int id, int x, int y)
+{
+    struct canvas_t *cv = canvas_get(id);
+    if (!cv)
+    {
+        return -1;
+    }
+    p_lv_obj_set_pos(cv->obj, x, y);
+    return 0;
+}
+
+// ---------------- 页面 ----------------
+
+// 每个页面是一个独立的LVGL屏幕，提前建好常驻内存，切换时只加载屏幕，页面自身的控件不移动也不修改。
+// 页面 0 是引擎的初始屏幕，其上的对象都属于它自己。各页面共享的对象（顶栏、时间等）跟随当前页面：
+// 切换时移到新页面的最底层，被页面自己的遮罩、提示图片覆盖，与改为页面之前的叠放顺序一致；
+// 回到初始页面时放回原来的层次。
+// LVGL只为当前屏幕计算布局，未显示页面上的样式修改到显示时才布局
+#define PAGE_MAX 8
+#define PAGE_SHARED_MAX 16
+
+struct page_t
+{
+    lv_obj_t *scr;
+    int bg_count; // 背景对象数，其余对象插在其后
+};
+static struct page_t g_pages[PAGE_MAX];
+static int g_page_current = 0;
+
+// 共享对象（动画句柄）及其在初始页面上的层次
+static struct
+{
+    int target;
+    uint32_t home_index;
+} g_shared[PAGE_SHARED_MAX];
+static int g_shared_count = 0;
+
+LV_SYM(lv_obj_set_parent);
+LV_SYM(lv_obj_get_index);
+LV_SYM(lv_disp_load_scr);
+LV_SYM(lv_scr_load_anim);
+
+static bool lvgl_load_page_symbols()
+{
+    static bool loaded = false;
+    static bool ok = false;
+    if (!loaded)
+    {
+        loaded = true;
+        ok = lvgl_load_anim_symbols() && LV_LOAD(lv_obj_create) && LV_LOAD(lv_obj_del) && LV_LOAD(lv_obj_add_flag) &&
+             LV_LOAD(lv_obj_move_to_index) && LV_LOAD(lv_obj_get_style_prop) && LV_LOAD(lv_obj_set_style_bg_color) &&
+             LV_LOAD(lv_obj_set_style_bg_opa) && LV_LOAD(lv_obj_set_parent) && LV_LOAD(lv_obj_get_index) &&
+             LV_LOAD(lv_disp_load_scr) && LV_LOAD(lv_scr_load_anim);
+        if (!ok)
+        {
+            printf("LVGL页面接口未导出\n");
+        }
+        else
+        {
+            g_pages[0].scr = p_lv_disp_get_scr_act(p_lv_disp_get_default());
+        }
+    }
+    return ok;
+}
+
+static struct page_t *page_get(int id)
+{
+    if (!lvgl_load_page_symbols() || id < 0 || id >= PAGE_MAX || !g_pages[id].scr)
+    {
+        return NULL;
+    }
+    return &g_pages[id];
+}
+
+static int page_count_objs(lv_obj_t *obj)
+{
+    int count = 1;
+    uint32_t children = p_lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < children; i++)
+    {
+        count += page_count_objs(p_lv_obj_get_child(obj, i));
+    }
+    return count;
+}
+
+static lv_obj_t *shared_obj(int i)
+{
+    return g_anim_targets[g_shared[i].target];
+}
+
+// 共享对象删除时移出共享表，句柄之后可能分配给其他对象
+static void page_forget_shared(int target)
+{
+    int count = 0;
+    for (int i = 0; i < g_shared_count; i++)
+    {
+        if (g_shared[i].target != target)
+        {
+            g_shared[count++] = g_shared[i];
+        }
+    }
+    g_shared_count = count;
+}
+
+// 把共享对象移到页面 id：初始页面按记录的层次放回，其他页面放在最底层
+static void page_move_shared(int id)
+{
+    lv_obj_t *scr = g_pages[id].scr;
+    if (id == 0)
+    {
+        // 按原层次从低到高放回，前面放回的对象不影响后面的序号
+        bool placed[PAGE_SHARED_MAX] = {false};
+        for (int n = 0; n < g_shared_count; n++)
+        {
+            int next = -1;
+            for (int i = 0; i < g_shared_count; i++)
+            {
+                if (!placed[i] && (next < 0 || g_shared[i].home_index < g_shared[next].home_index))
+                {
+                    next = i;
+                }
+            }
+            placed[next] = true;
+            lv_obj_t *obj = shared_obj(next);
+            if (obj)
+            {
+                p_lv_obj_set_parent(obj, scr);
+                p_lv_obj_move_to_index(obj, g_shared[next].home_index);
+            }
+        }
+        return;
+    }
+    int index = 0;
+    for (int i = 0; i < g_shared_count; i++)
+    {
+        lv_obj_t *obj = shared_obj(i);
+        if (obj)
+        {
+            p_lv_obj_set_parent(obj, scr);
+            p_lv_obj_move_to_index(obj, index++);
+        }
+    }
+}
+
+// 离开初始页面前记录共享对象的层次，期间初始页面新增的控件不影响放回的位置
+static void page_save_shared_index(void)
+{
+    for (int i = 0; i < g_shared_count; i++)
+    {
+        lv_obj_t *obj = shared_obj(i);
+        if (obj && p_lv_obj_get_parent(obj) == g_pages[0].scr)
+        {
+            g_shared[i].home_index = (uint32_t)p_lv_obj_get_index(obj);
+        }
+    }
+}
+
+// 页面 id 上共享对象（含子对象）的个数
+static int page_count_shared(int id)
+{
+    int count = 0;
+    for (int i = 0; i < g_shared_count; i++)
+    {
+        lv_obj_t *obj = shared_obj(i);
+        if (obj && p_lv_obj_get_parent(obj) == g_pages[id].scr)
+        {
+            count += page_count_objs(obj);
+        }
+    }
+    return count;
+}
+
+int lvgl_page_create(void)
+{
+    if (!lvgl_load_page_symbols())
+    {
+        return -1;
+    }
+    int id = -1;
+    for (int i = 1; i < PAGE_MAX && id < 0; i++)
+    {
+        id = g_pages[i].scr ? -1 : i;
+    }
+    if (id < 0)
+    {
+        printf("页面数超过上限%d\n", PAGE_MAX);
+        return -1;
+    }
+    // 背景与初始屏幕一致，摄像头画面上的透明背景也能保持
+    lv_obj_t *home = g_pages[0].scr;
+    lv_obj_t *scr = p_lv_obj_create(NULL);
+    p_lv_obj_set_style_bg_color(scr, p_lv_obj_get_style_prop(home, LV_PART_MAIN, LV_STYLE_BG_COLOR).color, 0);
+    p_lv_obj_set_style_bg_opa(scr, p_lv_obj_get_style_prop(home, LV_PART_MAIN, LV_STYLE_BG_OPA).num, 0);
+    g_pages[id].scr = scr;
+    g_pages[id].bg_count = 0;
+    return id;
+}
+
+void lvgl_page_destroy(int id)
+{
+    struct page_t *page = page_get(id);
+    if (!page || id == 0 || id == g_page_current)
+    {
+        return;
+    }
+    // 共享对象只在当前页面上，不会随页面删除
+    p_lv_obj_del(page->scr);
+    memset(page, 0, sizeof(*page));
+}
+
+int lvgl_page_adopt(int id, int target, int background)
+{
+    struct page_t *page = page_get(id);
+    if (!page || target < 0 || target >= ANIM_TARGET_MAX || !g_anim_targets[target])
+    {
+        return -1;
+    }
+    lv_obj_t *obj = g_anim_targets[target];
+    p_lv_obj_set_parent(obj, page->scr);
+    if (background)
+    {
+        p_lv_obj_move_to_index(obj, page->bg_count++);
+    }
+    return 0;
+}
+
+int lvgl_page_share(int target)
+{
+    if (!lvgl_load_page_symbols() || target < 0 || target >= ANIM_TARGET_MAX || !g_anim_targets[target])
+    {
+        return -1;
+    }
+    for (int i = 0; i < g_shared_count; i++)
+    {
+        if (g_shared[i].target == target)
+        {
+            return 0;
+        }
+    }
+    if (g_shared_count == PAGE_SHARED_MAX)
+    {
+        printf("共享对象数超过上限%d\n", PAGE_SHARED_MAX);
+        return -1;
+    }
+    lv_obj_t *obj = g_anim_targets[target];
+    g_shared[g_shared_count].target = target;
+    g_shared[g_shared_count].home_index = p_lv_obj_get_parent(obj) == g_pages[0].scr
+                                              ? (uint32_t)p_lv_obj_get_index(obj)
+                                              : p_lv_obj_get_child_cnt(g_pages[0].scr);
+    g_shared_count++;
+    if (g_page_current != 0)
+    {
+        page_move_shared(g_page_current);
+    }
+    return 0;
+}
+
+int lvgl_page_load(int id, int anim, int time)
+{
+    struct page_t *page = page_get(id);
+    if (!page || anim < LV_SCR_LOAD_ANIM_NONE || anim > LV_SCR_LOAD_ANIM_OUT_BOTTOM)
+    {
+        return -1;
+    }
+    if (id == g_page_current)
+    {
+        return 0;
+    }
+    if (g_page_current == 0)
+    {
+        page_save_shared_index();
+    }
+    page_move_shared(id);
+    if (anim == LV_SCR_LOAD_ANIM_NONE || time <= 0)
+    {
+        p_lv_disp_load_scr(page->scr);
+    }
+    else
+    {
+        p_lv_scr_load_anim(page->scr, anim, time, 0, false);
+    }
+    g_page_current = id;
+    return 0;
+}
+
+int lvgl_page_current(void)
+{
+    return lvgl_load_page_symbols() ? g_page_current : -1;
+}
+
+int lvgl_page_widget_count(int id)
+{
+    struct page_t *page = page_get(id);
+    if (!page)
+    {
+        return -1;
+    }
+    // 不含屏幕本身和当前跟随到该页面的共享对象
+    return page_count_objs(page->scr) - 1 - page_count_shared(id);
+}
@@ -0,0 +1,216 @@
+#ifndef LVGL_WRAPPER_H
+#define LVGL_WRAPPER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// LVGL运行时辅助接口
+// LVGL静态链接在lvgljs引擎中，这里不直接链接，运行时通过dlsym从进程全局符号表中查找，
+// 引擎未导出对应符号时接口返回-1，应用按原逻辑继续运行
+
+// 设置图片解码缓存槽位数（默认LV_IMG_CACHE_DEF_SIZE为1，多张PNG同屏时每次重绘都会重新解码）
+int lvgl_img_cache_set_size(uint16_t size);
+
+// 清除指定图片源的解码缓存，src为NULL时清空全部
+int lvgl_img_cache_invalidate(const void *src);
+
+// 字体管理：同一 "路径#字号#风格" 只创建一个 FreeType 字体，引用计数释放
+
+// 重建 FreeType 缓存（字形缓存按最近最少使用淘汰），必须在创建任何 FreeType 字体之前、LVGL线程中调用；
+// 本模块或界面对象（引擎按样式创建）已在使用 FreeType 字体时返回-1
+int lvgl_font_cache_init(uint16_t max_faces, uint16_t max_sizes, uint32_t max_bytes);
+
+// 取字体（lv_font_t*），失败返回NULL；用完调用 lvgl_font_release
+void *lvgl_font_get(const char *spec);
+void lvgl_font_release(void *font);
+
+// 预先渲染 text（UTF-8）中的字形，字体常驻；返回渲染的字形数，-1表示不支持
+int lvgl_font_prewarm(const char *spec, const char *text);
+
+// 当前字体数
+int lvgl_font_count(void);
+
+// 人脸跟踪框叠加层：在LVGL顶层绘制跟踪框和姓名，由自带的LVGL定时器直接读取人脸检测结果，
+// 不经过JS轮询。需在人脸模块加载后、LVGL线程（JS主线程）中调用
+int lvgl_overlay_init(void);
+void lvgl_overlay_deinit(void);
+
+// 叠加层模式：0关闭，1显示跟踪框
+int lvgl_overlay_set_mode(int mode);
+
+// 跟踪框状态：白色（检测中）、绿色（识别成功）、红色（识别失败），各对应一张跟踪框图片
+#define OVERLAY_STATE_IDLE 0
+#define OVERLAY_STATE_SUCCESS 1
+#define OVERLAY_STATE_FAIL 2
+#define OVERLAY_STATE_NUM 3
+
+// 设置某个状态的跟踪框图片（PNG文件内容，内部复制一份）
+int lvgl_overlay_set_image(int state, const uint8_t *data, uint32_t size);
+
+// 切换跟踪框状态；人脸离开超时后自动复位为 OVERLAY_STATE_IDLE 并隐藏姓名
+int lvgl_overlay_set_state(int state);
+
+// 跟踪框因人脸离开而隐藏的累计次数，JS据此复位识别状态
+unsigned int lvgl_overlay_lost_count(void);
+
+// 姓名标签，空字符串隐藏
+int lvgl_overlay_set_label(const char *text);
+
+// 姓名标签字体（FreeType字体文件路径和字号）
+int lvgl_overlay_set_font(const char *path, int size);
+
+// 虚拟列表：在当前屏幕上创建固定数量的行对象循环复用，滚动时原生侧直接重绑可见行，
+// 记录按页向JS请求（lvgl_vlist_next_request / lvgl_vlist_set_page），控件数量与记录总数无关。
+// 以下接口均需在LVGL线程（JS主线程）中调用
+
+// 创建列表，columns为各列宽度 "120,200,160"（空串表示整行一列），overscan为可见区上下各预留的行数；
+// 返回列表编号，-1表示不支持或参数错误
+int lvgl_vlist_create(int x, int y, int width, int height, int row_height, const char *columns, int page_size, int overscan);
+void lvgl_vlist_destroy(int id);
+
+// 字体（"路径#字号#风格"，空串不修改）、文字颜色、奇偶行背景色（0xRRGGBB）和背景不透明度（0-255）
+int lvgl_vlist_set_style(int id, const char *font_spec, uint32_t text_color, uint32_t bg_even, uint32_t bg_odd, int bg_opa);
+
+// 设置记录总数，同时清空已缓存的页
+int lvgl_vlist_set_total(int id, int total);
+
+// 取一个待加载的页号，没有时返回-1
+int lvgl_vlist_next_request(int id);
+
+// 提供一页数据：每行一条记录（'\n'分隔），列之间用'\t'分隔；text为NULL表示取数失败。返回该页行数
+int lvgl_vlist_set_page(int id, int page, const char *text);
+
+// 取最近一次点击的记录序号，没有时返回-1
+int lvgl_vlist_take_click(int id);
+
+int lvgl_vlist_set_visible(int id, int visible);
+
+// 滚动到第index条记录
+int lvgl_vlist_scroll_to(int id, int index);
+
+// 列表占用的LVGL对象数
+int lvgl_vlist_widget_count(int id);
+
+// 原生动画：关键帧、缓动、重复、回放在LVGL定时器中执行，不经过JS；
+// 多条轨道组成一个动画并行播放，动画之间可串联。以下接口均需在LVGL线程（JS主线程）中调用
+
+enum anim_prop
+{
+    ANIM_PROP_X = 0,
+    ANIM_PROP_Y,
+    ANIM_PROP_WIDTH,
+    ANIM_PROP_HEIGHT,
+    ANIM_PROP_TRANSLATE_X,
+    ANIM_PROP_TRANSLATE_Y,
+    ANIM_PROP_OPA,   // 0-255
+    ANIM_PROP_ZOOM,  // 256为原始大小
+    ANIM_PROP_ANGLE, // 0.1度
+    ANIM_PROP_COUNT,
+};
+
+enum anim_event
+{
+    ANIM_EVENT_START = 0,
+    ANIM_EVENT_END = 1,
+    ANIM_EVENT_STOPPED = 2,
+};
+
+// 取JS组件的对象句柄：构造组件前调用 begin，构造后调用 end，end 返回构造期间在当前屏幕或顶层上
+// 新建的对象的句柄（对象删除后句柄自动失效），没有新建对象或不支持时返回-1。不可嵌套
+int lvgl_obj_capture_begin(void);
+int lvgl_obj_capture_end(void);
+
+// 人脸跟踪框叠加层的对象句柄，which：0跟踪框，1姓名标签
+int lvgl_anim_bind_overlay(int which);
+
+// 创建空动画，返回动画编号
+int lvgl_anim_create(void);
+
+// 添加轨道：keyframes为 "时间:值[:缓动];..."，缓动为从该帧到下一帧的曲线（linear、ease-in、ease-out、
+// ease-in-out、overshoot、bounce、step）；repeat为重复次数，-1无限；playback非0时每轮正放后倒放
+int lvgl_anim_add_track(int anim, int target, int prop, const char *keyframes, int delay, int repeat, int playback);
+
+// 动画结束后自动启动next，-1取消
+int lvgl_anim_chain(int anim, int next);
+
+int lvgl_anim_start(int anim);
+int lvgl_anim_stop(int anim);
+void lvgl_anim_destroy(int anim);
+
+// 取一个动画事件：动画编号 * 4 + anim_event，没有时返回-1
+int lvgl_anim_poll_event(void);
+
+// 正在播放的动画数
+int lvgl_anim_running_count(void);
+
+// 帧计数：开始统计完成送显的帧数，重复调用无影响；需在LVGL线程中、lvgl_prof_start 之前调用
+int lvgl_frame_watch(void);
+
+// 开始统计后完成送显的帧数，未开始统计时返回-1
+int lvgl_frame_count(void);
+
+// 刷新分析：接管显示驱动回调，统计每帧重绘区域、渲染和送显耗时、各对象重绘次数。需在LVGL线程中调用
+
+#define LVGL_PROF_OBJECTS 0x01 // 统计各对象重绘次数（每次送显遍历对象树，有额外开销）
+#define LVGL_PROF_FLASH 0x02   // 重绘区域叠加红色显示，屏幕上闪红的区域即正在重绘的区域
+
+// 开始分析，trace_path非空时每帧写一行：帧号 时间ms 渲染us 送显us 像素数 区域...；已在分析中返回-1
+int lvgl_prof_start(int flags, const char *trace_path);
+
+// 停止分析并恢复显示驱动回调，统计结果保留到下次开始
+void lvgl_prof_stop(void);
+
+// 输出统计报告（文本），返回长度
+int lvgl_prof_report(char *buf, size_t size);
+
+// 画布：JS 把一帧的绘制记录成 int32 命令数组，lvgl_canvas_flush 一次执行完，画到后台缓冲区后与前台交换。
+// 颜色均为 0xRRGGBB，不透明度 0-255，字符串参数为 strings 中以'\0'结尾的字符串的字节偏移。
+// 以下接口均需在LVGL线程（JS主线程）中调用
+
+enum canvas_cmd
+{
+    CANVAS_CMD_CLEAR = 1,    // color, opa；命令数组不以清屏开头时在上一帧基础上绘制
+    CANVAS_CMD_RECT = 2,     // x, y, w, h, fill_color, fill_opa, radius, border_color, border_width
+    CANVAS_CMD_LINE = 3,     // x1, y1, x2, y2, color, width, opa
+    CANVAS_CMD_POLYLINE = 4, // color, width, opa, n, x1, y1, ... xn, yn
+    CANVAS_CMD_TEXT = 5,     // x, y, max_w（<=0到右边界）, color, align（0左 1中 2右）, text
+    CANVAS_CMD_FONT = 6,     // spec（"路径#字号#风格"），之后的文字使用该字体
+    CANVAS_CMD_IMAGE = 7,    // x, y, zoom（256原始大小）, opa, src
+    CANVAS_CMD_ARC = 8,      // cx, cy, r, start_angle, end_angle（度，0为右侧，顺时针）, color, width, opa
+};
+
+// 在当前屏幕上创建画布，alpha非0时背景可透明（逐像素混合，绘制较慢）；返回画布编号，-1表示不支持或内存不足
+int lvgl_canvas_create(int x, int y, int width, int height, int alpha);
+void lvgl_canvas_destroy(int id);
+
+// 执行 count 个 int32 的命令并显示，返回执行的命令数；格式错误返回-1，屏幕保持上一帧
+int lvgl_canvas_flush(int id, const int32_t *cmds, int count, const char *strings, int strings_len);
+
+int lvgl_canvas_set_visible(int id, int visible);
+int lvgl_canvas_set_pos(int id, int x, int y);
+
+// 页面：每个页面是一个独立的LVGL屏幕，提前建好，切换时只加载屏幕（可带切换动画）。页面 0 为初始屏幕；
+// 共享对象跟随当前页面，放在页面自身对象之下。以下接口均需在LVGL线程（JS主线程）中调用
+
+// 创建空页面，返回页面编号，-1表示不支持或数量已满
+int lvgl_page_create(void);
+
+// 删除页面及其中全部对象，不能删除初始页面和当前页面
+void lvgl_page_destroy(int id);
+
+// 把对象（lvgl_obj_capture_end 返回的句柄）移到页面中，background非0时放在页面其他对象之下
+int lvgl_page_adopt(int id, int target, int background);
+
+// 把对象设为各页面共享的对象：切换时移到新页面的最底层，回到初始页面时放回原层次
+int lvgl_page_share(int target);
+
+// 切换页面，anim为 lv_scr_load_anim_t（0无动画），time为动画时长ms
+int lvgl_page_load(int id, int anim, int time);
+
+// 当前页面编号
+int lvgl_page_current(void);
+
+// 页面中的对象数（含子对象，不含共享对象）
+int lvgl_page_widget_count(int id);
+
+#endif // LVGL_WRAPPER_H
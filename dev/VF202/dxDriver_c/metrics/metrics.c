@@ -0,0 +1,301 @@
+#include "metrics.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define METRICS_MAGIC 0x4d455452 // "METR"
+
+// 共享内存布局，app 与 webserver 使用同一份定义，修改后需同时更新两边
+struct metric_slot
+{
+    char name[METRICS_NAME_LEN];
+    char help[METRICS_HELP_LEN];
+    int32_t type;
+    int32_t reserved;
+    int64_t value;
+};
+
+struct metrics_shm
+{
+    uint32_t magic;
+    uint32_t count; // 已注册个数，槽位内容写完后再原子递增，读端只读 count 以内的槽位
+    int32_t writer_pid;
+    int32_t reserved;
+    struct metric_slot slots[METRICS_MAX];
+};
+
+static pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct metrics_shm *g_shm = NULL;
+static int g_attach_failed = 0;
+
+static struct metrics_shm *attach(int writable)
+{
+    int fd = shm_open(METRICS_SHM_NAME, writable ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+    if (writable && ftruncate(fd, sizeof(struct metrics_shm)) != 0)
+    {
+        close(fd);
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(struct metrics_shm))
+    {
+        close(fd);
+        return NULL;
+    }
+    void *addr = mmap(NULL, sizeof(struct metrics_shm), writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    return addr == MAP_FAILED ? NULL : (struct metrics_shm *)addr;
+}
+
+// 写端首次使用时映射共享内存；上一个写入进程已退出（如 app 重启）时清空旧指标
+static struct metrics_shm *writer_locked(void)
+{
+    if (g_shm || g_attach_failed)
+    {
+        return g_shm;
+    }
+    struct metrics_shm *shm = attach(1);
+    if (!shm)
+    {
+        printf("metrics: 共享内存 %s 映射失败: %s\n", METRICS_SHM_NAME, strerror(errno));
+        g_attach_failed = 1;
+        return NULL;
+    }
+    int pid = getpid();
+    int owner = shm->writer_pid;
+    if (shm->magic != METRICS_MAGIC || (owner != pid && (owner <= 0 || kill(owner, 0) != 0)))
+    {
+        __atomic_store_n(&shm->count, 0, __ATOMIC_RELEASE);
+        memset(shm->slots, 0, sizeof(shm->slots));
+        shm->magic = METRICS_MAGIC;
+        shm->writer_pid = pid;
+    }
+    g_shm = shm;
+    return g_shm;
+}
+
+int metrics_register(const char *name, int type, const char *help)
+{
+    if (!name || !name[0] || strlen(name) >= METRICS_NAME_LEN)
+    {
+        return -1;
+    }
+    pthread_mutex_lock(&g_mutex);
+    struct metrics_shm *shm = writer_locked();
+    int id = -1;
+    if (shm)
+    {
+        uint32_t count = __atomic_load_n(&shm->count, __ATOMIC_ACQUIRE);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (strcmp(shm->slots[i].name, name) == 0)
+            {
+                id = i;
+                break;
+            }
+        }
+        if (id < 0 && count < METRICS_MAX)
+        {
+            struct metric_slot *slot = &shm->slots[count];
+            memset(slot, 0, sizeof(*slot));
+            strncpy(slot->name, name, METRICS_NAME_LEN - 1);
+            strncpy(slot->help, help ? help : "", METRICS_HELP_LEN - 1);
+            slot->type = type == METRIC_GAUGE ? METRIC_GAUGE : METRIC_COUNTER;
+            __atomic_store_n(&shm->count, count + 1, __ATOMIC_RELEASE);
+            id = count;
+        }
+    }
+    pthread_mutex_unlock(&g_mutex);
+    return id;
+}
+
+static int64_t *value_ptr(int id)
+{
+    // g_shm 在注册成功后才会非空，编号有效说明已经映射
+    struct metrics_shm *shm = __atomic_load_n(&g_shm, __ATOMIC_ACQUIRE);
+    if (!shm || id < 0 || id >= METRICS_MAX)
+    {
+        return NULL;
+    }
+    return &shm->slots[id].value;
+}
+
+void metrics_add(int id, int64_t delta)
+{
+    int64_t *value = value_ptr(id);
+    if (value)
+    {
+        __atomic_fetch_add(value, delta, __ATOMIC_RELAXED);
+    }
+}
+
+void metrics_set(int id, int64_t value)
+{
+    int64_t *ptr = value_ptr(id);
+    if (ptr)
+    {
+        __atomic_store_n(ptr, value, __ATOMIC_RELAXED);
+    }
+}
+
+int64_t metrics_get(int id)
+{
+    int64_t *value = value_ptr(id);
+    return value ? __atomic_load_n(value, __ATOMIC_RELAXED) : 0;
+}
+
+// ---------------- 输出 ----------------
+
+struct writer
+{
+    char *buf;
+    size_t size;
+    size_t len;
+    int full;
+};
+
+// 整行写入，放不下时丢弃该行及之后的内容
+static void emit(struct writer *w, const char *fmt, ...)
+{
+    if (w->full)
+    {
+        return;
+    }
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(w->buf + w->len, w->size - w->len, fmt, ap);
+    va_end(ap);
+    if (n < 0 || (size_t)n >= w->size - w->len)
+    {
+        w->buf[w->len] = '\0';
+        w->full = 1;
+        return;
+    }
+    w->len += n;
+}
+
+static size_t base_len(const char *name)
+{
+    const char *brace = strchr(name, '{');
+    return brace ? (size_t)(brace - name) : strlen(name);
+}
+
+// 读取 /proc 文件中 key 对应的 kB 数值，返回字节数，-1表示未找到
+static long long read_kb(const char *path, const char *key)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+    {
+        return -1;
+    }
+    char line[128];
+    size_t key_len = strlen(key);
+    long long value = -1;
+    while (fgets(line, sizeof(line), fp))
+    {
+        if (strncmp(line, key, key_len) == 0 && line[key_len] == ':')
+        {
+            value = strtoll(line + key_len + 1, NULL, 10) * 1024;
+            break;
+        }
+    }
+    fclose(fp);
+    return value;
+}
+
+static void emit_system(struct writer *w, int writer_pid)
+{
+    if (writer_pid > 0)
+    {
+        char path[32];
+        snprintf(path, sizeof(path), "/proc/%d/status", writer_pid);
+        long long rss = read_kb(path, "VmRSS");
+        if (rss >= 0)
+        {
+            emit(w, "# HELP process_resident_memory_bytes app 进程常驻内存\n# TYPE process_resident_memory_bytes gauge\n");
+            emit(w, "process_resident_memory_bytes %lld\n", rss);
+        }
+    }
+    long long total = read_kb("/proc/meminfo", "MemTotal");
+    long long available = read_kb("/proc/meminfo", "MemAvailable");
+    if (total >= 0)
+    {
+        emit(w, "# HELP system_memory_total_bytes 系统总内存\n# TYPE system_memory_total_bytes gauge\n");
+        emit(w, "system_memory_total_bytes %lld\n", total);
+    }
+    if (available >= 0)
+    {
+        emit(w, "# HELP system_memory_available_bytes 系统可用内存\n# TYPE system_memory_available_bytes gauge\n");
+        emit(w, "system_memory_available_bytes %lld\n", available);
+    }
+}
+
+int metrics_render(char *buf, size_t size)
+{
+    if (!buf || size == 0)
+    {
+        return 0;
+    }
+    buf[0] = '\0';
+    struct writer w = {.buf = buf, .size = size, .len = 0, .full = 0};
+
+    // 读端每次重新映射，app 重启后也能读到新的内容
+    struct metrics_shm *shm = attach(0);
+    int writer_pid = 0;
+    if (shm && shm->magic == METRICS_MAGIC)
+    {
+        writer_pid = shm->writer_pid;
+        uint32_t count = __atomic_load_n(&shm->count, __ATOMIC_ACQUIRE);
+        if (count > METRICS_MAX)
+        {
+            count = METRICS_MAX;
+        }
+        // 同名不同标签的指标是同一个指标族，文本格式要求同族的样本连续、只有一组说明和类型；
+        // 注册顺序可能交替（如按标签逐个注册两个指标），按族分组输出
+        for (uint32_t i = 0; i < count; i++)
+        {
+            const struct metric_slot *slot = &shm->slots[i];
+            size_t len = base_len(slot->name);
+            int first = 1;
+            for (uint32_t j = 0; j < i && first; j++)
+            {
+                first = !(base_len(shm->slots[j].name) == len && strncmp(shm->slots[j].name, slot->name, len) == 0);
+            }
+            if (!first)
+            {
+                continue;
+            }
+            if (slot->help[0])
+            {
+                emit(&w, "# HELP %.*s %s\n", (int)len, slot->name, slot->help);
+            }
+            emit(&w, "# TYPE %.*s %s\n", (int)len, slot->name, slot->type == METRIC_GAUGE ? "gauge" : "counter");
+            for (uint32_t k = i; k < count; k++)
+            {
+                const struct metric_slot *sample = &shm->slots[k];
+                if (base_len(sample->name) == len && strncmp(sample->name, slot->name, len) == 0)
+                {
+                    emit(&w, "%s %lld\n", sample->name, (long long)__atomic_load_n(&sample->value, __ATOMIC_RELAXED));
+                }
+            }
+        }
+    }
+    if (shm)
+    {
+        munmap(shm, sizeof(struct metrics_shm));
+    }
+    emit_system(&w, writer_pid);
+    return (int)w.len;
+}
@@ -0,0 +1,52 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 运行指标：app 进程内各 wrapper 和 JS 模块通过原子计数更新，数据放在共享内存中，
+// webserver 进程只读并按 Prometheus 文本格式输出（/metrics），两个进程之间不需要任何通信
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define METRICS_SHM_NAME "/dejaos_metrics"
+#define METRICS_MAX 128
+#define METRICS_NAME_LEN 64
+#define METRICS_HELP_LEN 96
+
+enum metric_type
+{
+    METRIC_COUNTER = 0, // 只增不减
+    METRIC_GAUGE = 1,   // 当前值
+};
+
+/**
+ * @brief 注册指标，同名指标返回已有编号；名称可带标签，如 mqtt_rx_messages_total{queue="rx"}
+ *
+ * @param name 指标名
+ * @param type metric_type
+ * @param help 说明，同名不同标签的指标只输出第一个的说明
+ *
+ * @return 指标编号（>=0），-1表示共享内存不可用或指标数已满
+ */
+int metrics_register(const char *name, int type, const char *help);
+
+// 以下接口编号无效时忽略，均为无锁原子操作，可在任意线程调用
+void metrics_add(int id, int64_t delta);
+void metrics_set(int id, int64_t value);
+int64_t metrics_get(int id);
+
+/**
+ * @brief 按 Prometheus 文本格式（0.0.4）输出全部指标，另附写入进程的常驻内存和系统可用内存
+ *
+ * @return 输出长度，缓冲区不足时截断到最后一个完整行；共享内存不存在时只输出系统内存
+ */
+int metrics_render(char *buf, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // METRICS_H
@@ -1,5 +1,6 @@
 #include "mqtt_wrapper.h"
 #include "MQTTAsync.h"
+#include "../metrics/metrics.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -57,6 +58,21 @@ struct mqtt_client {
 static struct mqtt_client* g_mqtt_client = NULL;
 static pthread_mutex_t g_client_mutex = PTHREAD_MUTEX_INITIALIZER;
 
+// 运行指标编号，创建客户端时注册
+static int g_metric_rx_depth = -1;
+static int g_metric_rx_total = -1;
+static int g_metric_rx_dropped = -1;
+static int g_metric_tx_total = -1;
+static int g_metric_tx_failed = -1;
+
+static void register_metrics(void) {
+    g_metric_rx_depth = metrics_register("mqtt_rx_queue_depth", METRIC_GAUGE, "MQTT 接收队列中待取出的消息数");
+    g_metric_rx_total = metrics_register("mqtt_rx_messages_total", METRIC_COUNTER, "MQTT 收到的消息数");
+    g_metric_rx_dropped = metrics_register("mqtt_rx_dropped_total", METRIC_COUNTER, "MQTT 接收队列满而丢弃的消息数");
+    g_metric_tx_total = metrics_register("mqtt_tx_messages_total", METRIC_COUNTER, "MQTT 提交发送的消息数");
+    g_metric_tx_failed = metrics_register("mqtt_tx_failed_total", METRIC_COUNTER, "MQTT 提交发送失败的消息数");
+}
+
 // 内部回调函数
 static int message_arrived(void* context, char* topicName, int topicLen, MQTTAsync_message* message) {
     struct mqtt_client* client = (struct mqtt_client*)context;
@@ -93,10 +109,13 @@ static int message_arrived(void* context, char* topicName, int topicLen, MQTTAsy
             // 更新队列
             client->message_queue_tail = (client->message_queue_tail + 1) % MAX_MESSAGE_QUEUE;
             client->message_queue_count++;
+            metrics_set(g_metric_rx_depth, client->message_queue_count);
         } else {
             // 队列已满，丢弃消息但需要释放可能已分配的内存
             // 注意：这里不需要释放内存，因为队列满时不会分配新内存
+            metrics_add(g_metric_rx_dropped, 1);
         }
+        metrics_add(g_metric_rx_total, 1);
         
         pthread_mutex_unlock(&client->message_mutex);
     }
@@ -197,6 +216,7 @@ int mqtt_create_client(const char* client_id) {
     }
     
     memset(g_mqtt_client, 0, sizeof(struct mqtt_client));
+    register_metrics();
     strncpy(g_mqtt_client->client_id, client_id, MAX_CLIENT_ID_LEN - 1);
     g_mqtt_client->client_id[MAX_CLIENT_ID_LEN - 1] = '\0';
     g_mqtt_client->status = MQTT_STATUS_DISCONNECTED;
@@ -417,6 +437,7 @@ int mqtt_publish(const char* topic, const char* payload,
     
     int rc = MQTTAsync_send(g_mqtt_client->paho_client, topic, (payload_len > 0) ? payload_len : (int)strlen(payload),
                             payload, qos, retained, &opts);
+    metrics_add(rc == MQTTASYNC_SUCCESS ? g_metric_tx_total : g_metric_tx_failed, 1);
     return rc;
 }
 
@@ -538,6 +559,7 @@ void mqtt_destroy_client(void) {
             free(g_mqtt_client->message_queue[idx].payload);
         }
     }
+    metrics_set(g_metric_rx_depth, 0);
     pthread_mutex_unlock(&g_mqtt_client->message_mutex);
     
     // 销毁互斥锁
@@ -570,6 +592,7 @@ int mqtt_receive_message(mqtt_message_t* message) {
     // 更新队列
     g_mqtt_client->message_queue_head = (g_mqtt_client->message_queue_head + 1) % MAX_MESSAGE_QUEUE;
     g_mqtt_client->message_queue_count--;
+    metrics_set(g_metric_rx_depth, g_mqtt_client->message_queue_count);
     
     pthread_mutex_unlock(&g_mqtt_client->message_mutex);
     return 1; // 有消息
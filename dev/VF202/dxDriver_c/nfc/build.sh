@@ -0,0 +1,3 @@
+/home/dxl/.toolchains/arm-gcc550/arm-gcc550-glibc221-sv80x/bin/arm-linux-gnueabihf-gcc -Wall -Wextra -fPIC -shared -O3 -o /home/dxl/dxInside/dejaos/dev/VF202/dxDriver_c/nfc/libnfc_wrapper.so /home/dxl/dxInside/dejaos/dev/VF202/dxDriver_c/nfc/nfc_wrapper.c /home/dxl/dxInside/dejaos/dev/VF202/dxDriver_c/nfc/credential.c -pthread -ldl -lgpio_wrapper -lvbar-m-common -lvbar-drv-gpio -lsqlite3 -I/home/dxl/dxInside/dejaos/dev/VF202/driver/include -I/home/dxl/dxInside/dejaos/dev/VF202/driver/include/thirdlib -L/home/dxl/dxInside/dejaos/dev/VF202/os/driver
+
+cp /home/dxl/dxInside/dejaos/dev/VF202/dxDriver_c/nfc/libnfc_wrapper.so /home/dxl/dxInside/dejaos/dev/VF202/os/driver
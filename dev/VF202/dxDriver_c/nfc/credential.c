@@ -0,0 +1,435 @@
+#include "credential.h"
+#include <sqlite/sqlite3.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#define DB_BUSY_TIMEOUT_MS 3000 // 应用同时在写数据库，忙时等待
+
+struct permission_rule
+{
+    char id[CREDENTIAL_ID_LEN];
+    int time_type;
+    int64_t begin_time;
+    int64_t end_time;
+    int64_t repeat_begin;
+    int64_t repeat_end;
+    char *period;
+    struct permission_rule *next;
+};
+
+// 同一用户的权限按数据库中的顺序排列，判定时取第一条有效的
+struct user_rules
+{
+    char user_id[CREDENTIAL_ID_LEN];
+    struct permission_rule *head;
+    struct permission_rule *tail;
+    struct user_rules *next;
+};
+
+struct credential_entry
+{
+    char code[CREDENTIAL_CODE_LEN];
+    char id[CREDENTIAL_ID_LEN];
+    char user_id[CREDENTIAL_ID_LEN];
+    int64_t expires_at;
+    struct user_rules *user; // 为NULL表示用户无任何权限
+    struct credential_entry *next;
+};
+
+struct credential_table
+{
+    uint32_t bucket_count;
+    struct credential_entry **buckets;
+    struct user_rules **user_buckets;
+    int count;
+};
+
+static struct credential_table *g_table = NULL;
+static pthread_rwlock_t g_table_lock = PTHREAD_RWLOCK_INITIALIZER;
+
+// FNV-1a
+static uint32_t hash_string(const char *str)
+{
+    uint32_t hash = 2166136261u;
+    for (; *str; str++)
+    {
+        hash ^= (uint8_t)*str;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void copy_text(char *dst, size_t size, const unsigned char *src)
+{
+    snprintf(dst, size, "%s", src ? (const char *)src : "");
+}
+
+static struct user_rules *find_user(struct credential_table *table, const char *user_id)
+{
+    struct user_rules *user = table->user_buckets[hash_string(user_id) % table->bucket_count];
+    for (; user; user = user->next)
+    {
+        if (strcmp(user->user_id, user_id) == 0)
+        {
+            return user;
+        }
+    }
+    return NULL;
+}
+
+static void table_free(struct credential_table *table)
+{
+    if (!table)
+    {
+        return;
+    }
+    for (uint32_t i = 0; i < table->bucket_count; i++)
+    {
+        struct credential_entry *entry = table->buckets[i];
+        while (entry)
+        {
+            struct credential_entry *next = entry->next;
+            free(entry);
+            entry = next;
+        }
+        struct user_rules *user = table->user_buckets[i];
+        while (user)
+        {
+            struct user_rules *next_user = user->next;
+            struct permission_rule *rule = user->head;
+            while (rule)
+            {
+                struct permission_rule *next_rule = rule->next;
+                free(rule->period);
+                free(rule);
+                rule = next_rule;
+            }
+            free(user);
+            user = next_user;
+        }
+    }
+    free(table->buckets);
+    free(table->user_buckets);
+    free(table);
+}
+
+static int load_permissions(sqlite3 *db, struct credential_table *table)
+{
+    sqlite3_stmt *stmt = NULL;
+    const char *sql = "SELECT id, userId, timeType, beginTime, endTime, repeatBeginTime, repeatEndTime, period "
+                      "FROM ac_permission WHERE status = 1 ORDER BY rowid";
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        printf("查询权限失败: %s\n", sqlite3_errmsg(db));
+        return -1;
+    }
+    int ret = 0;
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        const char *user_id = (const char *)sqlite3_column_text(stmt, 1);
+        if (!user_id)
+        {
+            continue;
+        }
+        struct user_rules *user = find_user(table, user_id);
+        if (!user)
+        {
+            user = calloc(1, sizeof(*user));
+            if (!user)
+            {
+                ret = -1;
+                break;
+            }
+            copy_text(user->user_id, sizeof(user->user_id), (const unsigned char *)user_id);
+            uint32_t index = hash_string(user->user_id) % table->bucket_count;
+            user->next = table->user_buckets[index];
+            table->user_buckets[index] = user;
+        }
+        struct permission_rule *rule = calloc(1, sizeof(*rule));
+        if (!rule)
+        {
+            ret = -1;
+            break;
+        }
+        copy_text(rule->id, sizeof(rule->id), sqlite3_column_text(stmt, 0));
+        rule->time_type = sqlite3_column_int(stmt, 2);
+        rule->begin_time = sqlite3_column_int64(stmt, 3);
+        rule->end_time = sqlite3_column_int64(stmt, 4);
+        rule->repeat_begin = sqlite3_column_int64(stmt, 5);
+        rule->repeat_end = sqlite3_column_int64(stmt, 6);
+        if (sqlite3_column_type(stmt, 7) != SQLITE_NULL)
+        {
+            rule->period = strdup((const char *)sqlite3_column_text(stmt, 7));
+        }
+        if (user->tail)
+        {
+            user->tail->next = rule;
+        }
+        else
+        {
+            user->head = rule;
+        }
+        user->tail = rule;
+    }
+    sqlite3_finalize(stmt);
+    return ret;
+}
+
+static int load_credentials(sqlite3 *db, struct credential_table *table, int type)
+{
+    sqlite3_stmt *stmt = NULL;
+    const char *sql = "SELECT id, userId, code, expires_at FROM ac_credential "
+                      "WHERE type = ? AND status = 1 ORDER BY rowid";
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        printf("查询凭证失败: %s\n", sqlite3_errmsg(db));
+        return -1;
+    }
+    sqlite3_bind_int(stmt, 1, type);
+    int ret = 0;
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        const char *code = (const char *)sqlite3_column_text(stmt, 2);
+        if (!code || !*code || strlen(code) >= CREDENTIAL_CODE_LEN)
+        {
+            continue;
+        }
+        uint32_t index = hash_string(code) % table->bucket_count;
+        // 凭证值重复时与数据库查询一致，保留最先插入的一条
+        int exists = 0;
+        for (struct credential_entry *entry = table->buckets[index]; entry; entry = entry->next)
+        {
+            if (strcmp(entry->code, code) == 0)
+            {
+                exists = 1;
+                break;
+            }
+        }
+        if (exists)
+        {
+            continue;
+        }
+        struct credential_entry *entry = calloc(1, sizeof(*entry));
+        if (!entry)
+        {
+            ret = -1;
+            break;
+        }
+        copy_text(entry->code, sizeof(entry->code), (const unsigned char *)code);
+        copy_text(entry->id, sizeof(entry->id), sqlite3_column_text(stmt, 0));
+        copy_text(entry->user_id, sizeof(entry->user_id), sqlite3_column_text(stmt, 1));
+        entry->expires_at = sqlite3_column_int64(stmt, 3);
+        entry->user = find_user(table, entry->user_id);
+        entry->next = table->buckets[index];
+        table->buckets[index] = entry;
+        table->count++;
+    }
+    sqlite3_finalize(stmt);
+    return ret;
+}
+
+static uint32_t count_rows(sqlite3 *db, int type)
+{
+    sqlite3_stmt *stmt = NULL;
+    uint32_t count = 0;
+    if (sqlite3_prepare_v2(db, "SELECT COUNT(*) FROM ac_credential WHERE type = ? AND status = 1", -1, &stmt, NULL) == SQLITE_OK)
+    {
+        sqlite3_bind_int(stmt, 1, type);
+        if (sqlite3_step(stmt) == SQLITE_ROW)
+        {
+            count = sqlite3_column_int(stmt, 0);
+        }
+    }
+    sqlite3_finalize(stmt);
+    return count;
+}
+
+int credential_table_load(const char *db_path, int type)
+{
+    sqlite3 *db = NULL;
+    if (sqlite3_open_v2(db_path, &db, SQLITE_OPEN_READONLY, NULL) != SQLITE_OK)
+    {
+        printf("打开数据库失败: %s\n", db ? sqlite3_errmsg(db) : db_path);
+        sqlite3_close(db);
+        return -1;
+    }
+    sqlite3_busy_timeout(db, DB_BUSY_TIMEOUT_MS);
+
+    struct credential_table *table = calloc(1, sizeof(*table));
+    if (!table)
+    {
+        sqlite3_close(db);
+        return -1;
+    }
+    // 桶数取凭证数的两倍，保持链表很短
+    table->bucket_count = count_rows(db, type) * 2 + 64;
+    table->buckets = calloc(table->bucket_count, sizeof(*table->buckets));
+    table->user_buckets = calloc(table->bucket_count, sizeof(*table->user_buckets));
+    if (!table->buckets || !table->user_buckets ||
+        load_permissions(db, table) != 0 || load_credentials(db, table, type) != 0)
+    {
+        table_free(table);
+        sqlite3_close(db);
+        return -1;
+    }
+    sqlite3_close(db);
+
+    pthread_rwlock_wrlock(&g_table_lock);
+    struct credential_table *old = g_table;
+    g_table = table;
+    pthread_rwlock_unlock(&g_table_lock);
+    table_free(old);
+
+    printf("凭证表加载完成: 类型%d 共%d条\n", type, table->count);
+    return table->count;
+}
+
+// 在 period（{"1":"08:00-12:00|14:00-18:00", ...}）中查找指定星期的时间段，slots 为空表示当天无权限
+static int find_week_slots(const char *period, int weekday, char *slots, size_t size)
+{
+    char key[8];
+    snprintf(key, sizeof(key), "\"%d\"", weekday);
+    const char *p = period ? strstr(period, key) : NULL;
+    if (!p)
+    {
+        return -1;
+    }
+    p += strlen(key);
+    while (*p == ' ' || *p == ':')
+    {
+        p++;
+    }
+    if (*p != '"')
+    {
+        return -1;
+    }
+    const char *end = strchr(++p, '"');
+    if (!end || (size_t)(end - p) >= size)
+    {
+        return -1;
+    }
+    memcpy(slots, p, end - p);
+    slots[end - p] = '\0';
+    return 0;
+}
+
+static int time_in_slots(char *slots, int time_of_day)
+{
+    char *save = NULL;
+    for (char *slot = strtok_r(slots, "|", &save); slot; slot = strtok_r(NULL, "|", &save))
+    {
+        int sh, sm, eh, em;
+        if (sscanf(slot, "%d:%d-%d:%d", &sh, &sm, &eh, &em) != 4)
+        {
+            continue;
+        }
+        int start = sh * 3600 + sm * 60;
+        int end = eh * 3600 + em * 60;
+        // 结束早于开始表示跨天
+        if (end < start ? (time_of_day >= start || time_of_day <= end) : (time_of_day >= start && time_of_day <= end))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// 与 timePermission.js 相同的时间规则
+static int rule_allows(const struct permission_rule *rule, time_t now, const struct tm *tm)
+{
+    // 当日零点到当前时间的秒数，精确到分钟
+    int time_of_day = tm->tm_hour * 3600 + tm->tm_min * 60;
+    int weekday = tm->tm_wday ? tm->tm_wday : 7;
+
+    if (rule->time_type == 0)
+    {
+        return 1;
+    }
+    if (rule->time_type < 0 || rule->time_type > 3 || !rule->begin_time || !rule->end_time ||
+        now < rule->begin_time || now > rule->end_time)
+    {
+        return 0;
+    }
+    switch (rule->time_type)
+    {
+    case 1:
+        return 1;
+    case 2:
+        return time_of_day >= rule->repeat_begin && time_of_day <= rule->repeat_end;
+    case 3:
+    {
+        char slots[256];
+        if (find_week_slots(rule->period, weekday, slots, sizeof(slots)) != 0)
+        {
+            return 0;
+        }
+        return time_in_slots(slots, time_of_day);
+    }
+    }
+    return 0;
+}
+
+void credential_table_lookup(const char *code, time_t now, struct credential_match_t *match)
+{
+    memset(match, 0, sizeof(*match));
+    match->result = CREDENTIAL_RESULT_REJECT;
+    match->reason = CREDENTIAL_REASON_NOT_FOUND;
+
+    struct tm tm;
+    localtime_r(&now, &tm);
+
+    pthread_rwlock_rdlock(&g_table_lock);
+    struct credential_entry *entry = NULL;
+    if (g_table)
+    {
+        entry = g_table->buckets[hash_string(code) % g_table->bucket_count];
+        while (entry && strcmp(entry->code, code) != 0)
+        {
+            entry = entry->next;
+        }
+    }
+    if (entry && !(entry->expires_at && entry->expires_at < now))
+    {
+        snprintf(match->credential_id, sizeof(match->credential_id), "%s", entry->id);
+        snprintf(match->user_id, sizeof(match->user_id), "%s", entry->user_id);
+        if (!entry->user)
+        {
+            match->reason = CREDENTIAL_REASON_NO_PERMISSION;
+        }
+        else
+        {
+            match->result = CREDENTIAL_RESULT_DENY;
+            match->reason = CREDENTIAL_REASON_OUT_OF_TIME;
+            for (struct permission_rule *rule = entry->user->head; rule; rule = rule->next)
+            {
+                if (rule_allows(rule, now, &tm))
+                {
+                    match->result = CREDENTIAL_RESULT_ALLOW;
+                    match->reason = CREDENTIAL_REASON_OK;
+                    snprintf(match->permission_id, sizeof(match->permission_id), "%s", rule->id);
+                    break;
+                }
+            }
+        }
+    }
+    pthread_rwlock_unlock(&g_table_lock);
+}
+
+int credential_table_count(void)
+{
+    pthread_rwlock_rdlock(&g_table_lock);
+    int count = g_table ? g_table->count : 0;
+    pthread_rwlock_unlock(&g_table_lock);
+    return count;
+}
+
+void credential_table_free(void)
+{
+    pthread_rwlock_wrlock(&g_table_lock);
+    struct credential_table *old = g_table;
+    g_table = NULL;
+    pthread_rwlock_unlock(&g_table_lock);
+    table_free(old);
+}
@@ -0,0 +1,66 @@
+#ifndef __NFC_CREDENTIAL_H__
+#define __NFC_CREDENTIAL_H__
+
+#include <stdint.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CREDENTIAL_ID_LEN 40
+#define CREDENTIAL_CODE_LEN 64
+
+// 与 dxAccess 的验证结果一致：1-成功，0-当前时间无权限，-1-拒绝
+#define CREDENTIAL_RESULT_ALLOW 1
+#define CREDENTIAL_RESULT_DENY 0
+#define CREDENTIAL_RESULT_REJECT -1
+
+// 拒绝原因
+enum credential_reason
+{
+    CREDENTIAL_REASON_OK = 0,
+    CREDENTIAL_REASON_NOT_FOUND = 1,     // 凭证不存在或已失效
+    CREDENTIAL_REASON_NO_PERMISSION = 2, // 用户无任何权限
+    CREDENTIAL_REASON_OUT_OF_TIME = 3,   // 当前时间无权限
+};
+
+struct credential_match_t
+{
+    int result;
+    int reason;
+    char credential_id[CREDENTIAL_ID_LEN];
+    char user_id[CREDENTIAL_ID_LEN];
+    char permission_id[CREDENTIAL_ID_LEN];
+};
+
+/**
+ * @brief 从数据库加载指定类型的有效凭证及其用户权限，建好新表后整体替换旧表
+ *
+ * @param db_path 数据库路径
+ * @param type 凭证类型（卡片为200）
+ *
+ * @return 加载的凭证个数，失败返回-1（旧表保持不变）
+ */
+int credential_table_load(const char *db_path, int type);
+
+/**
+ * @brief 按凭证值查表并按权限时间规则判定，规则与 dxAccess 的 access(type, code) 一致
+ *
+ * @param code 凭证值，与数据库查询一致区分大小写
+ * @param now 当前时间（Unix时间戳）
+ * @param match 判定结果
+ */
+void credential_table_lookup(const char *code, time_t now, struct credential_match_t *match);
+
+// 当前表中的凭证个数
+int credential_table_count(void);
+
+// 释放凭证表
+void credential_table_free(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
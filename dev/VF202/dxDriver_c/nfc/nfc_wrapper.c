@@ -0,0 +1,534 @@
+#include "nfc_wrapper.h"
+#include "credential.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sqlite/sqlite3.h>
+#include <dlfcn.h>
+#include <peripheral/nfc.h>
+#include <common/spi.h>
+#include <drivers/gpio.h>
+#include "../gpio/gpio_wrapper.h"
+#include <board/board.h>
+
+// NFC芯片挂在SPI上
+#define NFC_SPI_PATH "/dev/spidev1.0"
+#define NFC_SPI_SPEED_HZ 5000000
+#define NFC_SPI_BUF_SIZE 512
+
+// 卡片凭证类型，与 AccessControlDB.CREDENTIAL_TYPES.CARD 一致
+#define NFC_CREDENTIAL_TYPE_CARD 200
+#define NFC_CALLBACK_NAME "nfc_wrapper"
+// NFC协议模块不是所有固件都带，初始化时加载，没有时刷卡功能不可用
+#define NFC_LIB_PATH "/os/driver/libvbar-p-nfc.so"
+// JS取走之前最多缓存的刷卡结果数
+#define NFC_RESULT_QUEUE_SIZE 32
+
+static struct nfc_options_t g_options = {
+    .debounce_ms = 1500,
+    .relay_ms = 2000,
+    .reload_interval_ms = 2000,
+};
+
+static struct vbar_p_nfc_handle *g_nfc = NULL;
+static int g_spi_fd = -1;
+static char g_db_path[256] = {0};
+
+static pthread_t g_worker;
+static int g_worker_running = 0;
+static pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_cond;
+
+// 去抖：上一次处理的卡号及最后读到的时刻
+static uint8_t g_last_id[0x10];
+static uint16_t g_last_id_len = 0;
+static uint64_t g_last_read_ms = 0;
+
+struct result_slot
+{
+    struct nfc_result_t result;
+    char code[CREDENTIAL_CODE_LEN];
+    char credential_id[CREDENTIAL_ID_LEN];
+    char user_id[CREDENTIAL_ID_LEN];
+    char permission_id[CREDENTIAL_ID_LEN];
+};
+static struct result_slot g_results[NFC_RESULT_QUEUE_SIZE];
+static unsigned int g_result_head = 0;
+static unsigned int g_result_count = 0;
+static unsigned int g_result_seq = 0;
+
+static struct nfc_stats_t g_stats = {0};
+
+static uint64_t monotonic_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// ---------------- 主控操作（SPI、GPIO） ----------------
+
+static void host_gpio_ctrl(struct vbar_nfc_host_ops *ops, uintptr_t gpio, int val)
+{
+    (void)ops;
+    vbar_drv_gpio_set_func(gpio, val ? GPIO_OUTPUT1 : GPIO_OUTPUT0);
+}
+
+static void host_delay_us(uint32_t us)
+{
+    usleep(us);
+}
+
+static void host_delay_ms(uint32_t ms)
+{
+    usleep(ms * 1000);
+}
+
+// SPI全双工收发，tx为NULL时发送0，rx为NULL时丢弃收到的数据
+static int host_exchange(struct vbar_nfc_host_ops *ops, const uint8_t *tx, uint32_t tlen, uint8_t *rx, uint32_t rlen)
+{
+    (void)ops;
+    uint8_t tx_stack[NFC_SPI_BUF_SIZE];
+    uint8_t rx_stack[NFC_SPI_BUF_SIZE];
+    uint32_t len = tlen > rlen ? tlen : rlen;
+    uint8_t *tbuf = len <= NFC_SPI_BUF_SIZE ? tx_stack : malloc(len);
+    uint8_t *rbuf = len <= NFC_SPI_BUF_SIZE ? rx_stack : malloc(len);
+    int ret = -1;
+    if (tbuf && rbuf)
+    {
+        memset(tbuf, 0, len);
+        if (tx)
+        {
+            memcpy(tbuf, tx, tlen);
+        }
+        if (vbar_spi_exchange(g_spi_fd, 8, NFC_SPI_SPEED_HZ, tbuf, rbuf, len) >= 0)
+        {
+            if (rx)
+            {
+                memcpy(rx, rbuf, rlen);
+            }
+            ret = 0;
+        }
+    }
+    if (tbuf != tx_stack)
+    {
+        free(tbuf);
+    }
+    if (rbuf != rx_stack)
+    {
+        free(rbuf);
+    }
+    return ret;
+}
+
+static int host_read(struct vbar_nfc_host_ops *ops, uint8_t *rx, uint32_t rlen, uint16_t timeout_ms)
+{
+    (void)timeout_ms;
+    return host_exchange(ops, NULL, 0, rx, rlen) == 0 ? (int)rlen : -1;
+}
+
+static int host_write(struct vbar_nfc_host_ops *ops, const uint8_t *tx, uint32_t tlen)
+{
+    return host_exchange(ops, tx, tlen, NULL, 0) == 0 ? (int)tlen : -1;
+}
+
+static void host_flush(struct vbar_nfc_host_ops *ops)
+{
+    (void)ops;
+}
+
+static void host_destroy(struct vbar_nfc_host_ops *ops)
+{
+    (void)ops;
+    if (g_spi_fd >= 0)
+    {
+        vbar_spi_close(g_spi_fd);
+        g_spi_fd = -1;
+    }
+}
+
+static struct vbar_nfc_gpio g_gpio_reset = {VBAR_BOARD_GPIO_NFC_RESET, VBAR_BOARD_GPIO_NFC_RESET_ACTIVE_LEVEL};
+static struct vbar_nfc_gpio g_gpio_standby = {VBAR_BOARD_GPIO_NFC_STANDBY, VBAR_BOARD_GPIO_NFC_STANDBY_ACTIVE_LEVEL};
+
+static struct vbar_nfc_host_ops g_host_ops = {
+    .gpio_ctrl = host_gpio_ctrl,
+    .gpio_reset = &g_gpio_reset,
+    .gpio_mode = NULL,
+    .gpio_standby = &g_gpio_standby,
+    .delay_us = host_delay_us,
+    .delay_ms = host_delay_ms,
+    .read = host_read,
+    .write = host_write,
+    .flush = host_flush,
+    .exchange = host_exchange,
+    .destroy = host_destroy,
+    .psam_ops = NULL,
+    .calcu_authen_id_lock = PTHREAD_MUTEX_INITIALIZER,
+    .calcu_authen_id = NULL,
+    .pdata = NULL,
+};
+
+static struct vbar_nfc_config g_nfc_config = {
+    .ops_config = {
+        .card_protocol = VBAR_NFC_CARD_PROTOCL_ISO14443A | VBAR_NFC_CARD_PROTOCL_ISO14443B,
+        .identity_card_enable = 1,
+        .read_timeout_ms = 100,
+    },
+    .enable = 1,
+    .psam_en = 0,
+    .work_mode = NFC_WORK_MODE_AUTO,
+};
+
+// ---------------- 读卡回调 ----------------
+
+static void push_result_locked(const struct nfc_result_t *result, const char *code, const struct credential_match_t *match)
+{
+    if (g_result_count == NFC_RESULT_QUEUE_SIZE)
+    {
+        // 丢弃最旧的结果
+        g_result_head = (g_result_head + 1) % NFC_RESULT_QUEUE_SIZE;
+        g_result_count--;
+        g_stats.dropped++;
+    }
+    struct result_slot *slot = &g_results[(g_result_head + g_result_count) % NFC_RESULT_QUEUE_SIZE];
+    slot->result = *result;
+    slot->result.seq = ++g_result_seq;
+    snprintf(slot->code, sizeof(slot->code), "%s", code);
+    snprintf(slot->credential_id, sizeof(slot->credential_id), "%s", match->credential_id);
+    snprintf(slot->user_id, sizeof(slot->user_id), "%s", match->user_id);
+    snprintf(slot->permission_id, sizeof(slot->permission_id), "%s", match->permission_id);
+    g_result_count++;
+}
+
+// 驱动线程中回调，不可阻塞：只做查表和GPIO操作，记录与界面交给JS
+static int nfc_card_callback(struct vbar_p_nfc_handle *hdl, const struct vbar_nfc_card_info *cinfo, void *ud)
+{
+    (void)hdl;
+    (void)ud;
+    uint64_t start = monotonic_us();
+    uint64_t now_ms = start / 1000;
+    uint16_t id_len = cinfo->id_len < sizeof(g_last_id) ? cinfo->id_len : sizeof(g_last_id);
+
+    pthread_mutex_lock(&g_mutex);
+    g_stats.reads++;
+    int repeated = id_len == g_last_id_len && memcmp(cinfo->id, g_last_id, id_len) == 0 &&
+                   now_ms - g_last_read_ms < (uint64_t)g_options.debounce_ms;
+    memcpy(g_last_id, cinfo->id, id_len);
+    g_last_id_len = id_len;
+    // 卡片一直放在读卡区时持续刷新，拿开后超过去抖时间才会再次处理
+    g_last_read_ms = now_ms;
+    if (repeated)
+    {
+        g_stats.debounced++;
+        pthread_mutex_unlock(&g_mutex);
+        return 0;
+    }
+    int relay_ms = g_options.relay_ms;
+    pthread_mutex_unlock(&g_mutex);
+
+    // 卡号按大写十六进制字符串查找
+    char code[CREDENTIAL_CODE_LEN];
+    for (uint16_t i = 0; i < id_len; i++)
+    {
+        snprintf(code + i * 2, sizeof(code) - i * 2, "%02X", cinfo->id[i]);
+    }
+    code[id_len * 2] = '\0';
+
+    struct credential_match_t match;
+    credential_table_lookup(code, time(NULL), &match);
+
+    struct nfc_result_t result = {0};
+    result.result = match.result;
+    result.reason = match.reason;
+    result.card_type = cinfo->card_type;
+    result.time = time(NULL);
+
+    // 吸合期间再次刷卡只延长时长，到期由 gpio_wrapper 的定时线程断开
+    if (match.result == CREDENTIAL_RESULT_ALLOW && relay_ms > 0)
+    {
+        result.relay = gpio_pulse(VBAR_BOARD_RELAY_0, relay_ms) == 0;
+    }
+
+    pthread_mutex_lock(&g_mutex);
+    result.latency_us = (uint32_t)(monotonic_us() - start);
+    if (match.result == CREDENTIAL_RESULT_ALLOW)
+    {
+        g_stats.allowed++;
+    }
+    else
+    {
+        g_stats.denied++;
+    }
+    g_stats.last_latency_us = result.latency_us;
+    if (result.latency_us > g_stats.max_latency_us)
+    {
+        g_stats.max_latency_us = result.latency_us;
+    }
+    push_result_locked(&result, code, &match);
+    pthread_mutex_unlock(&g_mutex);
+
+    printf("刷卡: %s 结果%d 原因%d 耗时%uus\n", code, result.result, result.reason, result.latency_us);
+    return 0;
+}
+
+// ---------------- 后台线程：凭证表同步 ----------------
+
+// 凭证变动检测：常驻一个只读连接查询 PRAGMA data_version，其他连接（应用、网页后台）每次提交后都会变化，
+// 不依赖文件修改时间的精度和日志模式；只在 nfc_init 和后台线程中使用
+static sqlite3 *g_watch_db = NULL;
+static int64_t g_data_version = -1;
+
+// 读取数据库版本，失败时关闭连接、下次重新打开并返回-1；重新打开后的版本与之前的不可比较，必然触发一次重载
+static int64_t db_data_version(void)
+{
+    if (!g_watch_db)
+    {
+        if (sqlite3_open_v2(g_db_path, &g_watch_db, SQLITE_OPEN_READONLY, NULL) != SQLITE_OK)
+        {
+            sqlite3_close(g_watch_db);
+            g_watch_db = NULL;
+            return -1;
+        }
+        sqlite3_busy_timeout(g_watch_db, 1000);
+    }
+    int64_t version = -1;
+    sqlite3_stmt *stmt = NULL;
+    if (sqlite3_prepare_v2(g_watch_db, "PRAGMA data_version", -1, &stmt, NULL) == SQLITE_OK &&
+        sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        version = sqlite3_column_int64(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+    if (version < 0)
+    {
+        sqlite3_close(g_watch_db);
+        g_watch_db = NULL;
+    }
+    return version;
+}
+
+static void *nfc_worker(void *arg)
+{
+    (void)arg;
+    uint64_t next_check = monotonic_us() / 1000;
+
+    pthread_mutex_lock(&g_mutex);
+    while (g_worker_running)
+    {
+        uint64_t now = monotonic_us() / 1000;
+        if (g_options.reload_interval_ms > 0 && now >= next_check)
+        {
+            next_check = now + g_options.reload_interval_ms;
+            pthread_mutex_unlock(&g_mutex);
+            int64_t version = db_data_version();
+            if (version != g_data_version)
+            {
+                g_data_version = version;
+                if (version >= 0)
+                {
+                    credential_table_load(g_db_path, NFC_CREDENTIAL_TYPE_CARD);
+                }
+            }
+            pthread_mutex_lock(&g_mutex);
+            continue;
+        }
+
+        // 等到下次检查数据库，修改参数时被唤醒重新计算
+        uint64_t wake = g_options.reload_interval_ms > 0 ? next_check : now + 1000;
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        uint64_t wait_ms = wake > now ? wake - now : 0;
+        ts.tv_sec += wait_ms / 1000;
+        ts.tv_nsec += (wait_ms % 1000) * 1000000;
+        if (ts.tv_nsec >= 1000000000)
+        {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000;
+        }
+        pthread_cond_timedwait(&g_cond, &g_mutex, &ts);
+    }
+    pthread_mutex_unlock(&g_mutex);
+    return NULL;
+}
+
+// ---------------- NFC协议模块 ----------------
+
+// 接口按名字查找，类型取自 nfc.h
+#define NFC_SYM(name) static __typeof__(&name) p_##name = NULL
+#define NFC_LOAD(lib, name) (p_##name = (__typeof__(&name))dlsym(lib, #name))
+
+NFC_SYM(vbar_nfc_init);
+NFC_SYM(vbar_nfc_deinit);
+NFC_SYM(vbar_nfc_cb_register);
+NFC_SYM(vbar_nfc_cb_unregister);
+
+static void *g_nfc_lib = NULL;
+
+static int nfc_lib_load(void)
+{
+    if (g_nfc_lib)
+    {
+        return 0;
+    }
+    void *lib = dlopen(NFC_LIB_PATH, RTLD_NOW);
+    if (!lib)
+    {
+        printf("NFC模块加载失败，刷卡不可用: %s\n", dlerror());
+        return -1;
+    }
+    if (!NFC_LOAD(lib, vbar_nfc_init) || !NFC_LOAD(lib, vbar_nfc_deinit) ||
+        !NFC_LOAD(lib, vbar_nfc_cb_register) || !NFC_LOAD(lib, vbar_nfc_cb_unregister))
+    {
+        printf("NFC模块接口不完整，刷卡不可用\n");
+        dlclose(lib);
+        return -1;
+    }
+    g_nfc_lib = lib;
+    return 0;
+}
+
+// ---------------- 对外接口 ----------------
+
+int nfc_init(const char *db_path, const struct nfc_options_t *options)
+{
+    if (g_nfc)
+    {
+        return 0;
+    }
+    if (options)
+    {
+        nfc_set_options(options);
+    }
+    snprintf(g_db_path, sizeof(g_db_path), "%s", db_path);
+
+    if (nfc_lib_load() != 0)
+    {
+        return -1;
+    }
+    if (vbar_drv_gpio_init() != 0)
+    {
+        printf("GPIO初始化失败\n");
+        return -1;
+    }
+    vbar_drv_gpio_request(VBAR_BOARD_GPIO_NFC_RESET);
+    vbar_drv_gpio_request(VBAR_BOARD_GPIO_NFC_STANDBY);
+
+    g_spi_fd = vbar_spi_open(NFC_SPI_PATH, NFC_SPI_SPEED_HZ, VBAR_SPI_MODE_0, 8);
+    if (g_spi_fd < 0)
+    {
+        printf("打开NFC SPI失败: %s\n", NFC_SPI_PATH);
+        return -1;
+    }
+
+    // 先取版本再加载，加载期间的改动会在后台线程第一次检查时发现
+    g_data_version = db_data_version();
+    // 先加载凭证表再注册回调，避免启动时刷卡查不到
+    credential_table_load(g_db_path, NFC_CREDENTIAL_TYPE_CARD);
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&g_cond, &attr);
+    pthread_condattr_destroy(&attr);
+    g_worker_running = 1;
+    if (pthread_create(&g_worker, NULL, nfc_worker, NULL) != 0)
+    {
+        printf("创建NFC线程失败\n");
+        g_worker_running = 0;
+        sqlite3_close(g_watch_db);
+        g_watch_db = NULL;
+        host_destroy(&g_host_ops);
+        return -1;
+    }
+
+    g_nfc = p_vbar_nfc_init(&g_host_ops, &g_nfc_config, VBAR_NFC_TYPE_CHIP);
+    if (!g_nfc)
+    {
+        printf("NFC初始化失败\n");
+        nfc_deinit();
+        return -1;
+    }
+    if (p_vbar_nfc_cb_register(g_nfc, NFC_CALLBACK_NAME, nfc_card_callback, VBAR_NFC_CB_SHARED_MODE, NULL) != 0)
+    {
+        printf("注册NFC回调失败\n");
+        nfc_deinit();
+        return -1;
+    }
+    printf("NFC初始化完成\n");
+    return 0;
+}
+
+void nfc_deinit(void)
+{
+    if (g_nfc)
+    {
+        p_vbar_nfc_cb_unregister(g_nfc, NFC_CALLBACK_NAME);
+        p_vbar_nfc_deinit(g_nfc);
+        g_nfc = NULL;
+    }
+    if (g_worker_running)
+    {
+        pthread_mutex_lock(&g_mutex);
+        g_worker_running = 0;
+        pthread_cond_signal(&g_cond);
+        pthread_mutex_unlock(&g_mutex);
+        pthread_join(g_worker, NULL);
+        pthread_cond_destroy(&g_cond);
+    }
+    sqlite3_close(g_watch_db);
+    g_watch_db = NULL;
+    g_data_version = -1;
+    host_destroy(&g_host_ops);
+    credential_table_free();
+}
+
+void nfc_set_options(const struct nfc_options_t *options)
+{
+    pthread_mutex_lock(&g_mutex);
+    g_options = *options;
+    if (g_worker_running)
+    {
+        pthread_cond_signal(&g_cond);
+    }
+    pthread_mutex_unlock(&g_mutex);
+}
+
+int nfc_reload_credentials(void)
+{
+    if (!g_db_path[0])
+    {
+        return -1;
+    }
+    return credential_table_load(g_db_path, NFC_CREDENTIAL_TYPE_CARD);
+}
+
+int nfc_get_result(struct nfc_result_t *result, char *code, char *credential_id, char *user_id, char *permission_id)
+{
+    pthread_mutex_lock(&g_mutex);
+    if (g_result_count == 0)
+    {
+        pthread_mutex_unlock(&g_mutex);
+        return 0;
+    }
+    struct result_slot *slot = &g_results[g_result_head];
+    *result = slot->result;
+    strcpy(code, slot->code);
+    strcpy(credential_id, slot->credential_id);
+    strcpy(user_id, slot->user_id);
+    strcpy(permission_id, slot->permission_id);
+    g_result_head = (g_result_head + 1) % NFC_RESULT_QUEUE_SIZE;
+    g_result_count--;
+    pthread_mutex_unlock(&g_mutex);
+    return 1;
+}
+
+void nfc_get_stats(struct nfc_stats_t *stats)
+{
+    pthread_mutex_lock(&g_mutex);
+    *stats = g_stats;
+    pthread_mutex_unlock(&g_mutex);
+    stats->credentials = credential_table_count();
+}
@@ -0,0 +1,70 @@
+#ifndef NFC_WRAPPER_H
+#define NFC_WRAPPER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 刷卡开门：读卡回调中直接查本地凭证表并驱动继电器，结果放入队列由JS事后取走
+// （写通行记录、刷新界面），JS事件循环繁忙时不影响开门
+
+struct nfc_options_t
+{
+    int debounce_ms;        // 同一张卡在该时间内重复读到只处理一次
+    int relay_ms;           // 继电器吸合时长，0表示只判定不开门
+    int reload_interval_ms; // 检查数据库是否变化的间隔，变化时自动重新加载凭证表，0表示不检查
+};
+
+// 刷卡结果
+struct nfc_result_t
+{
+    unsigned int seq;
+    int result;             // 1-成功，0-当前时间无权限，-1-拒绝
+    int reason;             // 见 credential.h 的 credential_reason
+    int card_type;          // 卡类型，vbar_nfc_card_info.card_type
+    int relay;              // 是否已驱动继电器
+    uint32_t latency_us;    // 回调进入到继电器吸合（或判定完成）的耗时
+    int64_t time;           // 刷卡时间（Unix时间戳）
+};
+
+// 统计
+struct nfc_stats_t
+{
+    unsigned int reads;       // 读卡回调次数
+    unsigned int debounced;   // 被去抖忽略的次数
+    unsigned int allowed;
+    unsigned int denied;
+    unsigned int dropped;     // 结果队列满，JS未及时取走而丢弃的结果数
+    int credentials;          // 本地凭证表中的卡片数
+    uint32_t last_latency_us;
+    uint32_t max_latency_us;
+};
+
+/**
+ * @brief 初始化NFC读卡、加载卡片凭证表并启动后台线程
+ *
+ * @param db_path 门禁数据库路径
+ * @param options 参数，为NULL时使用默认值
+ *
+ * @return 0成功，-1失败
+ */
+int nfc_init(const char *db_path, const struct nfc_options_t *options);
+void nfc_deinit(void);
+
+void nfc_set_options(const struct nfc_options_t *options);
+
+// 立即重新加载卡片凭证表，返回凭证个数，失败返回-1
+int nfc_reload_credentials(void);
+
+// 取一条刷卡结果，各字符串缓冲区至少 CREDENTIAL_CODE_LEN / CREDENTIAL_ID_LEN 字节，有结果返回1，没有返回0
+int nfc_get_result(struct nfc_result_t *result, char *code, char *credential_id, char *user_id, char *permission_id);
+
+void nfc_get_stats(struct nfc_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NFC_WRAPPER_H
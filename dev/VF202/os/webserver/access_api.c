@@ -0,0 +1,771 @@
+#include "./access_api.h"
+#include <sqlite/sqlite3.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define EXPORT_BATCH_ROWS 256          // 每次查询的行数，查询结束即释放读锁
+#define EXPORT_SEND_HIGH_WATER 65536   // 发送缓冲超过该值时暂停导出，等待下次轮询
+#define IMPORT_BATCH_ROWS 500          // 每个事务提交的行数
+#define IMPORT_MAX_ERRORS 10           // 响应中最多返回的失败行号个数
+#define DB_BUSY_TIMEOUT_MS 3000        // 应用同时在使用数据库，忙时等待
+// 请求体上限：导入在事件循环中同步解析整个请求体，过大的文件需分多次导入
+#define ACCESS_API_MAX_BODY (16UL * 1024UL * 1024UL)
+
+// 表字段描述
+struct column_spec
+{
+    const char *name;
+    int is_text;      // 1-文本字段，0-数值字段
+    const char *dflt; // 缺省值SQL表达式，NULL表示无缺省值
+};
+
+struct table_spec
+{
+    const char *alias;   // URL中使用的名称
+    const char *table;   // 数据库表名
+    const char *time_column; // 导出时按时间过滤的字段，NULL表示不支持
+    int importable;
+    const struct column_spec *columns;
+    int column_num;
+};
+
+#define ID_DEFAULT "lower(hex(randomblob(16)))"
+#define NOW_DEFAULT "strftime('%s', 'now')"
+
+static const struct column_spec user_columns[] = {
+    {"id", 1, ID_DEFAULT},
+    {"name", 1, NULL},
+    {"phone", 1, NULL},
+    {"email", 1, NULL},
+    {"department", 1, NULL},
+    {"position", 1, NULL},
+    {"status", 0, "1"},
+    {"extra", 1, NULL},
+    {"created_at", 0, NOW_DEFAULT},
+    {"updated_at", 0, NOW_DEFAULT},
+};
+
+static const struct column_spec credential_columns[] = {
+    {"id", 1, ID_DEFAULT},
+    {"userId", 1, NULL},
+    {"type", 0, NULL},
+    {"code", 1, NULL},
+    {"name", 1, NULL},
+    {"status", 0, "1"},
+    {"expires_at", 0, NULL},
+    {"extra", 1, NULL},
+    {"created_at", 0, NOW_DEFAULT},
+    {"updated_at", 0, NOW_DEFAULT},
+};
+
+static const struct column_spec permission_columns[] = {
+    {"id", 1, ID_DEFAULT},
+    {"userId", 1, NULL},
+    {"door", 0, NULL},
+    {"timeType", 0, NULL},
+    {"beginTime", 0, NULL},
+    {"endTime", 0, NULL},
+    {"repeatBeginTime", 0, NULL},
+    {"repeatEndTime", 0, NULL},
+    {"period", 1, NULL},
+    {"status", 0, "1"},
+    {"extra", 1, NULL},
+    {"created_at", 0, NOW_DEFAULT},
+    {"updated_at", 0, NOW_DEFAULT},
+};
+
+static const struct column_spec record_columns[] = {
+    {"id", 1, ID_DEFAULT},
+    {"credentialId", 1, NULL},
+    {"permissionId", 1, NULL},
+    {"userId", 1, NULL},
+    {"door", 0, NULL},
+    {"accessTime", 0, NULL},
+    {"result", 0, NULL},
+    {"method", 1, NULL},
+    {"extra", 1, NULL},
+    {"message", 1, NULL},
+    {"created_at", 0, NOW_DEFAULT},
+};
+
+#define COLUMN_NUM(x) ((int)(sizeof(x) / sizeof((x)[0])))
+
+static const struct table_spec tables[] = {
+    {"users", "ac_user", NULL, 1, user_columns, COLUMN_NUM(user_columns)},
+    {"credentials", "ac_credential", NULL, 1, credential_columns, COLUMN_NUM(credential_columns)},
+    {"permissions", "ac_permission", NULL, 1, permission_columns, COLUMN_NUM(permission_columns)},
+    {"records", "ac_access_record", "accessTime", 0, record_columns, COLUMN_NUM(record_columns)},
+};
+
+// 导出状态，指针保存在 c->data 中
+struct export_state
+{
+    const struct table_spec *spec;
+    sqlite3_int64 last_rowid;
+    long long since;
+    long long until;
+};
+
+static char s_db_path[256] = "/data/db/access.db";
+static sqlite3 *s_db = NULL;
+
+static const struct table_spec *find_table(struct mg_str alias)
+{
+    for (size_t i = 0; i < sizeof(tables) / sizeof(tables[0]); i++)
+    {
+        if (mg_strcmp(alias, mg_str(tables[i].alias)) == 0)
+        {
+            return &tables[i];
+        }
+    }
+    return NULL;
+}
+
+static sqlite3 *get_db(void)
+{
+    if (s_db)
+    {
+        return s_db;
+    }
+    if (sqlite3_open_v2(s_db_path, &s_db, SQLITE_OPEN_READWRITE, NULL) != SQLITE_OK)
+    {
+        printf("打开数据库失败: %s\n", s_db ? sqlite3_errmsg(s_db) : s_db_path);
+        sqlite3_close(s_db);
+        s_db = NULL;
+        return NULL;
+    }
+    sqlite3_busy_timeout(s_db, DB_BUSY_TIMEOUT_MS);
+    return s_db;
+}
+
+static void reply_message(struct mg_connection *c, int code, const char *message)
+{
+    mg_http_reply(c, code, "Content-Type: application/json\r\n", "{%m:%m}\n",
+                  MG_ESC("message"), MG_ESC(message));
+}
+
+static struct export_state *get_export_state(struct mg_connection *c)
+{
+    struct export_state *state;
+    memcpy(&state, c->data, sizeof(state));
+    return state;
+}
+
+static void set_export_state(struct mg_connection *c, struct export_state *state)
+{
+    memcpy(c->data, &state, sizeof(state));
+}
+
+// ==================== 导出 ====================
+
+static void export_row(struct mg_iobuf *io, sqlite3_stmt *stmt, const struct table_spec *spec)
+{
+    mg_xprintf(mg_pfn_iobuf, io, "{");
+    for (int i = 0; i < spec->column_num; i++)
+    {
+        int col = i + 1; // 第0列为rowid
+        mg_xprintf(mg_pfn_iobuf, io, "%s%m:", i == 0 ? "" : ",", MG_ESC(spec->columns[i].name));
+        switch (sqlite3_column_type(stmt, col))
+        {
+        case SQLITE_INTEGER:
+            mg_xprintf(mg_pfn_iobuf, io, "%lld", (long long)sqlite3_column_int64(stmt, col));
+            break;
+        case SQLITE_FLOAT:
+            mg_xprintf(mg_pfn_iobuf, io, "%g", sqlite3_column_double(stmt, col));
+            break;
+        case SQLITE_NULL:
+            mg_xprintf(mg_pfn_iobuf, io, "null");
+            break;
+        default:
+            mg_xprintf(mg_pfn_iobuf, io, "%m", MG_ESC((const char *)sqlite3_column_text(stmt, col)));
+            break;
+        }
+    }
+    mg_xprintf(mg_pfn_iobuf, io, "}\n");
+}
+
+// 输出一批数据，返回本批行数，出错返回-1
+static int export_batch(struct mg_connection *c, struct export_state *state)
+{
+    sqlite3 *db = get_db();
+    if (!db)
+    {
+        return -1;
+    }
+
+    const struct table_spec *spec = state->spec;
+    char sql[1024];
+    size_t n = (size_t)snprintf(sql, sizeof(sql), "SELECT rowid");
+    for (int i = 0; i < spec->column_num; i++)
+    {
+        n += (size_t)snprintf(sql + n, sizeof(sql) - n, ", %s", spec->columns[i].name);
+    }
+    n += (size_t)snprintf(sql + n, sizeof(sql) - n, " FROM %s WHERE rowid > ?1", spec->table);
+    if (spec->time_column)
+    {
+        n += (size_t)snprintf(sql + n, sizeof(sql) - n, " AND %s >= ?2 AND %s <= ?3",
+                              spec->time_column, spec->time_column);
+    }
+    snprintf(sql + n, sizeof(sql) - n, " ORDER BY rowid LIMIT %d", EXPORT_BATCH_ROWS);
+
+    sqlite3_stmt *stmt = NULL;
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        printf("导出查询失败: %s\n", sqlite3_errmsg(db));
+        return -1;
+    }
+    sqlite3_bind_int64(stmt, 1, state->last_rowid);
+    if (spec->time_column)
+    {
+        sqlite3_bind_int64(stmt, 2, state->since);
+        sqlite3_bind_int64(stmt, 3, state->until);
+    }
+
+    struct mg_iobuf io = {0, 0, 0, 512};
+    int rows = 0;
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        state->last_rowid = sqlite3_column_int64(stmt, 0);
+        export_row(&io, stmt, spec);
+        rows++;
+    }
+    sqlite3_finalize(stmt);
+
+    if (io.len > 0)
+    {
+        mg_http_write_chunk(c, (const char *)io.buf, io.len);
+    }
+    mg_iobuf_free(&io);
+    return rc == SQLITE_DONE ? rows : -1;
+}
+
+static void export_finish(struct mg_connection *c)
+{
+    free(get_export_state(c));
+    set_export_state(c, NULL);
+}
+
+void access_api_poll(struct mg_connection *c)
+{
+    struct export_state *state = get_export_state(c);
+    if (!state)
+    {
+        return;
+    }
+    while (c->send.len < EXPORT_SEND_HIGH_WATER)
+    {
+        int rows = export_batch(c, state);
+        if (rows < 0)
+        {
+            // 响应头已发出，只能中断连接
+            export_finish(c);
+            c->is_draining = 1;
+            return;
+        }
+        if (rows < EXPORT_BATCH_ROWS)
+        {
+            mg_http_printf_chunk(c, "");
+            export_finish(c);
+            return;
+        }
+    }
+}
+
+static void handle_export(struct mg_connection *c, struct mg_http_message *hm, const struct table_spec *spec)
+{
+    if (mg_strcmp(hm->method, mg_str("GET")) != 0)
+    {
+        reply_message(c, 405, "Method not allowed");
+        return;
+    }
+    if (!get_db())
+    {
+        reply_message(c, 500, "Database unavailable");
+        return;
+    }
+    if (get_export_state(c))
+    {
+        reply_message(c, 409, "Export already in progress");
+        return;
+    }
+
+    struct export_state *state = (struct export_state *)calloc(1, sizeof(*state));
+    if (!state)
+    {
+        reply_message(c, 500, "Out of memory");
+        return;
+    }
+    char buf[32];
+    state->spec = spec;
+    state->since = 0;
+    state->until = 0x7fffffffffffffffLL;
+    if (mg_http_get_var(&hm->query, "since", buf, sizeof(buf)) > 0)
+    {
+        state->since = strtoll(buf, NULL, 10);
+    }
+    if (mg_http_get_var(&hm->query, "until", buf, sizeof(buf)) > 0)
+    {
+        state->until = strtoll(buf, NULL, 10);
+    }
+    set_export_state(c, state);
+
+    mg_printf(c, "HTTP/1.1 200 OK\r\n"
+                 "Content-Type: application/x-ndjson\r\n"
+                 "Transfer-Encoding: chunked\r\n\r\n");
+    access_api_poll(c);
+}
+
+// ==================== 导入 ====================
+
+static struct mg_str next_line(struct mg_str *body)
+{
+    struct mg_str line, rest;
+    if (!mg_span(*body, &line, &rest, '\n'))
+    {
+        line = *body;
+        rest = mg_str_n(NULL, 0);
+    }
+    *body = rest;
+    while (line.len > 0 && (line.buf[line.len - 1] == '\r' || line.buf[line.len - 1] == ' '))
+    {
+        line.len--;
+    }
+    return line;
+}
+
+// 按字段类型绑定文本值，数值字段能完整解析为整数时按整数绑定
+static void bind_text_value(sqlite3_stmt *stmt, int index, const struct column_spec *column,
+                            const char *value, int len)
+{
+    if (!column->is_text)
+    {
+        char num[32];
+        if (len > 0 && len < (int)sizeof(num))
+        {
+            char *end = NULL;
+            memcpy(num, value, (size_t)len);
+            num[len] = '\0';
+            long long v = strtoll(num, &end, 10);
+            if (end && *end == '\0')
+            {
+                sqlite3_bind_int64(stmt, index, v);
+                return;
+            }
+        }
+    }
+    sqlite3_bind_text(stmt, index, value, len, SQLITE_TRANSIENT);
+}
+
+static int bind_ndjson_row(sqlite3_stmt *stmt, const struct table_spec *spec, struct mg_str line)
+{
+    int toklen = 0;
+    if (mg_json_get(line, "$", &toklen) != 0 || line.buf[0] != '{')
+    {
+        return -1;
+    }
+    for (int i = 0; i < spec->column_num; i++)
+    {
+        char path[64];
+        snprintf(path, sizeof(path), "$.%s", spec->columns[i].name);
+        struct mg_str tok = mg_json_get_tok(line, path);
+        if (tok.len == 0 || (tok.len == 4 && memcmp(tok.buf, "null", 4) == 0))
+        {
+            sqlite3_bind_null(stmt, i + 1);
+        }
+        else if (tok.buf[0] == '"')
+        {
+            char *str = mg_json_get_str(line, path);
+            if (!str)
+            {
+                return -1;
+            }
+            bind_text_value(stmt, i + 1, &spec->columns[i], str, (int)strlen(str));
+            free(str);
+        }
+        else if (tok.buf[0] == '{' || tok.buf[0] == '[')
+        {
+            // extra等扩展字段以JSON文本保存
+            sqlite3_bind_text(stmt, i + 1, tok.buf, (int)tok.len, SQLITE_TRANSIENT);
+        }
+        else
+        {
+            bind_text_value(stmt, i + 1, &spec->columns[i], tok.buf, (int)tok.len);
+        }
+    }
+    return 0;
+}
+
+// 拆分一行CSV，支持双引号包裹及""转义，返回字段数
+static int split_csv(struct mg_str line, char *buf, size_t buf_len, char **fields, int *lens, int max_fields)
+{
+    int count = 0;
+    size_t i = 0, o = 0;
+    while (count < max_fields)
+    {
+        int quoted = i < line.len && line.buf[i] == '"';
+        if (quoted)
+        {
+            i++;
+        }
+        fields[count] = buf + o;
+        size_t start = o;
+        while (i < line.len && o < buf_len - 1)
+        {
+            char ch = line.buf[i];
+            if (quoted && ch == '"')
+            {
+                if (i + 1 < line.len && line.buf[i + 1] == '"')
+                {
+                    buf[o++] = '"';
+                    i += 2;
+                    continue;
+                }
+                quoted = 0;
+                i++;
+                continue;
+            }
+            if (!quoted && ch == ',')
+            {
+                break;
+            }
+            buf[o++] = ch;
+            i++;
+        }
+        lens[count] = (int)(o - start);
+        buf[o++] = '\0';
+        count++;
+        if (i >= line.len || line.buf[i] != ',' || o >= buf_len)
+        {
+            break;
+        }
+        i++; // 跳过逗号
+    }
+    return count;
+}
+
+#define CSV_MAX_FIELDS 32
+#define CSV_LINE_MAX 4096
+
+static int bind_csv_row(sqlite3_stmt *stmt, const struct table_spec *spec, const int *header_map,
+                        int header_num, struct mg_str line)
+{
+    char buf[CSV_LINE_MAX];
+    char *fields[CSV_MAX_FIELDS];
+    int lens[CSV_MAX_FIELDS];
+    if (line.len >= sizeof(buf))
+    {
+        return -1;
+    }
+    int count = split_csv(line, buf, sizeof(buf), fields, lens, CSV_MAX_FIELDS);
+    for (int i = 0; i < spec->column_num; i++)
+    {
+        sqlite3_bind_null(stmt, i + 1);
+    }
+    for (int i = 0; i < count && i < header_num; i++)
+    {
+        int col = header_map[i];
+        if (col < 0 || lens[i] == 0)
+        {
+            continue;
+        }
+        bind_text_value(stmt, col + 1, &spec->columns[col], fields[i], lens[i]);
+    }
+    return 0;
+}
+
+static int parse_csv_header(const struct table_spec *spec, struct mg_str line, int *header_map)
+{
+    char buf[CSV_LINE_MAX];
+    char *fields[CSV_MAX_FIELDS];
+    int lens[CSV_MAX_FIELDS];
+    if (line.len >= sizeof(buf))
+    {
+        return -1;
+    }
+    int count = split_csv(line, buf, sizeof(buf), fields, lens, CSV_MAX_FIELDS);
+    for (int i = 0; i < count; i++)
+    {
+        header_map[i] = -1;
+        for (int j = 0; j < spec->column_num; j++)
+        {
+            if (strcmp(fields[i], spec->columns[j].name) == 0)
+            {
+                header_map[i] = j;
+                break;
+            }
+        }
+    }
+    return count;
+}
+
+static sqlite3_stmt *prepare_import(sqlite3 *db, const struct table_spec *spec)
+{
+    char sql[2048];
+    size_t n = (size_t)snprintf(sql, sizeof(sql), "INSERT OR REPLACE INTO %s (", spec->table);
+    for (int i = 0; i < spec->column_num; i++)
+    {
+        n += (size_t)snprintf(sql + n, sizeof(sql) - n, "%s%s", i == 0 ? "" : ", ", spec->columns[i].name);
+    }
+    n += (size_t)snprintf(sql + n, sizeof(sql) - n, ") VALUES (");
+    for (int i = 0; i < spec->column_num; i++)
+    {
+        const char *sep = i == 0 ? "" : ", ";
+        if (spec->columns[i].dflt)
+        {
+            n += (size_t)snprintf(sql + n, sizeof(sql) - n, "%sCOALESCE(?%d, %s)", sep, i + 1, spec->columns[i].dflt);
+        }
+        else
+        {
+            n += (size_t)snprintf(sql + n, sizeof(sql) - n, "%s?%d", sep, i + 1);
+        }
+    }
+    snprintf(sql + n, sizeof(sql) - n, ")");
+
+    sqlite3_stmt *stmt = NULL;
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        printf("导入语句准备失败: %s\n", sqlite3_errmsg(db));
+        return NULL;
+    }
+    return stmt;
+}
+
+// 开始一批导入的写事务，失败返回-1
+static int import_begin(sqlite3 *db)
+{
+    if (sqlite3_exec(db, "BEGIN IMMEDIATE", NULL, NULL, NULL) != SQLITE_OK)
+    {
+        printf("导入开始事务失败: %s\n", sqlite3_errmsg(db));
+        return -1;
+    }
+    return 0;
+}
+
+// 提交一批导入，失败时回滚，不让未结束的事务留在共用连接上阻塞应用写库
+static int import_commit(sqlite3 *db)
+{
+    if (sqlite3_exec(db, "COMMIT", NULL, NULL, NULL) == SQLITE_OK)
+    {
+        return 0;
+    }
+    printf("导入提交失败: %s\n", sqlite3_errmsg(db));
+    if (!sqlite3_get_autocommit(db))
+    {
+        sqlite3_exec(db, "ROLLBACK", NULL, NULL, NULL);
+    }
+    return -1;
+}
+
+static void handle_import(struct mg_connection *c, struct mg_http_message *hm)
+{
+    if (mg_strcmp(hm->method, mg_str("POST")) != 0)
+    {
+        reply_message(c, 405, "Method not allowed");
+        return;
+    }
+
+    char table[32] = {0};
+    char format[16] = {0};
+    mg_http_get_var(&hm->query, "table", table, sizeof(table));
+    if (mg_http_get_var(&hm->query, "format", format, sizeof(format)) <= 0)
+    {
+        strcpy(format, "ndjson");
+    }
+    const struct table_spec *spec = find_table(mg_str(table));
+    if (!spec || !spec->importable)
+    {
+        reply_message(c, 400, "Invalid parameter: table must be users, credentials or permissions");
+        return;
+    }
+    int is_csv = strcmp(format, "csv") == 0;
+    if (!is_csv && strcmp(format, "ndjson") != 0)
+    {
+        reply_message(c, 400, "Invalid parameter: format must be ndjson or csv");
+        return;
+    }
+
+    sqlite3 *db = get_db();
+    sqlite3_stmt *stmt = db ? prepare_import(db, spec) : NULL;
+    if (!stmt)
+    {
+        reply_message(c, 500, "Database unavailable");
+        return;
+    }
+
+    struct mg_str body = hm->body;
+    int header_map[CSV_MAX_FIELDS];
+    int header_num = 0;
+    if (is_csv)
+    {
+        header_num = parse_csv_header(spec, next_line(&body), header_map);
+        if (header_num <= 0)
+        {
+            sqlite3_finalize(stmt);
+            reply_message(c, 400, "Invalid CSV header");
+            return;
+        }
+    }
+
+    // imported 只统计已提交批次的行，批次提交失败时该批回滚，不计入
+    int imported = 0, failed = 0, line_no = is_csv ? 1 : 0, pending = 0, batch_rows = 0;
+    int errors[IMPORT_MAX_ERRORS];
+    int error_num = 0;
+    int db_error = import_begin(db) != 0;
+    while (!db_error && body.len > 0)
+    {
+        struct mg_str line = next_line(&body);
+        line_no++;
+        if (line.len == 0)
+        {
+            continue;
+        }
+        int ret = is_csv ? bind_csv_row(stmt, spec, header_map, header_num, line)
+                         : bind_ndjson_row(stmt, spec, line);
+        if (ret == 0 && sqlite3_step(stmt) == SQLITE_DONE)
+        {
+            batch_rows++;
+        }
+        else
+        {
+            failed++;
+            if (error_num < IMPORT_MAX_ERRORS)
+            {
+                errors[error_num++] = line_no;
+            }
+        }
+        sqlite3_reset(stmt);
+        sqlite3_clear_bindings(stmt);
+        if (sqlite3_get_autocommit(db))
+        {
+            // 磁盘满、IO错误时 SQLite 已自动回滚整个事务，本批数据丢失
+            printf("导入%s事务被回滚: %s\n", spec->table, sqlite3_errmsg(db));
+            db_error = 1;
+            break;
+        }
+
+        if (++pending >= IMPORT_BATCH_ROWS)
+        {
+            // 分批提交，避免长时间占用写锁阻塞应用
+            if (import_commit(db) != 0)
+            {
+                db_error = 1;
+                break;
+            }
+            imported += batch_rows;
+            batch_rows = 0;
+            pending = 0;
+            db_error = import_begin(db) != 0;
+        }
+    }
+    if (!db_error)
+    {
+        if (import_commit(db) == 0)
+        {
+            imported += batch_rows;
+        }
+        else
+        {
+            db_error = 1;
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    char error_list[IMPORT_MAX_ERRORS * 12 + 1] = {0};
+    size_t n = 0;
+    for (int i = 0; i < error_num; i++)
+    {
+        n += (size_t)snprintf(error_list + n, sizeof(error_list) - n, "%s%d", i == 0 ? "" : ",", errors[i]);
+    }
+    if (db_error)
+    {
+        // 此前已提交的批次保留，客户端据 imported 和 failedLines 决定从哪里续传
+        printf("导入%s中止: 已提交%d条, 失败%d条, 中止于第%d行\n", spec->table, imported, failed, line_no);
+        mg_http_reply(c, 500, "Content-Type: application/json\r\n",
+                      "{%m:%m,%m:%d,%m:%d,%m:[%s],%m:%d}\n",
+                      MG_ESC("message"), MG_ESC("Database write failed"),
+                      MG_ESC("imported"), imported, MG_ESC("failed"), failed,
+                      MG_ESC("failedLines"), error_list, MG_ESC("abortedLine"), line_no);
+        return;
+    }
+    printf("导入%s完成: 成功%d条, 失败%d条\n", spec->table, imported, failed);
+    mg_http_reply(c, 200, "Content-Type: application/json\r\n",
+                  "{%m:%d,%m:%d,%m:[%s]}\n",
+                  MG_ESC("imported"), imported, MG_ESC("failed"), failed,
+                  MG_ESC("failedLines"), error_list);
+}
+
+// ==================== 入口 ====================
+
+void access_api_init(const char *db_path)
+{
+    if (db_path)
+    {
+        snprintf(s_db_path, sizeof(s_db_path), "%s", db_path);
+    }
+}
+
+static bool is_access_uri(struct mg_str uri)
+{
+    return mg_match(uri, mg_str("/api/access/*"), NULL);
+}
+
+bool access_api_check_headers(struct mg_connection *c, struct mg_http_message *hm)
+{
+    if (c->is_draining || !is_access_uri(hm->uri))
+    {
+        return true;
+    }
+    // 收到头部时 body.len 即 Content-Length，分块传输无法预知长度，一律不接受
+    if (hm->body.len > ACCESS_API_MAX_BODY || mg_http_get_header(hm, "Transfer-Encoding") != NULL)
+    {
+        printf("拒绝门禁库请求 %.*s: 请求体%lu字节\n", (int)hm->uri.len, hm->uri.buf, (unsigned long)hm->body.len);
+        reply_message(c, 413, "Request body too large");
+        c->is_draining = 1;
+        return false;
+    }
+    return true;
+}
+
+bool access_api_handle(struct mg_connection *c, struct mg_http_message *hm)
+{
+    struct mg_str caps[2];
+    if (is_access_uri(hm->uri) && (c->is_draining || hm->body.len > ACCESS_API_MAX_BODY))
+    {
+        // 头部阶段已回复413
+        if (!c->is_draining)
+        {
+            reply_message(c, 413, "Request body too large");
+            c->is_draining = 1;
+        }
+        return true;
+    }
+    if (mg_match(hm->uri, mg_str("/api/access/import"), NULL))
+    {
+        handle_import(c, hm);
+        return true;
+    }
+    if (mg_match(hm->uri, mg_str("/api/access/*"), caps))
+    {
+        const struct table_spec *spec = find_table(caps[0]);
+        if (!spec)
+        {
+            reply_message(c, 404, "Not found");
+        }
+        else
+        {
+            handle_export(c, hm, spec);
+        }
+        return true;
+    }
+    return false;
+}
+
+void access_api_close(struct mg_connection *c)
+{
+    if (get_export_state(c))
+    {
+        export_finish(c);
+    }
+}
@@ -0,0 +1,42 @@
+#ifndef ACCESS_API_H
+#define ACCESS_API_H
+
+#include "./mongoose.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 门禁库本地REST接口（直接读写 /data/db/access.db，不经过应用的MQTT通道）
+//
+// 导出（NDJSON流式分块输出，每行一条JSON记录）：
+//   GET  /api/access/users                      ac_user
+//   GET  /api/access/credentials                ac_credential
+//   GET  /api/access/permissions                ac_permission
+//   GET  /api/access/records?since=&until=      ac_access_record，按accessTime过滤
+//
+// 导入（批量事务写入，INSERT OR REPLACE）：
+//   POST /api/access/import?table=users|credentials|permissions&format=ndjson|csv
+//   CSV首行为列名，列名与表字段一致
+//   请求体不超过16MB，须带 Content-Length，超过时返回413；写库失败时返回500，已提交的批次保留
+
+// 初始化，设置数据库路径
+void access_api_init(const char *db_path);
+
+// 收到请求头时检查门禁库接口的请求体大小（在MG_EV_HTTP_HDRS中调用），超限时回复413并返回false
+bool access_api_check_headers(struct mg_connection *c, struct mg_http_message *hm);
+
+// 处理HTTP请求，已处理返回true
+bool access_api_handle(struct mg_connection *c, struct mg_http_message *hm);
+
+// 继续输出未完成的导出（在MG_EV_POLL/MG_EV_WRITE中调用）
+void access_api_poll(struct mg_connection *c);
+
+// 连接关闭时释放导出状态
+void access_api_close(struct mg_connection *c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ACCESS_API_H
@@ -1 +1 @@
-/home/dxl/.toolchains/arm-gcc550/arm-gcc550-glibc221-sv80x/bin/arm-linux-gnueabihf-gcc -Wall -Wextra -O3 -o /media/sf_share/new/dev/VF202/os/webserver/webserver /media/sf_share/new/dev/VF202/os/webserver/webserver.c /media/sf_share/new/dev/VF202/os/webserver/mongoose.c -pthread
\ No newline at end of file
+/home/dxl/.toolchains/arm-gcc550/arm-gcc550-glibc221-sv80x/bin/arm-linux-gnueabihf-gcc -Wall -Wextra -O3 -o /media/sf_share/new/dev/VF202/os/webserver/webserver /media/sf_share/new/dev/VF202/os/webserver/webserver.c /media/sf_share/new/dev/VF202/os/webserver/access_api.c /media/sf_share/new/dev/VF202/os/webserver/mongoose.c /media/sf_share/new/dev/VF202/dxDriver_c/metrics/metrics.c -pthread -lrt -lsqlite3 -I/media/sf_share/new/dev/VF202/driver/include/thirdlib -L/media/sf_share/new/dev/VF202/os/driver
\ No newline at end of file
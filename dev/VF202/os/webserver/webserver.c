@@ -1,4 +1,6 @@
 #include "./mongoose.h"
+#include "./access_api.h"
+#include "../../dxDriver_c/metrics/metrics.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -88,12 +90,33 @@ static void fn(struct mg_connection *c, int ev, void *ev_data)
             system("[ -f /data/upgrade/app.zip ] && rm -rf /app/* && unzip -o /data/upgrade/app.zip -d /app && rm -rf /data/upgrade/app.zip");
             system("lvgljs run /app/index.js > /tmp/program_pipe &");
         }
+        else if (mg_match(hm->uri, mg_str("/metrics"), NULL))
+        {
+            // app 运行指标，从共享内存读取，Prometheus 文本格式
+            static char metrics_buf[16 * 1024];
+            metrics_render(metrics_buf, sizeof(metrics_buf));
+            mg_http_reply(c, 200, "Content-Type: text/plain; version=0.0.4\r\n", "%s", metrics_buf);
+        }
+        else if (access_api_handle(c, hm))
+        {
+            // 门禁库导入导出接口
+        }
         else
         {
             struct mg_http_serve_opts opts = {.root_dir = "/os/webserver/src/"};
             mg_http_serve_dir(c, hm, &opts);
         }
     }
+    else if (ev == MG_EV_HTTP_HDRS)
+    {
+        // 门禁库导入在收完请求体前拒绝过大的请求
+        access_api_check_headers(c, (struct mg_http_message *)ev_data);
+    }
+    else if (ev == MG_EV_POLL || ev == MG_EV_WRITE)
+    {
+        // 继续输出未完成的门禁库导出
+        access_api_poll(c);
+    }
     else if (ev == MG_EV_WS_MSG)
     {
         // 处理WebSocket消息
@@ -103,6 +126,7 @@ static void fn(struct mg_connection *c, int ev, void *ev_data)
     else if (ev == MG_EV_CLOSE)
     {
         // 连接关闭
+        access_api_close(c);
         if (c == ws_connection)
         {
             ws_connection = NULL;
@@ -120,6 +144,7 @@ int main(int argc, char *argv[])
 
     mgr = (struct mg_mgr *)malloc(sizeof(struct mg_mgr));
     mg_mgr_init(mgr);
+    access_api_init("/data/db/access.db");
 
     printf("启动 Mongoose Web Server...\n");
     printf("访问地址: %s\n", s_http_addr);
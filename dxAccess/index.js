@@ -1,6 +1,6 @@
 import { initConfigManager } from './lib/config/index.js';
 import { saveToFile, downloadFile } from './lib/utils/index.js';
-import { access as accessFunc, accessByUserId, accessByUserName, db} from './lib/access/index.js';
+import { access as accessFunc, accessByUserId, accessByUserName, db, dbReady } from './lib/access/index.js';
 import { mqttAccessInit } from './lib/mqtt/index.js';
 
 export const config = {
@@ -16,7 +16,8 @@ export const access = {
     access: accessFunc,
     accessByUserId,
     accessByUserName,
-    db
+    db,
+    dbReady
 };
 
 export const mqttAccess = {
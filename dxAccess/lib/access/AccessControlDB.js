@@ -27,16 +27,24 @@ class AccessControlDB {
      * 异步工厂方法 - 推荐使用这种方式创建实例
      */
     static async create(dbPath = '/data/db/access.db') {
-        // 先确保数据库目录存在
         const instance = new AccessControlDB();
-        await instance.ensureDbDirectory();
+        await instance.open(dbPath);
+        return instance;
+    }
+
+    /**
+     * 打开数据库连接并初始化表结构
+     * @param {string} dbPath - 数据库路径
+     */
+    async open(dbPath = '/data/db/access.db') {
+        // 先确保数据库目录存在
+        await this.ensureDbDirectory();
 
         // 然后设置数据库路径并创建连接
-        instance.dbPath = dbPath;
-        instance.db = new Database(dbPath);
+        this.dbPath = dbPath;
+        this.db = new Database(dbPath);
 
-        await instance.init();
-        return instance;
+        await this.init();
     }
 
 
@@ -166,7 +174,7 @@ class AccessControlDB {
                 endTime INTEGER NOT NULL,               -- 权限结束时间戳（Unix时间戳）
                 repeatBeginTime INTEGER,                -- 重复权限每日开始时间（HHMM格式，如0830表示8:30）
                 repeatEndTime INTEGER,                  -- 重复权限每日结束时间（HHMM格式，如1800表示18:00）
-                period TEXT,                            -- 重复周期，如"1,2,3,4,5"表示周一到周五，"1,3,5"表示周一三五
+                period TEXT,                            -- 周重复时段，JSON文本，如{"1":"08:00-12:00|14:00-18:00","5":"08:00-12:00"}，键为星期（1-7）
                 status INTEGER DEFAULT 1,               -- 权限状态：1-正常，0-禁用，-1-删除
                 extra TEXT,                             -- 扩展信息，JSON格式存储权限相关额外属性
                 created_at INTEGER DEFAULT (strftime('%s', 'now')),  -- 创建时间戳（Unix时间戳）
@@ -379,6 +387,25 @@ class AccessControlDB {
         });
     }
 
+    /**
+     * 获取最近通行过的用户姓名，按最近通行时间排序
+     * 只扫描最近的若干条通行记录，不随用户总数增长，用于启动时预热姓名字形
+     * @param {number} limit - 最多返回的姓名数
+     * @param {number} scan - 扫描的通行记录条数
+     * @returns {string[]}
+     */
+    getRecentUserNames(limit = 100, scan = 1000) {
+        const stmt = this.db.prepare(`
+            SELECT u.name FROM (
+                SELECT userId, MAX(accessTime) AS lastTime FROM (
+                    SELECT userId, accessTime FROM ac_access_record ORDER BY accessTime DESC LIMIT ?
+                ) GROUP BY userId
+            ) r JOIN ac_user u ON u.id = r.userId
+            ORDER BY r.lastTime DESC LIMIT ?
+        `);
+        return stmt.all(scan, limit).map(user => user.name);
+    }
+
     /**
      * 更新用户
      */
@@ -577,7 +604,7 @@ class AccessControlDB {
      * @param {string} [options.id] - 权限ID，如果不提供则自动生成
      * @param {number} [options.repeatBeginTime] - 重复权限每日开始时间（HHMM格式）
      * @param {number} [options.repeatEndTime] - 重复权限每日结束时间（HHMM格式）
-     * @param {string} [options.period] - 重复周期，如"1,2,3,4,5"表示周一到周五
+     * @param {string} [options.period] - 周重复时段（timeType=3），JSON文本，如{"1":"08:00-12:00|14:00-18:00"}，键为星期（1-7）
      * @param {number} [options.status=1] - 状态：1-正常，0-禁用，-1-删除
      * @param {Object} [options.extra] - 扩展信息
      * @returns {string} 权限ID
@@ -1363,11 +1390,28 @@ class AccessControlDB {
                     },
                     beginTime: repeatBeginTime,
                     endTime: repeatEndTime,
-                    weekPeriodTime: period
+                    weekPeriodTime: this.parsePeriod(period)
                 };
         }
     }
 
+    /**
+     * 解析周重复周期，数据库中以JSON文本存储，如 {"1":"08:00-12:00|14:00-18:00"}
+     * @param {string|Object} period - 周期
+     * @returns {Object|null} 星期(1-7) -> 时间段
+     */
+    parsePeriod(period) {
+        if (typeof period !== 'string') {
+            return period;
+        }
+        try {
+            return JSON.parse(period);
+        } catch (error) {
+            console.error('解析权限周期失败:', period);
+            return null;
+        }
+    }
+
     /**
      * 关闭数据库连接
      */
@@ -1377,15 +1421,17 @@ class AccessControlDB {
 }
 
 // 导出数据库实例
-let db;
+// 不在模块顶层等待数据库打开，避免阻塞整个模块图的加载；需要确认数据库可用时等待dbReady
+const db = new AccessControlDB();
 
-try {
-    db = await AccessControlDB.create();
+const dbReady = db.open().then(() => {
     console.log('数据库实例创建成功');
-} catch (error) {
+    return db;
+}).catch((error) => {
     console.error('创建数据库实例失败:', error);
-    // 创建一个空的实例作为fallback
-    db = new AccessControlDB();
     console.log('使用fallback数据库实例');
-}
+    return db;
+});
+
+export { dbReady };
 export default db;
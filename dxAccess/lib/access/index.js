@@ -1,5 +1,26 @@
-import db from './AccessControlDB.js';
+import db, { dbReady } from './AccessControlDB.js';
 import { timePermission } from './timePermission.js';
+import { metrics } from 'dxDriver';
+
+// 通行判定路径上的数据库查询次数与耗时，按查询名打标签
+const queryMetrics = new Map();
+function timedQuery(name, fn) {
+    let ids = queryMetrics.get(name);
+    if (!ids) {
+        ids = {
+            count: metrics.metricsRegister(`db_query_total{query="${name}"}`, metrics.METRIC_TYPE.COUNTER, '通行判定的数据库查询次数'),
+            time: metrics.metricsRegister(`db_query_time_us_total{query="${name}"}`, metrics.METRIC_TYPE.COUNTER, '通行判定的数据库查询累计耗时（微秒）')
+        };
+        queryMetrics.set(name, ids);
+    }
+    const start = performance.now();
+    try {
+        return fn();
+    } finally {
+        metrics.metricsAdd(ids.count, 1);
+        metrics.metricsAdd(ids.time, (performance.now() - start) * 1000);
+    }
+}
 
 /**
  * 核心权限验证逻辑
@@ -10,7 +31,7 @@ import { timePermission } from './timePermission.js';
 function validateUserPermissions(userId, credential = null) {
     try {
         // 1. 根据用户ID查询权限表记录
-        const permissions = db.getPermissionsByUserId(userId);
+        const permissions = timedQuery('permissions_by_user', () => db.getPermissionsByUserId(userId));
         if (!permissions || permissions.length === 0) {
             console.log(`[权限验证失败] 用户ID: ${userId}, 失败原因: 用户无任何权限`);
             return {
@@ -82,7 +103,7 @@ function access(type, code) {
 
     try {
         // 1. 根据type和code查询凭证记录
-        const credential = db.getCredentialByTypeAndCodeAccess(type, code);
+        const credential = timedQuery('credential_by_code', () => db.getCredentialByTypeAndCodeAccess(type, code));
         if (!credential) {
             console.log(`[门禁验证失败] 凭证类型: ${type}, 凭证值: ${code}, 失败原因: 凭证不存在或已失效`);
             return {
@@ -134,7 +155,7 @@ function accessByUserName(userName) {
 
     try {
         // 1. 根据用户姓名查询用户信息
-        const user = db.getUserByName(userName);
+        const user = timedQuery('user_by_name', () => db.getUserByName(userName));
         if (!user) {
             console.log(`[用户名验证失败] 用户名: ${userName}, 失败原因: 用户不存在`);
             return {
@@ -167,4 +188,4 @@ function accessByUserName(userName) {
     }
 }
 
-export { access, accessByUserId, accessByUserName, db };
\ No newline at end of file
+export { access, accessByUserId, accessByUserName, db, dbReady };
\ No newline at end of file
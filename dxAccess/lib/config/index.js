@@ -1339,14 +1339,23 @@ class ConfigManager {
 
 // 创建异步配置管理器实例
 let configManager = null;
+// 初始化中的Promise，启动时多个模块并发调用只创建一个实例
+let configManagerPromise = null;
 
 // 异步初始化配置管理器
 async function initConfigManager() {
-    if (!configManager) {
-        configManager = await ConfigManager.create();
-        onConfigKeyChangeService(onConfigChange, onConfigKeyChange)
+    if (!configManagerPromise) {
+        configManagerPromise = ConfigManager.create().then((manager) => {
+            configManager = manager;
+            onConfigKeyChangeService(onConfigChange, onConfigKeyChange)
+            return manager;
+        }).catch((error) => {
+            // 失败后允许下次调用重试
+            configManagerPromise = null;
+            throw error;
+        });
     }
-    return configManager;
+    return configManagerPromise;
 }
 
 // 导出配置管理器类
@@ -1137,16 +1137,10 @@ async function handleInsertPermission(payload) {
                     const repeatBeginTimeNum = repeatBeginTime ? parseInt(repeatBeginTime) : null;
                     const repeatEndTimeNum = repeatEndTime ? parseInt(repeatEndTime) : null;
 
-                    // 处理period参数，确保是字符串格式
+                    // period以JSON文本存储，如 {"1":"08:00-12:00|14:00-18:00"}，与读取方（parsePeriod、刷卡原生校验）一致
                     let periodStr = null;
                     if (period) {
-                        if (Array.isArray(period)) {
-                            periodStr = period.join(',');
-                        } else if (typeof period === 'string') {
-                            periodStr = period;
-                        } else {
-                            periodStr = String(period);
-                        }
+                        periodStr = typeof period === 'string' ? period : JSON.stringify(period);
                     }
 
                     // 调用数据库创建权限
@@ -1,5 +1,5 @@
 // 导入各个模块
-import { capturerInit, capturerDeinit } from './lib/capturer/index.js';
+import { capturerInit, capturerDeinit, CAPTURER_CHANNEL, getFramePoolStats } from './lib/capturer/index.js';
 import { getUuid, md5HashFile } from './lib/common/index.js';
 import {
     getEnableStatus,
@@ -9,17 +9,24 @@ import {
     getPowerMode,
     setPowerMode
 } from './lib/display/index.js';
-import { faceInit, faceUpdateConfig, getFaceRecognitionResult, getFaceTrackData, setFacePause, faceRegister, faceDeinit, faceGetSavedPicturePath } from './lib/face/index.js';
+import { faceInit, faceUpdateConfig, getFaceRecognitionResult, getFaceTrackData, setFacePause, faceRegister, faceDeinit, faceGetSavedPicturePath, faceSetDetectSchedule, faceGetDetectScheduleStats, faceSetSnapshotConfig, faceGetSnapshot, faceGetSyncStats, FACE_LATENCY_STAGE, faceLatencyMark, faceGetLatencyStats, faceLatencyReset } from './lib/face/index.js';
 import { mqttInit, mqttDeinit, setConnectedCallback, setStatusCallback, setMessageCallback, subscribe, publish } from './lib/mqtt/index.js';
 import { pwmRequest, pwmSetPeriodByChannel, pwmEnable, pwmSetDutyByChannel, pwmFree, setIrLedBrightness, setWhiteLedBrightness } from './lib/pwm/index.js';
-import { initGpio, deinitGpio, requestGpio, freeGpio, setFuncGpio, setPullStateGpio, getPullStateGpio, setValueGpio, getValueGpio, setDriveStrengthGpio, getDriveStrengthGpio, setRelayStatus } from './lib/gpio/index.js';
+import { initGpio, deinitGpio, requestGpio, freeGpio, setFuncGpio, setPullStateGpio, getPullStateGpio, setValueGpio, getValueGpio, setDriveStrengthGpio, getDriveStrengthGpio, setRelayStatus, GPIO_EVENT_TYPE, gpioPulse, relayPulse, gpioEventInit, gpioEventDeinit, onGpioEvent, gpioWatchHeld, gpioEventDropped } from './lib/gpio/index.js';
 import { audioInit, audioDeinit, audioPlay, audioPlayingInterrupt, audioGetVolume, audioSetVolume, audioGetVolumeRange } from './lib/audio/index.js';
+import { imgCacheSetSize, imgCacheInvalidateAll, OVERLAY_MODE, OVERLAY_STATE, overlayInit, overlayDeinit, overlaySetMode, overlaySetImage, overlaySetState, overlayLostCount, overlaySetLabel, overlaySetFont, fontCacheInit, fontPrewarm, fontCount, VirtualList, ANIM_PROP, ANIM_TARGET, withHandle, animTarget, NativeAnimation, frameWatch, frameCount, profStart, profStop, profReport, NativeCanvas, PAGE_ANIM, Page, pageSetBudget } from './lib/lvgl/index.js';
+import { CHANNEL_TYPE, WIEGAND_MODE, channelOpen, channelClose, channelSetUartParam, channelSetWiegand, channelSend, channelSendWiegand } from './lib/channel/index.js';
+import { NFC_REASON, nfcInit, nfcDeinit, nfcSetOptions, nfcReloadCredentials, nfcGetResult, nfcGetStats } from './lib/nfc/index.js';
+import { METRIC_TYPE, metricsRegister, metricsAdd, metricsSet, metricsGet, metricsRender, metricsWatchEventLoop } from './lib/metrics/index.js';
+import { bytecodeBuild, bytecodeRun } from './lib/bytecode/index.js';
 
 
 // 摄像头模块
 export const capturer = {
     capturerInit,
-    capturerDeinit
+    capturerDeinit,
+    CAPTURER_CHANNEL,
+    getFramePoolStats
 };
 
 // 人脸识别模块
@@ -31,7 +38,16 @@ export const face = {
     setFacePause,
     faceRegister,
     faceDeinit,
-    faceGetSavedPicturePath
+    faceGetSavedPicturePath,
+    faceSetDetectSchedule,
+    faceGetDetectScheduleStats,
+    faceSetSnapshotConfig,
+    faceGetSnapshot,
+    faceGetSyncStats,
+    FACE_LATENCY_STAGE,
+    faceLatencyMark,
+    faceGetLatencyStats,
+    faceLatencyReset
 };
 
 // MQTT模块
@@ -85,7 +101,15 @@ export const gpio = {
     getValueGpio,
     setDriveStrengthGpio,
     getDriveStrengthGpio,
-    setRelayStatus
+    setRelayStatus,
+    GPIO_EVENT_TYPE,
+    gpioPulse,
+    relayPulse,
+    gpioEventInit,
+    gpioEventDeinit,
+    onGpioEvent,
+    gpioWatchHeld,
+    gpioEventDropped
 };
 
 // 音频模块
@@ -98,3 +122,77 @@ export const audio = {
     audioSetVolume,
     audioGetVolumeRange
 };
+
+// LVGL运行时模块
+export const lvgl = {
+    imgCacheSetSize,
+    imgCacheInvalidateAll,
+    OVERLAY_MODE,
+    OVERLAY_STATE,
+    overlayInit,
+    overlayDeinit,
+    overlaySetMode,
+    overlaySetImage,
+    overlaySetState,
+    overlayLostCount,
+    overlaySetLabel,
+    overlaySetFont,
+    fontCacheInit,
+    fontPrewarm,
+    fontCount,
+    VirtualList,
+    ANIM_PROP,
+    ANIM_TARGET,
+    withHandle,
+    animTarget,
+    NativeAnimation,
+    frameWatch,
+    frameCount,
+    profStart,
+    profStop,
+    profReport,
+    NativeCanvas,
+    PAGE_ANIM,
+    Page,
+    pageSetBudget
+};
+
+// NFC刷卡模块
+export const nfc = {
+    NFC_REASON,
+    nfcInit,
+    nfcDeinit,
+    nfcSetOptions,
+    nfcReloadCredentials,
+    nfcGetResult,
+    nfcGetStats
+};
+
+// 输出信道模块（UART、韦根）
+export const channel = {
+    CHANNEL_TYPE,
+    WIEGAND_MODE,
+    channelOpen,
+    channelClose,
+    channelSetUartParam,
+    channelSetWiegand,
+    channelSend,
+    channelSendWiegand
+};
+
+// 运行指标模块（共享内存，webserver /metrics 接口输出）
+export const metrics = {
+    METRIC_TYPE,
+    metricsRegister,
+    metricsAdd,
+    metricsSet,
+    metricsGet,
+    metricsRender,
+    metricsWatchEventLoop
+};
+
+// 模块字节码镜像（启动时跳过源码解析）
+export const bytecode = {
+    bytecodeBuild,
+    bytecodeRun
+};
@@ -0,0 +1,73 @@
+import FFI from 'tjs:ffi';
+// 启动引导直接引用本文件，除 tjs:ffi 和原生库加载外不要引入 dxDriver 的其他模块
+import { nativeFunction } from '../native/index.js';
+
+// 驱动库不存在（旧固件）时不生成镜像，始终从源码加载
+const BYTECODE_LIB = 'libbytecode_wrapper.so';
+
+const bytecode_build_async = nativeFunction(BYTECODE_LIB, 'bytecode_build_async', FFI.types.sint, [FFI.types.string, FFI.types.string]);
+const bytecode_open = nativeFunction(BYTECODE_LIB, 'bytecode_open', FFI.types.sint, [FFI.types.string]);
+const bytecode_size = nativeFunction(BYTECODE_LIB, 'bytecode_size', FFI.types.sint, [FFI.types.sint]);
+const bytecode_read = nativeFunction(BYTECODE_LIB, 'bytecode_read', FFI.types.sint, [FFI.types.sint, FFI.types.buffer, FFI.types.size]);
+const bytecode_close = nativeFunction(BYTECODE_LIB, 'bytecode_close', FFI.types.void, []);
+
+// 字节码的反序列化和执行必须在当前引擎的上下文中进行，由引擎提供；没有时退回源码加载
+function getEngine() {
+    const engine = globalThis.tjs?.engine ?? globalThis[Symbol.for('tjs.internal.core')];
+    if (engine && typeof engine.deserialize === 'function' && typeof engine.evalBytecode === 'function') {
+        return engine;
+    }
+    return null;
+}
+
+/**
+ * 在后台线程编译模块并生成字节码镜像，完成后下次启动生效，结果输出到日志
+ * @param {string} imagePath 镜像文件
+ * @param {string[]} modules 模块源文件绝对路径，第一个为入口，路径即模块名（需与源码加载时一致）
+ * @returns {boolean} 是否已开始编译
+ */
+function bytecodeBuild(imagePath, modules) {
+    return bytecode_build_async.call(imagePath, modules.join('\n')) === 0;
+}
+
+/**
+ * 从字节码镜像加载并执行入口模块，不解析源码
+ * 镜像不存在、已失效（源文件或引擎有变化）或引擎不支持时返回 null，由调用方改为加载源码
+ * @param {string} imagePath 镜像文件
+ * @returns {Promise|null} 入口模块执行结果
+ */
+function bytecodeRun(imagePath) {
+    const engine = getEngine();
+    if (!engine) {
+        return null;
+    }
+    const count = bytecode_open.call(imagePath);
+    if (count <= 0) {
+        return null;
+    }
+    let entry = null;
+    try {
+        // 先反序列化全部模块，依赖模块注册后入口模块才能链接；镜像中的数据逐个复制后立即交给引擎
+        for (let i = 0; i < count; i++) {
+            const size = bytecode_size.call(i);
+            const buf = new Uint8Array(size);
+            if (bytecode_read.call(i, buf, size) !== size) {
+                return null;
+            }
+            const obj = engine.deserialize(buf);
+            if (i === 0) {
+                entry = obj;
+            }
+        }
+    } catch (error) {
+        // 字节码版本与引擎不符等情况，模块尚未执行，可以改用源码
+        console.log('字节码加载失败:', error);
+        return null;
+    } finally {
+        bytecode_close.call();
+    }
+    // 执行阶段的异常属于 app 本身，不再退回源码，避免模块执行两次
+    return (async () => engine.evalBytecode(entry))();
+}
+
+export { bytecodeBuild, bytecodeRun };
@@ -1,4 +1,5 @@
 import FFI from 'tjs:ffi';
+import { nativeFunction } from '../native/index.js';
 
 let sopath = '/os/driver/';
 sopath = sopath + './libcapturer_wrapper.so';
@@ -29,6 +30,27 @@ const capturerNirDeinit = new FFI.CFunction(
     []
 );
 
+const capturer_frame_pool_stats_t = new FFI.StructType([
+    ['in_use', FFI.types.uint32],      // 当前被持有的帧数
+    ['peak', FFI.types.uint32],        // 同时被持有的最大帧数
+    ['reads', FFI.types.uint64],       // 从驱动读取的帧数
+    ['untracked', FFI.types.uint64]    // 池满未登记的帧数
+], 'capturer_frame_pool_stats_t');
+
+// 帧池接口较新，旧版驱动库没有时统计全部为0
+const capturerFramePoolGetStats = nativeFunction(
+    'libcapturer_wrapper.so',
+    'capturer_frame_pool_get_stats',
+    FFI.types.void,
+    [FFI.types.sint, new FFI.PointerType(capturer_frame_pool_stats_t, 1)]
+);
+
+// 摄像头通道
+const CAPTURER_CHANNEL = {
+    RGB: 0,
+    NIR: 1,
+};
+
 let rgbCapturer = null;
 let nirCapturer = null;
 
@@ -49,5 +71,15 @@ function capturerDeinit() {
     capturerNirDeinit.call();
 }
 
+/**
+ * 获取帧池使用情况
+ * @param {number} channel CAPTURER_CHANNEL
+ * @returns {{in_use: number, peak: number, reads: number, untracked: number}}
+ */
+function getFramePoolStats(channel) {
+    const statsBuffer = capturer_frame_pool_stats_t.toBuffer({ in_use: 0, peak: 0, reads: 0, untracked: 0 });
+    capturerFramePoolGetStats.call(channel, FFI.Pointer.createRefFromBuf(capturer_frame_pool_stats_t, statsBuffer));
+    return capturer_frame_pool_stats_t.fromBuffer(statsBuffer);
+}
 
-export { capturerInit, capturerDeinit };
\ No newline at end of file
+export { capturerInit, capturerDeinit, CAPTURER_CHANNEL, getFramePoolStats };
\ No newline at end of file
@@ -0,0 +1,141 @@
+import FFI from 'tjs:ffi';
+
+import { nativeFunction } from '../native/index.js';
+
+// 驱动库不存在（旧固件）时信道打开失败，发送返回0
+const CHANNEL_LIB = 'libchannel_wrapper.so';
+
+const structEvent = new FFI.StructType([
+    ['seq', FFI.types.uint32],
+    ['channel', FFI.types.sint],
+    ['result', FFI.types.sint],
+    ['wait_us', FFI.types.uint32],
+    ['send_us', FFI.types.uint32]
+], 'channel_event_t');
+
+const channelOpen1 = nativeFunction(CHANNEL_LIB, 'channel_open', FFI.types.sint, [FFI.types.sint, FFI.types.string]);
+const channelClose1 = nativeFunction(CHANNEL_LIB, 'channel_close', FFI.types.void, [FFI.types.sint]);
+const channelSetUartParam1 = nativeFunction(CHANNEL_LIB, 'channel_set_uart_param', FFI.types.sint, [FFI.types.sint, FFI.types.string]);
+const channelSetWiegand1 = nativeFunction(CHANNEL_LIB, 'channel_set_wiegand', FFI.types.sint, [FFI.types.sint, FFI.types.sint, FFI.types.sint, FFI.types.sint]);
+const channelSend1 = nativeFunction(CHANNEL_LIB, 'channel_send', FFI.types.uint32, [FFI.types.sint, FFI.types.buffer, FFI.types.uint32], 0);
+const channelSendWiegand1 = nativeFunction(CHANNEL_LIB, 'channel_send_wiegand', FFI.types.uint32, [FFI.types.sint, FFI.types.uint32], 0);
+const channelGetEvent1 = nativeFunction(
+    CHANNEL_LIB,
+    'channel_get_event',
+    FFI.types.sint,
+    [new FFI.PointerType(structEvent, 1)]
+);
+
+// 信道类型，与 channel.h 的 vbar_m_channel_type 一致
+const CHANNEL_TYPE = {
+    UART: 3,
+    WIEGAND: 4,
+};
+
+// 韦根模式，与 channel.h 的 vbar_m_channel_wiegand_mode 一致
+const WIEGAND_MODE = {
+    W26: 1,
+    W34: 2,
+};
+
+// 发送序号 -> 完成回调
+const pendingCallbacks = new Map();
+let pollTimer = null;
+
+function pollEvents() {
+    const eventBuffer = structEvent.toBuffer({ seq: 0, channel: 0, result: 0, wait_us: 0, send_us: 0 });
+    const eventPtr = FFI.Pointer.createRefFromBuf(structEvent, eventBuffer);
+    while (channelGetEvent1.call(eventPtr) === 1) {
+        const event = structEvent.fromBuffer(eventBuffer);
+        const callback = pendingCallbacks.get(event.seq);
+        if (callback) {
+            pendingCallbacks.delete(event.seq);
+            callback(event);
+        }
+    }
+    // 没有等待中的回调时停止轮询
+    if (pendingCallbacks.size === 0) {
+        clearInterval(pollTimer);
+        pollTimer = null;
+    }
+}
+
+function watch(seq, callback) {
+    if (!seq || !callback) {
+        return;
+    }
+    pendingCallbacks.set(seq, callback);
+    if (!pollTimer) {
+        pollTimer = setInterval(pollEvents, 20);
+    }
+}
+
+/**
+ * 打开输出信道，发送由信道自己的线程完成
+ * @param {number} type 信道类型 CHANNEL_TYPE
+ * @param {string} path 设备路径，如 /dev/ttyS2、/dev/vg-wiegand0
+ * @returns {number} 信道号，-1失败
+ */
+function channelOpen(type, path) {
+    return channelOpen1.call(type, path);
+}
+
+/**
+ * 关闭信道，未发出的数据以失败回调
+ */
+function channelClose(channel) {
+    channelClose1.call(channel);
+}
+
+/**
+ * 设置串口参数
+ * @param {number} channel 信道号
+ * @param {string} param 如 "115200-8-N-1"
+ */
+function channelSetUartParam(channel, param) {
+    return channelSetUartParam1.call(channel, param);
+}
+
+/**
+ * 设置韦根输出模式和时序
+ * @param {number} channel 信道号
+ * @param {Object} options
+ * @param {number} options.mode 韦根模式 WIEGAND_MODE
+ * @param {number} options.busyTime 脉宽
+ * @param {number} options.freeTime 脉冲间隔
+ */
+function channelSetWiegand(channel, options = {}) {
+    return channelSetWiegand1.call(channel, options.mode ?? WIEGAND_MODE.W26, options.busyTime ?? 100, options.freeTime ?? 1000);
+}
+
+/**
+ * 发送数据，立即返回，不等待发送完成
+ * @param {number} channel 信道号
+ * @param {string|Uint8Array} data 数据
+ * @param {Function} callback 可选，发送完成回调，参数为 {seq, channel, result, wait_us, send_us}，result为0表示成功
+ * @returns {number} 发送序号，0表示入队失败
+ */
+function channelSend(channel, data, callback) {
+    const buffer = typeof data === 'string' ? new TextEncoder().encode(data) : data;
+    const seq = channelSend1.call(channel, buffer, buffer.length);
+    watch(seq, callback);
+    return seq;
+}
+
+/**
+ * 按当前韦根模式发送卡号
+ * @param {number} channel 信道号
+ * @param {number} number 卡号，26位模式不超过24位（0xFFFFFF），34位模式为32位
+ * @param {Function} callback 可选，发送完成回调，同channelSend
+ * @returns {number} 发送序号，0表示失败（含卡号超出当前模式位数）
+ */
+function channelSendWiegand(channel, number, callback) {
+    if (!Number.isInteger(number) || number < 0 || number > 0xFFFFFFFF) {
+        return 0;
+    }
+    const seq = channelSendWiegand1.call(channel, number);
+    watch(seq, callback);
+    return seq;
+}
+
+export { CHANNEL_TYPE, WIEGAND_MODE, channelOpen, channelClose, channelSetUartParam, channelSetWiegand, channelSend, channelSendWiegand };
@@ -1,4 +1,5 @@
 import FFI from 'tjs:ffi';
+import { nativeFunction } from '../native/index.js';
 import path from 'tjs:path';
 const ffiInt = globalThis[Symbol.for('tjs.internal.core')].ffi_load_native();
 
@@ -23,6 +24,7 @@ faceLib.parseCProto(`
         float score;
         int is_living;
         int living_score;
+        unsigned int trace_id;
     };
     struct face_config_t
     {
@@ -30,12 +32,58 @@ faceLib.parseCProto(`
     };
     void face_init(void *rgb, void *nir, struct face_config_t *options);
     void face_update_config(struct face_config_t *options);
+    struct detect_schedule_stats_t
+    {
+        unsigned int active;
+        unsigned int accepted;
+        unsigned int skipped;
+        unsigned int motion;
+    };
+    struct snapshot_config_t
+    {
+        uint32_t picture_target;
+        uint32_t thumb_target;
+        uint32_t cache_max_bytes;
+        int store_to_disk;
+    };
+    struct snapshot_info_t
+    {
+        unsigned int seq;
+        uint32_t picture_len;
+        uint32_t thumb_len;
+        int picture_quality;
+        int thumb_quality;
+    };
+    struct sync_stats_t
+    {
+        unsigned int pairs;
+        unsigned int dropped;
+        long long last_skew;
+        long long max_skew;
+        long long avg_skew;
+    };
+    struct latency_stats_t
+    {
+        uint32_t count;
+        uint32_t min_us;
+        uint32_t max_us;
+        uint32_t mean_us;
+        uint32_t p50_us;
+        uint32_t p90_us;
+        uint32_t p99_us;
+        uint32_t p999_us;
+    };
 `);
 
 
 const structTrack = faceLib.getType('struct track_t');
 const structRecognition = faceLib.getType('struct recognition_t');
 const structFaceConfig = faceLib.getType('struct face_config_t');
+const structDetectScheduleStats = faceLib.getType('struct detect_schedule_stats_t');
+const structSnapshotConfig = faceLib.getType('struct snapshot_config_t');
+const structSnapshotInfo = faceLib.getType('struct snapshot_info_t');
+const structSyncStats = faceLib.getType('struct sync_stats_t');
+const structLatencyStats = faceLib.getType('struct latency_stats_t');
 
 
 const faceGetTrackData1 = new FFI.CFunction(faceLib.symbol('get_face_track_data'), structTrack, []);
@@ -79,6 +127,72 @@ const faceSetRecognitionResult1 = new FFI.CFunction(
     [FFI.types.sint]
 );
 
+// 以下接口较新，驱动库未更新时首次调用打印日志，对应功能不可用，不影响识别
+const FACE_LIB = 'libface_wrapper.so';
+
+const faceSetDetectSchedule1 = nativeFunction(
+    FACE_LIB,
+    'face_set_detect_schedule',
+    FFI.types.void,
+    [FFI.types.sint, FFI.types.sint, FFI.types.sint]
+);
+
+const faceGetDetectScheduleStats1 = nativeFunction(
+    FACE_LIB,
+    'face_get_detect_schedule_stats',
+    FFI.types.void,
+    [new FFI.PointerType(structDetectScheduleStats, 1)]
+);
+
+const faceGetSnapshotInfo1 = nativeFunction(
+    FACE_LIB,
+    'face_get_snapshot_info',
+    FFI.types.void,
+    [new FFI.PointerType(structSnapshotInfo, 1)]
+);
+
+const faceCopySnapshot1 = nativeFunction(
+    FACE_LIB,
+    'face_copy_snapshot',
+    FFI.types.sint,
+    [FFI.types.uint32, FFI.types.buffer, FFI.types.uint32, FFI.types.buffer, FFI.types.uint32]
+);
+
+const faceGetSyncStats1 = nativeFunction(
+    FACE_LIB,
+    'face_get_sync_stats',
+    FFI.types.void,
+    [new FFI.PointerType(structSyncStats, 1)]
+);
+
+const faceLatencyMark1 = nativeFunction(
+    FACE_LIB,
+    'face_latency_mark',
+    FFI.types.void,
+    [FFI.types.uint32, FFI.types.sint]
+);
+
+const faceGetLatencyStats1 = nativeFunction(
+    FACE_LIB,
+    'face_get_latency_stats',
+    FFI.types.sint,
+    [FFI.types.sint, new FFI.PointerType(structLatencyStats, 1)]
+);
+
+const faceLatencyReset1 = nativeFunction(
+    FACE_LIB,
+    'face_latency_reset',
+    FFI.types.void,
+    []
+);
+
+const faceSetSnapshotConfig1 = nativeFunction(
+    FACE_LIB,
+    'face_set_snapshot_config',
+    FFI.types.void,
+    [new FFI.PointerType(structSnapshotConfig, 1)]
+);
+
 const faceGetSavedPicturePath1 = new FFI.CFunction(
     faceLib.symbol('get_saved_picture_path'),
     FFI.types.void,
@@ -99,7 +213,8 @@ function getFaceTrackData() {
 
 /**
  * 获取人脸识别结果
- * @param {*} callback 回调函数,参数为recognition_t(userid: string, score: number, is_living: number, living_score: number),返回值为boolean,如果返回true,则保存图片
+ * @param {*} callback 回调函数,参数为recognition_t(userid: string, score: number, is_living: number, living_score: number, trace_id: number),返回值为boolean,如果返回true,则保存图片
+ * trace_id 为时延跟踪号，权限判定、结果提示后分别用 faceLatencyMark 打时间戳
  * @returns 
  */
 function getFaceRecognitionResult(callback) {
@@ -189,8 +304,120 @@ function faceGetSavedPicturePath() {
     return { path: FFI.bufferToString(path), thumbPath: FFI.bufferToString(thumbPath) };
 }
 
+/**
+ * 设置检测调度参数：无人且画面静止时降低检测频率
+ * @param {number} idleInterval 空闲时每隔多少帧检测一次，1为逐帧检测
+ * @param {number} motionThreshold 网格亮度变化超过该值视为运动
+ * @param {number} holdMs 运动或人脸消失后保持逐帧检测的时间(ms)
+ */
+function faceSetDetectSchedule(idleInterval = 5, motionThreshold = 12, holdMs = 2000) {
+    faceSetDetectSchedule1.call(idleInterval, motionThreshold, holdMs);
+}
+
+/**
+ * 获取检测调度统计
+ * @returns {{active: number, accepted: number, skipped: number, motion: number}}
+ */
+function faceGetDetectScheduleStats() {
+    const statsBuffer = structDetectScheduleStats.toBuffer({ active: 0, accepted: 0, skipped: 0, motion: 0 });
+    faceGetDetectScheduleStats1.call(FFI.Pointer.createRefFromBuf(structDetectScheduleStats, statsBuffer));
+    return structDetectScheduleStats.fromBuffer(statsBuffer);
+}
+
+/**
+ * 设置抓拍参数
+ * @param {object} options
+ * @param {number} options.pictureTarget 大图目标字节数，0不限制
+ * @param {number} options.thumbTarget 缩略图目标字节数，0不限制
+ * @param {number} options.cacheMaxBytes 通行抓拍目录总字节数上限，超出删除最旧文件，0不限制
+ * @param {number} options.storeToDisk 通行抓拍是否落盘，为0时只保留在内存中，通过faceGetSnapshot读取
+ */
+function faceSetSnapshotConfig(options = {}) {
+    faceSetSnapshotConfig1.call(FFI.Pointer.createRef(structSnapshotConfig, {
+        picture_target: options.pictureTarget ?? 60 * 1024,
+        thumb_target: options.thumbTarget ?? 12 * 1024,
+        cache_max_bytes: options.cacheMaxBytes ?? 64 * 1024 * 1024,
+        store_to_disk: options.storeToDisk ?? 1,
+    }));
+}
+
+/**
+ * 获取最近一次抓拍的JPEG数据（内存中，不读文件）
+ * @param {number} lastSeq 上次读取的序号，序号未变化时返回null
+ * @returns {{seq: number, picture: Uint8Array, thumb: Uint8Array, pictureQuality: number, thumbQuality: number}|null}
+ */
+function faceGetSnapshot(lastSeq = 0) {
+    const infoBuffer = structSnapshotInfo.toBuffer({ seq: 0, picture_len: 0, thumb_len: 0, picture_quality: 0, thumb_quality: 0 });
+    faceGetSnapshotInfo1.call(FFI.Pointer.createRefFromBuf(structSnapshotInfo, infoBuffer));
+    const info = structSnapshotInfo.fromBuffer(infoBuffer);
+    if (info.seq === 0 || info.seq === lastSeq) {
+        return null;
+    }
+    const picture = new Uint8Array(info.picture_len);
+    const thumb = new Uint8Array(info.thumb_len);
+    // 大图和缩略图在同一次加锁中拷贝；取信息后已有新的抓拍时放弃本次读取
+    if (faceCopySnapshot1.call(info.seq, picture, picture.length, thumb, thumb.length) !== 0) {
+        return null;
+    }
+    return { seq: info.seq, picture, thumb, pictureQuality: info.picture_quality, thumbQuality: info.thumb_quality };
+}
+
+/**
+ * 获取红外/彩色帧配对统计，时间差单位与驱动帧时间戳一致
+ * @returns {{pairs: number, dropped: number, last_skew: number, max_skew: number, avg_skew: number}}
+ */
+function faceGetSyncStats() {
+    const statsBuffer = structSyncStats.toBuffer({ pairs: 0, dropped: 0, last_skew: 0, max_skew: 0, avg_skew: 0 });
+    faceGetSyncStats1.call(FFI.Pointer.createRefFromBuf(structSyncStats, statsBuffer));
+    return structSyncStats.fromBuffer(statsBuffer);
+}
+
+// 识别链路阶段，与 latency.h 的 latency_stage 一致；JS 只需标记 ACCESS、RESULT
+const FACE_LATENCY_STAGE = {
+    FRAME: 0,
+    DETECT: 1,
+    RECOGNIZE: 2,
+    COMPARE: 3,
+    POLL: 4,
+    ACCESS: 5,
+    RESULT: 6,
+};
+
+// 直方图名称，下标即原生直方图编号：total为帧采集到结果提示，其余为上一阶段到该阶段
+const LATENCY_HIST_NAMES = ['total', 'detect', 'recognize', 'compare', 'poll', 'access', 'result'];
+
+/**
+ * 识别事件经过某一阶段时打时间戳，RESULT 阶段结束跟踪并计入统计
+ * @param {number} traceId 识别结果中的 trace_id
+ * @param {number} stage FACE_LATENCY_STAGE.ACCESS 或 FACE_LATENCY_STAGE.RESULT
+ */
+function faceLatencyMark(traceId, stage) {
+    if (traceId) {
+        faceLatencyMark1.call(traceId, stage);
+    }
+}
+
+/**
+ * 获取识别链路各阶段时延统计（微秒），可直接序列化为报告
+ * @returns {{total: Object, detect: Object, recognize: Object, compare: Object, poll: Object, access: Object, result: Object}}
+ * 每项为 {count, min_us, max_us, mean_us, p50_us, p90_us, p99_us, p999_us}
+ */
+function faceGetLatencyStats() {
+    const stats = {};
+    LATENCY_HIST_NAMES.forEach((name, index) => {
+        const statsBuffer = structLatencyStats.toBuffer({ count: 0, min_us: 0, max_us: 0, mean_us: 0, p50_us: 0, p90_us: 0, p99_us: 0, p999_us: 0 });
+        faceGetLatencyStats1.call(index, FFI.Pointer.createRefFromBuf(structLatencyStats, statsBuffer));
+        stats[name] = structLatencyStats.fromBuffer(statsBuffer);
+    });
+    return stats;
+}
+
+function faceLatencyReset() {
+    faceLatencyReset1.call();
+}
+
 function faceDeinit() {
     faceDeinit1.call();
 }
 
-export { faceInit, getFaceTrackData, getFaceRecognitionResult, faceUpdateConfig, setFacePause, faceRegister, faceDeinit, faceGetSavedPicturePath };
\ No newline at end of file
+export { faceInit, getFaceTrackData, getFaceRecognitionResult, faceUpdateConfig, setFacePause, faceRegister, faceDeinit, faceGetSavedPicturePath, faceSetDetectSchedule, faceGetDetectScheduleStats, faceSetSnapshotConfig, faceGetSnapshot, faceGetSyncStats, FACE_LATENCY_STAGE, faceLatencyMark, faceGetLatencyStats, faceLatencyReset };
\ No newline at end of file
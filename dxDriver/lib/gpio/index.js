@@ -1,9 +1,23 @@
 import FFI from 'tjs:ffi';
+import { nativeFunction } from '../native/index.js';
 
 let sopath = '/os/driver/';
 sopath = sopath + './libgpio_wrapper.so';
 const gpioLib = new FFI.Lib(sopath);
 
+gpioLib.parseCProto(`
+    struct gpio_event_t
+    {
+        uint32_t seq;
+        int type;
+        int code;
+        int value;
+        long long timestamp_us;
+    };
+`);
+
+const structEvent = gpioLib.getType('struct gpio_event_t');
+
 const init_gpio = new FFI.CFunction(gpioLib.symbol('init_gpio'), FFI.types.sint, []);
 const deinit_gpio = new FFI.CFunction(gpioLib.symbol('deinit_gpio'), FFI.types.void, []);
 const request_gpio = new FFI.CFunction(gpioLib.symbol('request_gpio'), FFI.types.sint, [FFI.types.uint32]);
@@ -15,6 +29,14 @@ const set_value_gpio = new FFI.CFunction(gpioLib.symbol('set_value_gpio'), FFI.t
 const get_value_gpio = new FFI.CFunction(gpioLib.symbol('get_value_gpio'), FFI.types.sint, [FFI.types.uint32]);
 const set_drive_strength_gpio = new FFI.CFunction(gpioLib.symbol('set_drive_strength_gpio'), FFI.types.void, [FFI.types.uint32, FFI.types.uint16]);
 const get_drive_strength_gpio = new FFI.CFunction(gpioLib.symbol('get_drive_strength_gpio'), FFI.types.uint16, [FFI.types.uint32]);
+// 事件、脉冲接口较新，驱动库未更新时输入事件不可用，脉冲退回JS定时器
+const GPIO_LIB = 'libgpio_wrapper.so';
+const gpio_event_init = nativeFunction(GPIO_LIB, 'gpio_event_init', FFI.types.sint, []);
+const gpio_event_deinit = nativeFunction(GPIO_LIB, 'gpio_event_deinit', FFI.types.void, []);
+const gpio_event_read = nativeFunction(GPIO_LIB, 'gpio_event_read', FFI.types.sint, [FFI.types.buffer, FFI.types.sint]);
+const gpio_event_dropped = nativeFunction(GPIO_LIB, 'gpio_event_dropped', FFI.types.uint32, [], 0);
+const gpio_event_watch_held = nativeFunction(GPIO_LIB, 'gpio_event_watch_held', FFI.types.sint, [FFI.types.sint, FFI.types.sint, FFI.types.sint]);
+const gpio_pulse = nativeFunction(GPIO_LIB, 'gpio_pulse', FFI.types.sint, [FFI.types.uint32, FFI.types.sint]);
 
 let hasInit = false;
 function initGpio() {
@@ -81,7 +103,131 @@ const GPIO_OUTPUT1 = 0x05;// 0101, GPIO output high level
 function setRelayStatus(status) {
     initGpio();
     requestGpio(relayGpio);
+    // 取消未到期的自动断开，以本次设置为准
+    gpioPulse(relayGpio, 0);
     setFuncGpio(relayGpio, status ? GPIO_OUTPUT1 : GPIO_OUTPUT0);
 }
 
-export { initGpio, deinitGpio, requestGpio, freeGpio, setFuncGpio, setPullStateGpio, getPullStateGpio, setValueGpio, getValueGpio, setDriveStrengthGpio, getDriveStrengthGpio, setRelayStatus };
\ No newline at end of file
+/**
+ * 输出脉冲，到期由驱动线程拉低，不依赖JS定时器；输出期间再次调用只延长时长
+ * @param {number} gpio gpio号
+ * @param {number} ms 脉冲时长，0表示取消未到期的自动拉低
+ */
+function gpioPulse(gpio, ms) {
+    if (gpio_pulse.available()) {
+        return gpio_pulse.call(gpio, ms);
+    }
+    return jsPulse(gpio, ms);
+}
+
+// 驱动库不支持脉冲时由JS定时器拉低，gpio -> 定时器
+const pulseTimers = new Map();
+
+function jsPulse(gpio, ms) {
+    const timer = pulseTimers.get(gpio);
+    if (timer) {
+        clearTimeout(timer);
+        pulseTimers.delete(gpio);
+    } else if (ms > 0) {
+        initGpio();
+        requestGpio(gpio);
+        setFuncGpio(gpio, GPIO_OUTPUT1);
+    }
+    if (ms > 0) {
+        pulseTimers.set(gpio, setTimeout(() => {
+            pulseTimers.delete(gpio);
+            setFuncGpio(gpio, GPIO_OUTPUT0);
+        }, ms));
+    }
+    return 0;
+}
+
+/**
+ * 开门：继电器吸合 ms 毫秒后自动断开
+ */
+function relayPulse(ms) {
+    return gpioPulse(relayGpio, ms);
+}
+
+// 事件类型，与 gpio_wrapper.h 的 gpio_event_type 一致
+const GPIO_EVENT_TYPE = {
+    EDGE: 0,
+    HELD: 1,
+};
+
+// 每次最多取出的事件数
+const EVENT_BATCH = 32;
+const eventSize = structEvent.toBuffer({ seq: 0, type: 0, code: 0, value: 0, timestamp_us: 0 }).length;
+const eventBuffer = new Uint8Array(eventSize * EVENT_BATCH);
+const eventCallbacks = [];
+let eventTimer = null;
+let eventInit = false;
+
+function gpioEventInit() {
+    if (eventInit) {
+        return 0;
+    }
+    const ret = gpio_event_init.call();
+    eventInit = ret === 0;
+    return ret;
+}
+
+function gpioEventDeinit() {
+    if (!eventInit) {
+        return;
+    }
+    eventInit = false;
+    clearInterval(eventTimer);
+    eventTimer = null;
+    eventCallbacks.length = 0;
+    gpio_event_deinit.call();
+}
+
+function pollEvents() {
+    let count;
+    do {
+        count = gpio_event_read.call(eventBuffer, EVENT_BATCH);
+        if (count <= 0) {
+            return;
+        }
+        const events = [];
+        for (let i = 0; i < count; i++) {
+            const event = structEvent.fromBuffer(eventBuffer.subarray(i * eventSize, (i + 1) * eventSize));
+            event.timestamp_us = Number(event.timestamp_us);
+            events.push(event);
+        }
+        eventCallbacks.forEach(callback => callback(events));
+    } while (count === EVENT_BATCH);
+}
+
+/**
+ * 订阅输入事件，边沿由驱动中断上报并带时间戳，按批回调
+ * @param {Function} callback 参数为事件数组 [{seq, type, code, value, timestamp_us}]
+ */
+function onGpioEvent(callback) {
+    if (gpioEventInit() !== 0) {
+        return -1;
+    }
+    eventCallbacks.push(callback);
+    if (!eventTimer) {
+        eventTimer = setInterval(pollEvents, 20);
+    }
+    return 0;
+}
+
+/**
+ * 监视输入保持有效电平的时长（如门长开），超时由驱动线程立即产生 HELD 事件
+ * @param {number} code 按键码
+ * @param {number} activeValue 有效电平
+ * @param {number} timeoutMs 超时时间，0表示取消监视
+ */
+function gpioWatchHeld(code, activeValue, timeoutMs) {
+    return gpio_event_watch_held.call(code, activeValue, timeoutMs);
+}
+
+// 因队列满被丢弃的事件数
+function gpioEventDropped() {
+    return gpio_event_dropped.call();
+}
+
+export { initGpio, deinitGpio, requestGpio, freeGpio, setFuncGpio, setPullStateGpio, getPullStateGpio, setValueGpio, getValueGpio, setDriveStrengthGpio, getDriveStrengthGpio, setRelayStatus, GPIO_EVENT_TYPE, gpioPulse, relayPulse, gpioEventInit, gpioEventDeinit, onGpioEvent, gpioWatchHeld, gpioEventDropped };
\ No newline at end of file
@@ -0,0 +1,979 @@
+import FFI from 'tjs:ffi';
+import { nativeFunction } from '../native/index.js';
+
+// 驱动库较新，旧固件上没有时界面照常运行，只是原生加速的功能不可用
+const LVGL_LIB = 'liblvgl_wrapper.so';
+
+const imgCacheSetSize1 = nativeFunction(LVGL_LIB, 'lvgl_img_cache_set_size', FFI.types.sint, [FFI.types.uint16]);
+const imgCacheInvalidate1 = nativeFunction(LVGL_LIB, 'lvgl_img_cache_invalidate', FFI.types.sint, [FFI.types.pointer]);
+const overlayInit1 = nativeFunction(LVGL_LIB, 'lvgl_overlay_init', FFI.types.sint, []);
+const overlayDeinit1 = nativeFunction(LVGL_LIB, 'lvgl_overlay_deinit', FFI.types.void, []);
+const overlaySetMode1 = nativeFunction(LVGL_LIB, 'lvgl_overlay_set_mode', FFI.types.sint, [FFI.types.sint]);
+const overlaySetImage1 = nativeFunction(LVGL_LIB, 'lvgl_overlay_set_image', FFI.types.sint, [FFI.types.sint, FFI.types.buffer, FFI.types.uint32]);
+const overlaySetState1 = nativeFunction(LVGL_LIB, 'lvgl_overlay_set_state', FFI.types.sint, [FFI.types.sint]);
+const overlayLostCount1 = nativeFunction(LVGL_LIB, 'lvgl_overlay_lost_count', FFI.types.uint32, [], 0);
+const overlaySetLabel1 = nativeFunction(LVGL_LIB, 'lvgl_overlay_set_label', FFI.types.sint, [FFI.types.string]);
+const overlaySetFont1 = nativeFunction(LVGL_LIB, 'lvgl_overlay_set_font', FFI.types.sint, [FFI.types.string, FFI.types.sint]);
+const fontCacheInit1 = nativeFunction(LVGL_LIB, 'lvgl_font_cache_init', FFI.types.sint, [FFI.types.uint16, FFI.types.uint16, FFI.types.uint32]);
+const fontPrewarm1 = nativeFunction(LVGL_LIB, 'lvgl_font_prewarm', FFI.types.sint, [FFI.types.string, FFI.types.string]);
+const fontCount1 = nativeFunction(LVGL_LIB, 'lvgl_font_count', FFI.types.sint, [], 0);
+const vlistCreate1 = nativeFunction(LVGL_LIB, 'lvgl_vlist_create', FFI.types.sint, [FFI.types.sint, FFI.types.sint, FFI.types.sint, FFI.types.sint, FFI.types.sint, FFI.types.string, FFI.types.sint, FFI.types.sint]);
+const vlistDestroy1 = nativeFunction(LVGL_LIB, 'lvgl_vlist_destroy', FFI.types.void, [FFI.types.sint]);
+const vlistSetStyle1 = nativeFunction(LVGL_LIB, 'lvgl_vlist_set_style', FFI.types.sint, [FFI.types.sint, FFI.types.string, FFI.types.uint32, FFI.types.uint32, FFI.types.uint32, FFI.types.sint]);
+const vlistSetTotal1 = nativeFunction(LVGL_LIB, 'lvgl_vlist_set_total', FFI.types.sint, [FFI.types.sint, FFI.types.sint]);
+const vlistNextRequest1 = nativeFunction(LVGL_LIB, 'lvgl_vlist_next_request', FFI.types.sint, [FFI.types.sint]);
+const vlistSetPage1 = nativeFunction(LVGL_LIB, 'lvgl_vlist_set_page', FFI.types.sint, [FFI.types.sint, FFI.types.sint, FFI.types.string]);
+// 同一接口，text传NULL表示取数失败
+const vlistCancelPage1 = nativeFunction(LVGL_LIB, 'lvgl_vlist_set_page', FFI.types.sint, [FFI.types.sint, FFI.types.sint, FFI.types.pointer]);
+const vlistTakeClick1 = nativeFunction(LVGL_LIB, 'lvgl_vlist_take_click', FFI.types.sint, [FFI.types.sint]);
+const vlistSetVisible1 = nativeFunction(LVGL_LIB, 'lvgl_vlist_set_visible', FFI.types.sint, [FFI.types.sint, FFI.types.sint]);
+const vlistScrollTo1 = nativeFunction(LVGL_LIB, 'lvgl_vlist_scroll_to', FFI.types.sint, [FFI.types.sint, FFI.types.sint]);
+const vlistWidgetCount1 = nativeFunction(LVGL_LIB, 'lvgl_vlist_widget_count', FFI.types.sint, [FFI.types.sint], 0);
+const objCaptureBegin1 = nativeFunction(LVGL_LIB, 'lvgl_obj_capture_begin', FFI.types.sint, []);
+const objCaptureEnd1 = nativeFunction(LVGL_LIB, 'lvgl_obj_capture_end', FFI.types.sint, []);
+const animBindOverlay1 = nativeFunction(LVGL_LIB, 'lvgl_anim_bind_overlay', FFI.types.sint, [FFI.types.sint]);
+const animCreate1 = nativeFunction(LVGL_LIB, 'lvgl_anim_create', FFI.types.sint, []);
+const animAddTrack1 = nativeFunction(LVGL_LIB, 'lvgl_anim_add_track', FFI.types.sint, [FFI.types.sint, FFI.types.sint, FFI.types.sint, FFI.types.string, FFI.types.sint, FFI.types.sint, FFI.types.sint]);
+const animChain1 = nativeFunction(LVGL_LIB, 'lvgl_anim_chain', FFI.types.sint, [FFI.types.sint, FFI.types.sint]);
+const animStart1 = nativeFunction(LVGL_LIB, 'lvgl_anim_start', FFI.types.sint, [FFI.types.sint]);
+const animStop1 = nativeFunction(LVGL_LIB, 'lvgl_anim_stop', FFI.types.sint, [FFI.types.sint]);
+const animDestroy1 = nativeFunction(LVGL_LIB, 'lvgl_anim_destroy', FFI.types.void, [FFI.types.sint]);
+const animPollEvent1 = nativeFunction(LVGL_LIB, 'lvgl_anim_poll_event', FFI.types.sint, []);
+const animRunningCount1 = nativeFunction(LVGL_LIB, 'lvgl_anim_running_count', FFI.types.sint, [], 0);
+const frameWatch1 = nativeFunction(LVGL_LIB, 'lvgl_frame_watch', FFI.types.sint, []);
+const frameCount1 = nativeFunction(LVGL_LIB, 'lvgl_frame_count', FFI.types.sint, []);
+const profStart1 = nativeFunction(LVGL_LIB, 'lvgl_prof_start', FFI.types.sint, [FFI.types.sint, FFI.types.string]);
+const profStop1 = nativeFunction(LVGL_LIB, 'lvgl_prof_stop', FFI.types.void, []);
+const profReport1 = nativeFunction(LVGL_LIB, 'lvgl_prof_report', FFI.types.sint, [FFI.types.buffer, FFI.types.size]);
+const canvasCreate1 = nativeFunction(LVGL_LIB, 'lvgl_canvas_create', FFI.types.sint, [FFI.types.sint, FFI.types.sint, FFI.types.sint, FFI.types.sint, FFI.types.sint]);
+const canvasDestroy1 = nativeFunction(LVGL_LIB, 'lvgl_canvas_destroy', FFI.types.void, [FFI.types.sint]);
+const canvasFlush1 = nativeFunction(LVGL_LIB, 'lvgl_canvas_flush', FFI.types.sint, [FFI.types.sint, FFI.types.buffer, FFI.types.sint, FFI.types.buffer, FFI.types.sint]);
+const canvasSetVisible1 = nativeFunction(LVGL_LIB, 'lvgl_canvas_set_visible', FFI.types.sint, [FFI.types.sint, FFI.types.sint]);
+const canvasSetPos1 = nativeFunction(LVGL_LIB, 'lvgl_canvas_set_pos', FFI.types.sint, [FFI.types.sint, FFI.types.sint, FFI.types.sint]);
+const pageCreate1 = nativeFunction(LVGL_LIB, 'lvgl_page_create', FFI.types.sint, []);
+const pageDestroy1 = nativeFunction(LVGL_LIB, 'lvgl_page_destroy', FFI.types.void, [FFI.types.sint]);
+const pageAdopt1 = nativeFunction(LVGL_LIB, 'lvgl_page_adopt', FFI.types.sint, [FFI.types.sint, FFI.types.sint, FFI.types.sint]);
+const pageShare1 = nativeFunction(LVGL_LIB, 'lvgl_page_share', FFI.types.sint, [FFI.types.sint]);
+const pageLoad1 = nativeFunction(LVGL_LIB, 'lvgl_page_load', FFI.types.sint, [FFI.types.sint, FFI.types.sint, FFI.types.sint]);
+const pageCurrent1 = nativeFunction(LVGL_LIB, 'lvgl_page_current', FFI.types.sint, []);
+const pageWidgetCount1 = nativeFunction(LVGL_LIB, 'lvgl_page_widget_count', FFI.types.sint, [FFI.types.sint], 0);
+
+// 叠加层模式
+const OVERLAY_MODE = {
+    OFF: 0,
+    TRACK: 1,
+};
+
+// 跟踪框状态，每个状态对应一张跟踪框图片
+const OVERLAY_STATE = {
+    IDLE: 0,
+    SUCCESS: 1,
+    FAIL: 2,
+};
+
+/**
+ * 设置LVGL图片解码缓存槽位数
+ * @param {number} size 槽位数，不小于同屏PNG数量时图片只解码一次
+ * @returns {number} 0成功，-1引擎不支持
+ */
+function imgCacheSetSize(size) {
+    return imgCacheSetSize1.call(size);
+}
+
+/**
+ * 清空LVGL图片解码缓存
+ * @returns {number} 0成功，-1引擎不支持
+ */
+function imgCacheInvalidateAll() {
+    return imgCacheInvalidate1.call(null);
+}
+
+/**
+ * 初始化人脸跟踪框叠加层，需在人脸模块初始化之后调用
+ * 跟踪框由原生定时器直接读取检测结果绘制，JS只负责设置图片、切换状态和姓名
+ * @returns {number} 0成功，-1引擎或人脸模块不支持
+ */
+function overlayInit() {
+    return overlayInit1.call();
+}
+
+function overlayDeinit() {
+    overlayDeinit1.call();
+}
+
+/**
+ * 设置叠加层模式
+ * @param {number} mode OVERLAY_MODE
+ */
+function overlaySetMode(mode) {
+    return overlaySetMode1.call(mode);
+}
+
+/**
+ * 设置某个状态的跟踪框图片
+ * @param {number} state OVERLAY_STATE
+ * @param {ArrayBuffer} buffer PNG文件内容，原生侧复制一份
+ */
+function overlaySetImage(state, buffer) {
+    return overlaySetImage1.call(state, new Uint8Array(buffer), buffer.byteLength);
+}
+
+/**
+ * 切换跟踪框状态，人脸离开后原生侧自动复位为 OVERLAY_STATE.IDLE 并隐藏姓名
+ * @param {number} state OVERLAY_STATE
+ */
+function overlaySetState(state) {
+    return overlaySetState1.call(state);
+}
+
+/**
+ * 跟踪框因人脸离开而隐藏的累计次数，变化时表示人脸已离开
+ * @returns {number}
+ */
+function overlayLostCount() {
+    return overlayLostCount1.call();
+}
+
+/**
+ * 设置姓名标签，空字符串隐藏
+ * @param {string} text
+ */
+function overlaySetLabel(text) {
+    return overlaySetLabel1.call(text || '');
+}
+
+/**
+ * 设置姓名标签字体
+ * @param {string} fontPath ttf字体路径
+ * @param {number} size 字号
+ */
+function overlaySetFont(fontPath, size) {
+    return overlaySetFont1.call(fontPath, size);
+}
+
+/**
+ * 设置FreeType缓存大小，需在界面创建任何字体之前调用
+ * @param {Object} options
+ * @param {number} options.maxFaces 同时打开的字体文件数
+ * @param {number} options.maxSizes 同时缓存的字号数
+ * @param {number} options.maxBytes 字形位图缓存总字节数，超出后淘汰最久未用的字形
+ * @returns {number} 0成功，-1引擎不支持或已有字体
+ */
+function fontCacheInit({ maxFaces = 2, maxSizes = 8, maxBytes = 512 * 1024 } = {}) {
+    return fontCacheInit1.call(maxFaces, maxSizes, maxBytes);
+}
+
+/**
+ * 预先渲染字形，首次显示这些字时不再现场光栅化
+ * @param {string} spec 字体，与样式中相同的 "路径#字号#风格" 格式
+ * @param {string} text 需要预热的字符
+ * @returns {number} 渲染的字形数，-1不支持或字体加载失败
+ */
+function fontPrewarm(spec, text) {
+    return fontPrewarm1.call(spec, text || '');
+}
+
+// 字体管理器中的字体数
+function fontCount() {
+    return fontCount1.call();
+}
+
+// 虚拟列表轮询间隔：滚动中（有缺页请求或点击）与空闲时
+const VLIST_POLL_ACTIVE_MS = 20;
+const VLIST_POLL_IDLE_MS = 100;
+// 空闲多少次轮询后放慢，滚动惯性期间请求可能间断
+const VLIST_IDLE_POLLS = 10;
+
+// 单元格文本中的分隔符替换为空格，'\t'、'\n'是原生侧的列、行分隔符
+function cellText(value) {
+    return value === undefined || value === null ? '' : String(value).replace(/[\t\n\r]/g, ' ');
+}
+
+/**
+ * 虚拟列表：行对象由原生侧循环复用，数量只与可见高度有关，滚动时不经过JS；
+ * 缺页时原生侧登记请求，这里轮询取出后调用 fetchPage 取数再送回。
+ * 只在列表显示期间轮询：有缺页或点击时每20ms一次，空闲时放慢到100ms；隐藏或销毁后停止
+ *
+ * 用法：
+ *   const list = new VirtualList({
+ *       x: 0, y: 100, width: 480, height: 600, rowHeight: 50, columns: [160, 200, 120],
+ *       fetchPage: (page, pageSize) => {
+ *           const r = db.getAccessRecordsPaginated({ page: page + 1, pageSize });
+ *           return { rows: r.data, total: r.pagination.total };
+ *       },
+ *       renderRow: (record) => [record.userId, formatTime(record.accessTime), record.result ? '通过' : '拒绝'],
+ *       onSelect: (index, record) => { ... }
+ *   });
+ *   list.refresh();
+ */
+class VirtualList {
+    /**
+     * @param {Object} options
+     * @param {number} options.x 位置（当前屏幕坐标）
+     * @param {number} options.y
+     * @param {number} options.width 宽度
+     * @param {number} options.height 高度
+     * @param {number} options.rowHeight 行高
+     * @param {number[]} options.columns 各列宽度，默认整行一列
+     * @param {number} options.pageSize 每页记录数，默认20
+     * @param {number} options.overscan 可见区上下各预留的行数，默认2
+     * @param {Object} options.style { font: "路径#字号#风格", color, bgEven, bgOdd, bgOpa }
+     * @param {Function} options.fetchPage (page, pageSize) => { rows, total }，page从0开始，可返回Promise
+     * @param {Function} options.renderRow (record, index) => 各列文本数组，默认按字段顺序取值
+     * @param {Function} options.onSelect (index, record) => void，点击行时调用
+     */
+    constructor({ x = 0, y = 0, width, height, rowHeight = 48, columns = [], pageSize = 20, overscan = 2, style, fetchPage, renderRow, onSelect } = {}) {
+        this.pageSize = pageSize;
+        this.fetchPage = fetchPage;
+        this.renderRow = renderRow || ((record) => Object.values(record));
+        this.onSelect = onSelect;
+        // 与原生侧页缓存对应，点击时取回记录对象；代数用于丢弃刷新前发出的异步取数结果
+        this.pages = new Map();
+        this.generation = 0;
+        this.timer = null;
+        this.visible = true;
+        this.idlePolls = 0;
+        this.id = vlistCreate1.call(x, y, width, height, rowHeight, columns.join(','), pageSize, overscan);
+        if (this.id < 0) {
+            return;
+        }
+        if (style) {
+            this.setStyle(style);
+        }
+        this.schedulePoll(VLIST_POLL_ACTIVE_MS);
+    }
+
+    schedulePoll(delay) {
+        if (this.timer || this.id < 0 || !this.visible) {
+            return;
+        }
+        this.timer = setTimeout(() => {
+            this.timer = null;
+            const active = this.poll();
+            this.idlePolls = active ? 0 : this.idlePolls + 1;
+            this.schedulePoll(this.idlePolls < VLIST_IDLE_POLLS ? VLIST_POLL_ACTIVE_MS : VLIST_POLL_IDLE_MS);
+        }, delay);
+    }
+
+    stopPoll() {
+        if (this.timer) {
+            clearTimeout(this.timer);
+            this.timer = null;
+        }
+    }
+
+    /**
+     * @param {Object} style
+     * @param {string} style.font 字体 "路径#字号#风格"
+     * @param {number} style.color 文字颜色 0xRRGGBB
+     * @param {number} style.bgEven 偶数行背景色
+     * @param {number} style.bgOdd 奇数行背景色
+     * @param {number} style.bgOpa 背景不透明度 0-255
+     */
+    setStyle({ font = '', color = 0x000000, bgEven = 0xFFFFFF, bgOdd = 0xF2F2F2, bgOpa = 255 } = {}) {
+        return vlistSetStyle1.call(this.id, font, color, bgEven, bgOdd, bgOpa);
+    }
+
+    /**
+     * 重新取第一页得到总数，已缓存的数据全部作废（数据变化后调用）
+     */
+    async refresh() {
+        const generation = ++this.generation;
+        this.pages.clear();
+        const result = await this.fetchPage(0, this.pageSize);
+        if (generation !== this.generation || this.id < 0) {
+            return;
+        }
+        vlistSetTotal1.call(this.id, result.total);
+        this.supply(0, result.rows);
+        // 总数变化后原生侧会请求可见区的其他页
+        this.idlePolls = 0;
+    }
+
+    supply(page, rows) {
+        this.pages.set(page, rows);
+        // 原生侧最多缓存8页，这里多保留几页即可
+        if (this.pages.size > 16) {
+            this.pages.delete(this.pages.keys().next().value);
+        }
+        const text = rows.map((record, i) => this.renderRow(record, page * this.pageSize + i).map(cellText).join('\t')).join('\n');
+        vlistSetPage1.call(this.id, page, text);
+    }
+
+    async load(page) {
+        const generation = this.generation;
+        try {
+            const result = await this.fetchPage(page, this.pageSize);
+            if (generation === this.generation && this.id >= 0) {
+                this.supply(page, result.rows);
+            }
+        } catch (e) {
+            console.log('虚拟列表取数失败', page, e);
+            if (generation === this.generation && this.id >= 0) {
+                vlistCancelPage1.call(this.id, page, null);
+            }
+        }
+    }
+
+    // 取出缺页请求和点击，有任何一项返回true
+    poll() {
+        let active = false;
+        let page;
+        while ((page = vlistNextRequest1.call(this.id)) >= 0) {
+            active = true;
+            this.load(page);
+        }
+        const index = vlistTakeClick1.call(this.id);
+        if (index >= 0) {
+            active = true;
+            if (this.onSelect) {
+                const rows = this.pages.get(Math.floor(index / this.pageSize));
+                this.onSelect(index, rows ? rows[index % this.pageSize] : undefined);
+            }
+        }
+        return active;
+    }
+
+    setVisible(visible) {
+        this.visible = !!visible;
+        if (this.visible) {
+            this.idlePolls = 0;
+            this.schedulePoll(VLIST_POLL_ACTIVE_MS);
+        } else {
+            this.stopPoll();
+        }
+        return vlistSetVisible1.call(this.id, visible ? 1 : 0);
+    }
+
+    scrollTo(index) {
+        this.idlePolls = 0;
+        return vlistScrollTo1.call(this.id, index);
+    }
+
+    // 列表占用的LVGL对象数，与记录总数无关
+    widgetCount() {
+        return vlistWidgetCount1.call(this.id);
+    }
+
+    destroy() {
+        this.stopPoll();
+        if (this.id >= 0) {
+            vlistDestroy1.call(this.id);
+            this.id = -1;
+        }
+        this.generation++;
+        this.pages.clear();
+    }
+}
+
+// 动画属性，与 lvgl_wrapper.h 中 anim_prop 一致
+const ANIM_PROP = {
+    X: 0,
+    Y: 1,
+    WIDTH: 2,
+    HEIGHT: 3,
+    TRANSLATE_X: 4,
+    TRANSLATE_Y: 5,
+    OPA: 6,     // 0-255
+    ZOOM: 7,    // 256为原始大小
+    ANGLE: 8,   // 0.1度
+};
+
+// 原生对象动画目标
+const ANIM_TARGET = {
+    OVERLAY_BOX: 'overlay-box',     // 人脸跟踪框
+    OVERLAY_LABEL: 'overlay-label', // 跟踪框上的姓名
+};
+
+const ANIM_EVENT = {
+    START: 0,
+    END: 1,
+    STOPPED: 2,
+};
+
+/**
+ * 包装组件类，构造时记下组件原生对象的句柄（comp.nativeHandle），供动画、页面使用
+ * 驱动库不支持时句柄为-1
+ * @param {Function} NativeClass lvgljs 组件类，如 NativeComponents.View
+ * @returns {Function} 子类，用法与原类相同
+ */
+function withHandle(NativeClass) {
+    return class extends NativeClass {
+        constructor(...args) {
+            const capturing = objCaptureBegin1.call() === 0;
+            let handle = -1;
+            try {
+                super(...args);
+            } finally {
+                if (capturing) {
+                    handle = objCaptureEnd1.call();
+                }
+            }
+            this.nativeHandle = handle;
+        }
+    };
+}
+
+/**
+ * 取动画目标的原生句柄
+ * @param {Object|string} target 组件（需由 withHandle 包装的类创建），或 ANIM_TARGET 中的原生对象
+ * @returns {number} 句柄，-1表示不支持
+ */
+function animTarget(target) {
+    if (target === ANIM_TARGET.OVERLAY_BOX || target === ANIM_TARGET.OVERLAY_LABEL) {
+        return animBindOverlay1.call(target === ANIM_TARGET.OVERLAY_BOX ? 0 : 1);
+    }
+    return target.nativeHandle ?? -1;
+}
+
+// 播放中的动画，只在有动画时轮询开始、结束事件
+const animations = new Map();
+let animPollTimer = null;
+
+function pollAnimEvents() {
+    let event;
+    while ((event = animPollEvent1.call()) >= 0) {
+        const animation = animations.get(event >> 2);
+        const type = event & 3;
+        const callback = animation && (type === ANIM_EVENT.START ? animation.onStart : animation.onEnd);
+        if (callback) {
+            try {
+                callback(type === ANIM_EVENT.STOPPED);
+            } catch (e) {
+                console.log('动画回调异常', e);
+            }
+        }
+    }
+    if (animRunningCount1.call() === 0) {
+        clearInterval(animPollTimer);
+        animPollTimer = null;
+    }
+}
+
+function watchAnimEvents() {
+    if (!animPollTimer) {
+        animPollTimer = setInterval(pollAnimEvents, 20);
+    }
+}
+
+function keyframeText(keyframes) {
+    return keyframes.map(({ time, value, easing = 'linear' }) => `${Math.round(time)}:${Math.round(value)}:${easing}`).join(';');
+}
+
+/**
+ * 原生动画：关键帧插值、缓动、重复、回放全部在LVGL定时器中完成，播放过程中不回调JS
+ *
+ * 用法：
+ *   const fadeIn = new NativeAnimation({
+ *       tracks: [
+ *           { target: successMsg, prop: ANIM_PROP.OPA, keyframes: [{ time: 0, value: 0, easing: 'ease-out' }, { time: 200, value: 255 }] },
+ *           { target: successMsg, prop: ANIM_PROP.TRANSLATE_Y, keyframes: [{ time: 0, value: 20, easing: 'ease-out' }, { time: 200, value: 0 }] },
+ *       ],
+ *       onEnd: (stopped) => { ... }
+ *   });
+ *   fadeIn.then(fadeOut);
+ *   fadeIn.start();
+ */
+class NativeAnimation {
+    /**
+     * @param {Object} options
+     * @param {Object[]} options.tracks 并行播放的轨道
+     *   { target, prop, keyframes: [{ time, value, easing }], delay, repeat, playback }
+     *   target 为组件或 ANIM_TARGET；easing 为从该帧到下一帧的曲线（EAnimateEasingFunc 中的名称）；
+     *   repeat 为重复次数，Infinity 无限；playback 为 true 时每轮正放后倒放
+     * @param {Function} options.onStart 开始时调用
+     * @param {Function} options.onEnd (stopped) => void，播放完或被停止时调用
+     */
+    constructor({ tracks = [], onStart, onEnd } = {}) {
+        this.onStart = onStart;
+        this.onEnd = onEnd;
+        this.id = animCreate1.call();
+        if (this.id < 0) {
+            return;
+        }
+        for (const track of tracks) {
+            const target = animTarget(track.target);
+            const repeat = track.repeat === Infinity ? -1 : (track.repeat || 0);
+            if (target < 0 || animAddTrack1.call(this.id, target, track.prop, keyframeText(track.keyframes), track.delay || 0, repeat, track.playback ? 1 : 0) !== 0) {
+                console.log('动画轨道添加失败', track.prop);
+            }
+        }
+        animations.set(this.id, this);
+    }
+
+    /**
+     * 本动画结束后自动播放 next（原生侧串联，中间不经过JS）
+     * @param {NativeAnimation} next
+     * @returns {NativeAnimation} next，可继续串联
+     */
+    then(next) {
+        animChain1.call(this.id, next ? next.id : -1);
+        return next;
+    }
+
+    start() {
+        if (this.id < 0) {
+            return -1;
+        }
+        const ret = animStart1.call(this.id);
+        watchAnimEvents();
+        return ret;
+    }
+
+    stop() {
+        return animStop1.call(this.id);
+    }
+
+    destroy() {
+        if (this.id >= 0) {
+            animDestroy1.call(this.id);
+            animations.delete(this.id);
+            this.id = -1;
+        }
+    }
+}
+
+/**
+ * 开始统计完成送显的帧数，界面创建完成后、开始刷新分析之前调用
+ * @returns {number} 0成功，-1不支持
+ */
+function frameWatch() {
+    return frameWatch1.call();
+}
+
+/**
+ * 开始统计后完成送显的帧数
+ * @returns {number} 帧数，未开始统计或不支持时返回-1
+ */
+function frameCount() {
+    return frameCount1.call();
+}
+
+// 刷新分析选项，与 lvgl_wrapper.h 中 LVGL_PROF_* 一致
+const PROF_FLAG = {
+    OBJECTS: 0x01, // 统计各对象重绘次数
+    FLASH: 0x02,   // 重绘区域叠加红色
+};
+
+/**
+ * 开始刷新分析：统计每帧重绘区域、渲染和送显耗时，空闲时仍在刷新的对象会排在报告前面
+ * @param {Object} options
+ * @param {boolean} options.objects 统计各对象重绘次数（每次送显遍历对象树）
+ * @param {boolean} options.flash 屏幕上用红色标出重绘区域
+ * @param {string} options.trace 每帧一行的记录文件路径，空表示不记录
+ * @returns {number} 0成功，-1不支持或已在分析中
+ */
+function profStart({ objects = true, flash = false, trace = '' } = {}) {
+    return profStart1.call((objects ? PROF_FLAG.OBJECTS : 0) | (flash ? PROF_FLAG.FLASH : 0), trace);
+}
+
+// 停止分析，恢复显示驱动回调
+function profStop() {
+    profStop1.call();
+}
+
+/**
+ * 刷新分析报告：帧数、平均/最大渲染和送显耗时、平均重绘像素，以及重绘次数最多的对象
+ * @returns {string}
+ */
+function profReport(size = 4096) {
+    const buf = new Uint8Array(size);
+    const len = profReport1.call(buf, size);
+    return len > 0 ? new TextDecoder().decode(buf.subarray(0, len)) : '';
+}
+
+// 画布命令，与 lvgl_wrapper.h 中 canvas_cmd 一致
+const CANVAS_CMD = {
+    CLEAR: 1,
+    RECT: 2,
+    LINE: 3,
+    POLYLINE: 4,
+    TEXT: 5,
+    FONT: 6,
+    IMAGE: 7,
+    ARC: 8,
+};
+
+const CANVAS_ALIGN = { left: 0, center: 1, right: 2 };
+
+/**
+ * 画布：绘制调用只在 JS 中记录到 Int32Array 命令数组，flush() 一次交给原生侧执行，
+ * 原生侧画到后台缓冲区后交换显示，一帧只跨一次 FFI、只刷新一次
+ *
+ * 用法（通行量折线图）：
+ *   const chart = new NativeCanvas({ x: 20, y: 700, width: 560, height: 200 });
+ *   chart.clear(0xFFFFFF)
+ *       .polyline(points, { color: 0x1E90FF, width: 3 })
+ *       .text(0, 0, `今日通行 ${total}`, { font: FONT_FILE + '#20', color: 0x333333 });
+ *   chart.flush();
+ */
+class NativeCanvas {
+    /**
+     * @param {Object} options
+     * @param {number} options.x 位置（当前屏幕坐标）
+     * @param {number} options.y
+     * @param {number} options.width 宽度
+     * @param {number} options.height 高度
+     * @param {boolean} options.alpha 背景可透明（叠加在其他控件上时使用，绘制较慢）
+     */
+    constructor({ x = 0, y = 0, width, height, alpha = false } = {}) {
+        this.cmds = new Int32Array(256);
+        this.len = 0;
+        this.strings = [];
+        this.stringOffsets = new Map();
+        this.stringBytes = 0;
+        this.font = '';
+        this.id = canvasCreate1.call(x, y, width, height, alpha ? 1 : 0);
+    }
+
+    push(...words) {
+        if (this.len + words.length > this.cmds.length) {
+            const cmds = new Int32Array(Math.max(this.cmds.length * 2, this.len + words.length));
+            cmds.set(this.cmds.subarray(0, this.len));
+            this.cmds = cmds;
+        }
+        for (const word of words) {
+            this.cmds[this.len++] = word;
+        }
+        return this;
+    }
+
+    // 字符串放入本帧的字符串表，返回字节偏移，同一帧内相同字符串只存一份
+    string(text) {
+        let offset = this.stringOffsets.get(text);
+        if (offset === undefined) {
+            const bytes = new TextEncoder().encode(text);
+            offset = this.stringBytes;
+            this.strings.push(bytes);
+            this.stringBytes += bytes.length + 1;
+            this.stringOffsets.set(text, offset);
+        }
+        return offset;
+    }
+
+    /**
+     * 清屏；一帧不以清屏开头时在上一帧的基础上继续画
+     * @param {number} color 0xRRGGBB
+     * @param {number} opa 不透明度 0-255，仅 alpha 画布有效
+     */
+    clear(color = 0x000000, opa = 255) {
+        return this.push(CANVAS_CMD.CLEAR, color, opa);
+    }
+
+    /**
+     * @param {Object} style { fill, fillOpa, radius, border, borderWidth }
+     */
+    rect(x, y, width, height, { fill = 0x000000, fillOpa = 255, radius = 0, border = 0x000000, borderWidth = 0 } = {}) {
+        return this.push(CANVAS_CMD.RECT, x, y, width, height, fill, fillOpa, radius, border, borderWidth);
+    }
+
+    /**
+     * @param {Object} style { color, width, opa }
+     */
+    line(x1, y1, x2, y2, { color = 0x000000, width = 1, opa = 255 } = {}) {
+        return this.push(CANVAS_CMD.LINE, x1, y1, x2, y2, color, width, opa);
+    }
+
+    /**
+     * 折线，适合曲线图
+     * @param {number[]} points 坐标 [x1, y1, x2, y2, ...]
+     * @param {Object} style { color, width, opa }
+     */
+    polyline(points, { color = 0x000000, width = 1, opa = 255 } = {}) {
+        const count = points.length >> 1;
+        this.push(CANVAS_CMD.POLYLINE, color, width, opa, count);
+        for (let i = 0; i < count * 2; i++) {
+            this.push(points[i]);
+        }
+        return this;
+    }
+
+    /**
+     * @param {string} text
+     * @param {Object} style
+     * @param {string} style.font 字体 "路径#字号#风格"，不指定时沿用本帧上一次的字体（默认为主题字体）
+     * @param {number} style.color 0xRRGGBB
+     * @param {string} style.align left、center、right
+     * @param {number} style.maxWidth 文本区宽度，0表示到画布右边界
+     */
+    text(x, y, text, { font, color = 0x000000, align = 'left', maxWidth = 0 } = {}) {
+        if (font && font !== this.font) {
+            this.font = font;
+            this.push(CANVAS_CMD.FONT, this.string(font));
+        }
+        return this.push(CANVAS_CMD.TEXT, x, y, maxWidth, color, CANVAS_ALIGN[align] || 0, this.string(String(text)));
+    }
+
+    /**
+     * 图片（LVGL 图片源路径，经图片缓存解码）
+     * @param {Object} options { zoom: 256为原始大小, opa }
+     */
+    image(x, y, src, { zoom = 256, opa = 255 } = {}) {
+        return this.push(CANVAS_CMD.IMAGE, x, y, zoom, opa, this.string(src));
+    }
+
+    /**
+     * 圆弧，角度单位为度，0为右侧，顺时针
+     * @param {Object} style { color, width, opa }
+     */
+    arc(cx, cy, radius, startAngle, endAngle, { color = 0x000000, width = 1, opa = 255 } = {}) {
+        return this.push(CANVAS_CMD.ARC, cx, cy, radius, startAngle, endAngle, color, width, opa);
+    }
+
+    /**
+     * 执行并显示已记录的命令，之后开始记录下一帧
+     * @returns {number} 执行的命令数，-1表示画布不可用或命令格式错误（屏幕保持上一帧）
+     */
+    flush() {
+        let ret = -1;
+        if (this.id >= 0) {
+            const strings = new Uint8Array(Math.max(this.stringBytes, 1));
+            let offset = 0;
+            for (const bytes of this.strings) {
+                strings.set(bytes, offset);
+                offset += bytes.length + 1;
+            }
+            ret = canvasFlush1.call(this.id, new Uint8Array(this.cmds.buffer, 0, this.len * 4), this.len, strings, this.stringBytes);
+        }
+        this.len = 0;
+        this.strings = [];
+        this.stringOffsets.clear();
+        this.stringBytes = 0;
+        this.font = '';
+        return ret;
+    }
+
+    setVisible(visible) {
+        return canvasSetVisible1.call(this.id, visible ? 1 : 0);
+    }
+
+    setPos(x, y) {
+        return canvasSetPos1.call(this.id, x, y);
+    }
+
+    destroy() {
+        if (this.id >= 0) {
+            canvasDestroy1.call(this.id);
+            this.id = -1;
+        }
+        this.len = 0;
+    }
+}
+
+// 页面切换动画，与 lv_scr_load_anim_t 一致
+const PAGE_ANIM = {
+    NONE: 0,
+    OVER_LEFT: 1,
+    OVER_RIGHT: 2,
+    OVER_TOP: 3,
+    OVER_BOTTOM: 4,
+    MOVE_LEFT: 5,
+    MOVE_RIGHT: 6,
+    MOVE_TOP: 7,
+    MOVE_BOTTOM: 8,
+    FADE_IN: 9,
+    FADE_OUT: 10,
+};
+
+// 已建好的页面，按最近显示时间淘汰
+const builtPages = new Set();
+let pageBudget = 0;
+let pageTick = 0;
+
+// 驱动库不支持独立屏幕时退回为同一屏幕上显示、隐藏页面中的控件，id 只在JS中使用
+const PAGE_STYLE_KEYS = ['display'];
+const PAGE_HIDE_STYLE = { display: 'none' };
+const PAGE_SHOW_STYLE = { display: 'block' };
+let fallbackPageId = 0;
+let fallbackCurrent = null;
+
+function pageNative() {
+    return pageCreate1.available();
+}
+
+function pageCurrentId() {
+    if (pageNative()) {
+        return pageCurrent1.call();
+    }
+    return fallbackCurrent ? fallbackCurrent.id : 0;
+}
+
+function setPageCompsVisible(page, visible) {
+    for (const comp of page.comps) {
+        comp.nativeSetStyle(visible ? PAGE_SHOW_STYLE : PAGE_HIDE_STYLE, PAGE_STYLE_KEYS, 1, 0, true);
+    }
+}
+
+/**
+ * 设置页面内存预算：未显示的可释放页面（提供了 destroy）对象总数超过预算时，释放最久未显示的页面，
+ * 再次显示时重新 build
+ * @param {number} maxWidgets 对象数，0表示不限制
+ */
+function pageSetBudget(maxWidgets) {
+    pageBudget = maxWidgets;
+    trimPages();
+}
+
+function trimPages() {
+    if (pageBudget <= 0) {
+        return;
+    }
+    const current = pageCurrentId();
+    const candidates = [...builtPages].filter((page) => page.destroyFn && page.id !== current).sort((a, b) => a.shownAt - b.shownAt);
+    let total = candidates.reduce((sum, page) => sum + pageWidgetCount1.call(page.id), 0);
+    for (const page of candidates) {
+        if (total <= pageBudget) {
+            break;
+        }
+        total -= pageWidgetCount1.call(page.id);
+        page.release();
+    }
+}
+
+/**
+ * 页面：每个页面是一个独立的LVGL屏幕，build 在 preload 或首次显示时执行，之后常驻内存，
+ * 切换只是一次屏幕加载；未显示页面上的修改到显示时才布局。
+ * 没有加到任何页面的控件属于初始页面（Page.home）；各页面都要显示的控件（如顶栏、时间）用 Page.share
+ * 设为共享，切换时跟随到新页面的最底层，被页面自身的遮罩、图片覆盖
+ * 驱动库不支持时退回为在当前屏幕上显示、隐藏各页面的控件，初始页面的控件始终显示
+ *
+ * 用法：
+ *   const resultPage = new Page({
+ *       build: (page) => {
+ *           const msg = new Text({ uid: "successMsg" });
+ *           page.add(msg);
+ *       },
+ *   });
+ *   resultPage.preload();
+ *   resultPage.show();
+ *   setTimeout(() => Page.home.show({ anim: PAGE_ANIM.FADE_IN, time: 200 }), 2000);
+ */
+class Page {
+    /**
+     * @param {Object} options
+     * @param {Function} options.build (page) => void，创建控件并用 page.add 加入
+     * @param {Function} options.destroy 页面被预算淘汰时调用，之后页面中的控件全部删除，不能再使用；
+     *   不提供时页面常驻
+     */
+    constructor({ build, destroy } = {}) {
+        this.buildFn = build;
+        this.destroyFn = destroy;
+        this.id = -1;
+        this.shownAt = 0;
+        // 退回方式下页面中的控件
+        this.comps = [];
+    }
+
+    /**
+     * 把控件（控件需已创建在当前屏幕上）移到本页面
+     * @param {Object} comp 组件
+     * @param {Object} options
+     * @param {boolean} options.background 放在页面其他控件之下
+     */
+    add(comp, { background = false } = {}) {
+        if (!pageNative()) {
+            this.comps.push(comp);
+            if (background) {
+                comp.moveToBackground();
+            }
+            comp.nativeSetStyle(PAGE_HIDE_STYLE, PAGE_STYLE_KEYS, 1, 0, true);
+            return comp;
+        }
+        const target = animTarget(comp);
+        if (target < 0 || pageAdopt1.call(this.id, target, background ? 1 : 0) !== 0) {
+            console.log('控件加入页面失败', comp.uid);
+        }
+        return comp;
+    }
+
+    // 提前建好页面，不显示
+    preload() {
+        if (this.id >= 0) {
+            return 0;
+        }
+        this.id = pageNative() ? pageCreate1.call() : ++fallbackPageId;
+        if (this.id < 0) {
+            return -1;
+        }
+        builtPages.add(this);
+        if (this.buildFn) {
+            this.buildFn(this);
+        }
+        trimPages();
+        return 0;
+    }
+
+    /**
+     * 切换到本页面
+     * @param {Object} options
+     * @param {number} options.anim PAGE_ANIM
+     * @param {number} options.time 动画时长ms
+     */
+    show({ anim = PAGE_ANIM.NONE, time = 0 } = {}) {
+        if (this.preload() !== 0) {
+            return -1;
+        }
+        this.shownAt = ++pageTick;
+        if (!pageNative()) {
+            if (fallbackCurrent !== this) {
+                if (fallbackCurrent) {
+                    setPageCompsVisible(fallbackCurrent, false);
+                }
+                setPageCompsVisible(this, true);
+                fallbackCurrent = this;
+            }
+            return 0;
+        }
+        return pageLoad1.call(this.id, anim, time);
+    }
+
+    isCurrent() {
+        return this.id >= 0 && pageCurrentId() === this.id;
+    }
+
+    // 页面自身的对象数（不含共享控件）
+    widgetCount() {
+        return this.id >= 0 ? pageWidgetCount1.call(this.id) : 0;
+    }
+
+    release() {
+        if (this.id <= 0 || this.isCurrent()) {
+            return;
+        }
+        if (this.destroyFn) {
+            this.destroyFn(this);
+        }
+        pageDestroy1.call(this.id);
+        builtPages.delete(this);
+        this.id = -1;
+        this.comps = [];
+    }
+
+    /**
+     * 把控件设为各页面共享的控件：切换页面时跟随显示，位于新页面自身控件之下，回到初始页面时放回原层次
+     * 退回方式下控件本来就在唯一的屏幕上，不需要处理
+     * @param {Object} comp 组件
+     */
+    static share(comp) {
+        if (!pageNative()) {
+            return comp;
+        }
+        const target = animTarget(comp);
+        if (target < 0 || pageShare1.call(target) !== 0) {
+            console.log('控件设为共享失败', comp.uid);
+        }
+        return comp;
+    }
+
+    // 当前显示的页面，不是通过 Page 创建的返回 undefined
+    static current() {
+        const id = pageCurrentId();
+        return id === 0 ? Page.home : [...builtPages].find((page) => page.id === id);
+    }
+}
+
+// 初始屏幕
+Page.home = new Page();
+Page.home.id = 0;
+
+export { imgCacheSetSize, imgCacheInvalidateAll, OVERLAY_MODE, OVERLAY_STATE, overlayInit, overlayDeinit, overlaySetMode, overlaySetImage, overlaySetState, overlayLostCount, overlaySetLabel, overlaySetFont, fontCacheInit, fontPrewarm, fontCount, VirtualList, ANIM_PROP, ANIM_TARGET, withHandle, animTarget, NativeAnimation, frameWatch, frameCount, profStart, profStop, profReport, NativeCanvas, PAGE_ANIM, Page, pageSetBudget };
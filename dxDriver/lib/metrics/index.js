@@ -0,0 +1,90 @@
+import FFI from 'tjs:ffi';
+
+import { nativeFunction } from '../native/index.js';
+
+// 驱动库不存在（旧固件）时注册返回-1，更新被忽略，读取为0
+const METRICS_LIB = 'libmetrics_wrapper.so';
+
+const metrics_register = nativeFunction(METRICS_LIB, 'metrics_register', FFI.types.sint, [FFI.types.string, FFI.types.sint, FFI.types.string]);
+const metrics_add = nativeFunction(METRICS_LIB, 'metrics_add', FFI.types.void, [FFI.types.sint, FFI.types.sint64]);
+const metrics_set = nativeFunction(METRICS_LIB, 'metrics_set', FFI.types.void, [FFI.types.sint, FFI.types.sint64]);
+const metrics_get = nativeFunction(METRICS_LIB, 'metrics_get', FFI.types.sint64, [FFI.types.sint], 0);
+const metrics_render = nativeFunction(METRICS_LIB, 'metrics_render', FFI.types.sint, [FFI.types.buffer, FFI.types.size], 0);
+
+// 指标类型
+const METRIC_TYPE = {
+    COUNTER: 0, // 只增不减
+    GAUGE: 1    // 当前值
+};
+
+// 同名指标返回同一编号，重复注册无副作用
+const metricIds = new Map();
+
+/**
+ * 注册指标，数据在共享内存中，webserver 的 /metrics 接口直接读取
+ * @param {string} name 指标名，可带标签，如 db_query_total{table="user"}
+ * @param {number} type METRIC_TYPE
+ * @param {string} help 说明
+ * @returns {number} 指标编号，-1表示注册失败（此时更新操作被忽略）
+ */
+function metricsRegister(name, type, help = '') {
+    let id = metricIds.get(name);
+    if (id === undefined) {
+        id = metrics_register.call(name, type, help);
+        metricIds.set(name, id);
+    }
+    return id;
+}
+
+function metricsAdd(id, delta = 1) {
+    metrics_add.call(id, Math.round(delta));
+}
+
+function metricsSet(id, value) {
+    metrics_set.call(id, Math.round(value));
+}
+
+function metricsGet(id) {
+    return Number(metrics_get.call(id));
+}
+
+/**
+ * 以 Prometheus 文本格式输出全部指标（与 /metrics 接口内容相同）
+ * @param {number} size 缓冲区大小
+ * @returns {string}
+ */
+function metricsRender(size = 16 * 1024) {
+    const buf = new Uint8Array(size);
+    const len = metrics_render.call(buf, size);
+    return new TextDecoder().decode(buf.subarray(0, len));
+}
+
+let loopLagTimer = null;
+
+/**
+ * 采样 JS 事件循环延迟：定时器实际触发时间与预期之差，包含同步任务和 GC 停顿
+ * @param {number} intervalMs 采样间隔，0表示停止
+ */
+function metricsWatchEventLoop(intervalMs = 1000) {
+    if (loopLagTimer) {
+        clearInterval(loopLagTimer);
+        loopLagTimer = null;
+    }
+    if (intervalMs <= 0) {
+        return;
+    }
+    const lagId = metricsRegister('js_event_loop_lag_us', METRIC_TYPE.GAUGE, 'JS 事件循环最近一次采样的延迟（微秒）');
+    const lagMaxId = metricsRegister('js_event_loop_lag_max_us', METRIC_TYPE.GAUGE, 'JS 事件循环延迟最大值（微秒）');
+    let expected = performance.now() + intervalMs;
+    loopLagTimer = setInterval(() => {
+        const now = performance.now();
+        const lag = Math.max(0, (now - expected) * 1000);
+        expected = now + intervalMs;
+        metricsSet(lagId, lag);
+        if (lag > metricsGet(lagMaxId)) {
+            metricsSet(lagMaxId, lag);
+        }
+    }, intervalMs);
+}
+
+export { METRIC_TYPE, metricsRegister, metricsAdd, metricsSet, metricsGet, metricsRender, metricsWatchEventLoop };
@@ -0,0 +1,81 @@
+import FFI from 'tjs:ffi';
+
+// 只依赖 tjs:ffi，启动引导（boot.js）也会间接引用本文件
+const DRIVER_PATH = '/os/driver/';
+
+// 库名 -> FFI.Lib，打开失败时为 null，不再重试
+const libs = new Map();
+
+/**
+ * 打开驱动库，同一个库只打开一次
+ * @param {string} name 库文件名，如 'liblvgl_wrapper.so'
+ * @returns {FFI.Lib|null} 库不存在或加载失败时返回 null
+ */
+function nativeLib(name) {
+    if (!libs.has(name)) {
+        let lib = null;
+        try {
+            lib = new FFI.Lib(DRIVER_PATH + './' + name);
+        } catch (error) {
+            console.log(`驱动库 ${name} 加载失败，相关功能不可用:`, error);
+        }
+        libs.set(name, lib);
+    }
+    return libs.get(name);
+}
+
+/**
+ * 延迟解析的原生函数：首次调用时才打开驱动库、查找符号
+ * 库或符号不存在（驱动库未更新）时只打印一次日志，之后的调用直接返回 fallback，不影响其他功能
+ */
+class NativeFunction {
+    constructor(libName, symbol, ret, args, fallback) {
+        this.libName = libName;
+        this.symbol = symbol;
+        this.ret = ret;
+        this.args = args;
+        this.fallback = fallback;
+        // undefined 未解析，null 不可用
+        this.fn = undefined;
+    }
+
+    resolve() {
+        if (this.fn === undefined) {
+            this.fn = null;
+            const lib = nativeLib(this.libName);
+            if (lib) {
+                try {
+                    this.fn = new FFI.CFunction(lib.symbol(this.symbol), this.ret, this.args);
+                } catch (error) {
+                    console.log(`驱动库 ${this.libName} 缺少 ${this.symbol}，相关功能不可用`);
+                }
+            }
+        }
+        return this.fn;
+    }
+
+    // 是否可用，不可用时 call 返回 fallback
+    available() {
+        return this.resolve() !== null;
+    }
+
+    call(...args) {
+        const fn = this.resolve();
+        return fn ? fn.call(...args) : this.fallback;
+    }
+}
+
+/**
+ * 声明原生函数，用法与 FFI.CFunction 相同（.call），但不在模块加载时打开库
+ * @param {string} libName 库文件名
+ * @param {string} symbol 函数名
+ * @param {Object} ret 返回类型
+ * @param {Object[]} args 参数类型
+ * @param {*} fallback 不可用时的返回值，默认 -1
+ * @returns {NativeFunction}
+ */
+function nativeFunction(libName, symbol, ret, args, fallback = -1) {
+    return new NativeFunction(libName, symbol, ret, args, fallback);
+}
+
+export { nativeLib, nativeFunction };
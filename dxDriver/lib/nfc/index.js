@@ -0,0 +1,148 @@
+import FFI from 'tjs:ffi';
+
+import { nativeFunction } from '../native/index.js';
+
+// 驱动库不存在（旧固件）时刷卡功能不可用，nfcInit 返回-1
+const NFC_LIB = 'libnfc_wrapper.so';
+
+const structOptions = new FFI.StructType([
+    ['debounce_ms', FFI.types.sint],
+    ['relay_ms', FFI.types.sint],
+    ['reload_interval_ms', FFI.types.sint]
+], 'nfc_options_t');
+
+const structResult = new FFI.StructType([
+    ['seq', FFI.types.uint32],
+    ['result', FFI.types.sint],
+    ['reason', FFI.types.sint],
+    ['card_type', FFI.types.sint],
+    ['relay', FFI.types.sint],
+    ['latency_us', FFI.types.uint32],
+    ['time', FFI.types.sint64]
+], 'nfc_result_t');
+
+const structStats = new FFI.StructType([
+    ['reads', FFI.types.uint32],
+    ['debounced', FFI.types.uint32],
+    ['allowed', FFI.types.uint32],
+    ['denied', FFI.types.uint32],
+    ['dropped', FFI.types.uint32],
+    ['credentials', FFI.types.sint],
+    ['last_latency_us', FFI.types.uint32],
+    ['max_latency_us', FFI.types.uint32]
+], 'nfc_stats_t');
+
+const nfcInit1 = nativeFunction(
+    NFC_LIB,
+    'nfc_init',
+    FFI.types.sint,
+    [FFI.types.string, new FFI.PointerType(structOptions, 1)]
+);
+const nfcDeinit1 = nativeFunction(NFC_LIB, 'nfc_deinit', FFI.types.void, []);
+const nfcSetOptions1 = nativeFunction(NFC_LIB, 'nfc_set_options', FFI.types.void, [new FFI.PointerType(structOptions, 1)]);
+const nfcReloadCredentials1 = nativeFunction(NFC_LIB, 'nfc_reload_credentials', FFI.types.sint, []);
+const nfcGetResult1 = nativeFunction(
+    NFC_LIB,
+    'nfc_get_result',
+    FFI.types.sint,
+    [new FFI.PointerType(structResult, 1), FFI.types.buffer, FFI.types.buffer, FFI.types.buffer, FFI.types.buffer]
+);
+const nfcGetStats1 = nativeFunction(
+    NFC_LIB,
+    'nfc_get_stats',
+    FFI.types.void,
+    [new FFI.PointerType(structStats, 1)]
+);
+
+// 与 credential.h 中的长度一致
+const CODE_LEN = 64;
+const ID_LEN = 40;
+
+// 拒绝原因，与 credential.h 的 credential_reason 一致
+const NFC_REASON = {
+    OK: 0,
+    NOT_FOUND: 1,     // 凭证不存在或已失效
+    NO_PERMISSION: 2, // 用户无任何权限
+    OUT_OF_TIME: 3,   // 当前时间无权限
+};
+
+function toOptions(options) {
+    return {
+        debounce_ms: options.debounceMs ?? 1500,
+        relay_ms: options.relayMs ?? 2000,
+        reload_interval_ms: options.reloadIntervalMs ?? 2000,
+    };
+}
+
+/**
+ * 初始化NFC刷卡，读卡、查卡片凭证、开继电器都在驱动线程中完成，不经过JS
+ * @param {Object} options
+ * @param {string} options.dbPath 门禁数据库路径
+ * @param {number} options.debounceMs 同一张卡在该时间内重复读到只处理一次
+ * @param {number} options.relayMs 继电器吸合时长，0表示只判定不开门
+ * @param {number} options.reloadIntervalMs 检查数据库变化的间隔，凭证变动后自动重新加载，0表示不检查
+ * @returns {number} 0成功，-1失败
+ */
+function nfcInit(options = {}) {
+    return nfcInit1.call(options.dbPath || '/data/db/access.db', FFI.Pointer.createRef(structOptions, toOptions(options)));
+}
+
+function nfcDeinit() {
+    nfcDeinit1.call();
+}
+
+/**
+ * 修改刷卡参数，参数同nfcInit
+ */
+function nfcSetOptions(options = {}) {
+    nfcSetOptions1.call(FFI.Pointer.createRef(structOptions, toOptions(options)));
+}
+
+/**
+ * 立即重新加载卡片凭证表（默认由驱动检测数据库变化后自动加载）
+ * @returns {number} 凭证个数，-1失败
+ */
+function nfcReloadCredentials() {
+    return nfcReloadCredentials1.call();
+}
+
+/**
+ * 取一条已处理的刷卡结果，门已由驱动打开，这里只用于记录和界面提示
+ * @returns {null|{seq: number, result: number, reason: number, cardType: number, relay: number, latencyUs: number, time: number, code: string, credentialId: string, userId: string, permissionId: string}}
+ */
+function nfcGetResult() {
+    const resultBuffer = structResult.toBuffer({ seq: 0, result: 0, reason: 0, card_type: 0, relay: 0, latency_us: 0, time: 0 });
+    const code = new Uint8Array(CODE_LEN);
+    const credentialId = new Uint8Array(ID_LEN);
+    const userId = new Uint8Array(ID_LEN);
+    const permissionId = new Uint8Array(ID_LEN);
+    if (nfcGetResult1.call(FFI.Pointer.createRefFromBuf(structResult, resultBuffer), code, credentialId, userId, permissionId) !== 1) {
+        return null;
+    }
+    const result = structResult.fromBuffer(resultBuffer);
+    return {
+        seq: result.seq,
+        result: result.result,
+        reason: result.reason,
+        cardType: result.card_type,
+        relay: result.relay,
+        latencyUs: result.latency_us,
+        time: Number(result.time),
+        code: FFI.bufferToString(code),
+        credentialId: FFI.bufferToString(credentialId),
+        userId: FFI.bufferToString(userId),
+        permissionId: FFI.bufferToString(permissionId),
+    };
+}
+
+/**
+ * 获取刷卡统计，耗时单位微秒
+ * @returns {{reads: number, debounced: number, allowed: number, denied: number, dropped: number, credentials: number, last_latency_us: number, max_latency_us: number}}
+ */
+function nfcGetStats() {
+    const statsBuffer = structStats.toBuffer({ reads: 0, debounced: 0, allowed: 0, denied: 0, dropped: 0, credentials: 0, last_latency_us: 0, max_latency_us: 0 });
+    nfcGetStats1.call(FFI.Pointer.createRefFromBuf(structStats, statsBuffer));
+    return structStats.fromBuffer(statsBuffer);
+}
+
+export { NFC_REASON, nfcInit, nfcDeinit, nfcSetOptions, nfcReloadCredentials, nfcGetResult, nfcGetStats };
@@ -3,6 +3,7 @@ import { CommonComponentApi, CommonProps, OnChangeEvent } from "../common/index"
 import {
   EVENTTYPE_MAP,
   STYLE_TYPE,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -35,7 +36,7 @@ export type ArcProps = CommonProps & {
   changeRate?: number;
 };
 
-function setArcProps(comp, newProps: ArcProps, oldProps: ArcProps) {
+function setArcProps(comp, newProps: ArcProps, oldProps: ArcProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Arc", comp, newProps, oldProps }),
     indicatorStyle(styleSheet) {
@@ -134,18 +135,7 @@ function setArcProps(comp, newProps: ArcProps, oldProps: ArcProps) {
       comp.setChangeRate(val);
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class ArcComp extends NativeArc {
@@ -163,8 +153,8 @@ export class ArcComp extends NativeArc {
       },
     });
   }
-  setProps(newProps: ArcProps, oldProps: ArcProps) {
-    setArcProps(this, newProps, oldProps);
+  setProps(newProps: ArcProps, oldProps: ArcProps, updatePayload?: string[]) {
+    setArcProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   static tagName = "Arc";
@@ -3,6 +3,7 @@ import { CommonComponentApi, CommonProps, OnClickEvent } from "../common/index";
 import {
   EVENTTYPE_MAP,
   STYLE_TYPE,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -31,7 +32,7 @@ export type ButtonProps = CommonProps & {
   }) => void;
 };
 
-function setButtonProps(comp, newProps: ButtonProps, oldProps: ButtonProps) {
+function setButtonProps(comp, newProps: ButtonProps, oldProps: ButtonProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Button", comp, newProps, oldProps }),
     onPressedStyle(styleSheet) {
@@ -56,18 +57,7 @@ function setButtonProps(comp, newProps: ButtonProps, oldProps: ButtonProps) {
       handleEvent(comp, fn, EVENTTYPE_MAP.EVENT_LONG_PRESSED_REPEAT);
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class ButtonComp extends NativeButton {
@@ -85,8 +75,8 @@ export class ButtonComp extends NativeButton {
       },
     });
   }
-  setProps(newProps: ButtonProps, oldProps: ButtonProps) {
-    setButtonProps(this, newProps, oldProps);
+  setProps(newProps: ButtonProps, oldProps: ButtonProps, updatePayload?: string[]) {
+    setButtonProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   static tagName = "Button";
@@ -1,6 +1,7 @@
 import { CommonComponentApi, CommonProps, OnChangeEvent } from "../common/index";
 import {
   EVENTTYPE_MAP,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -16,7 +17,7 @@ export type CalendarProps = CommonProps & {
   onChange?: (event: OnChangeEvent) => void;
 };
 
-function setCalendarProps(comp, newProps: CalendarProps, oldProps: CalendarProps) {
+function setCalendarProps(comp, newProps: CalendarProps, oldProps: CalendarProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Calendar", comp, newProps, oldProps }),
     onChange(fn) {
@@ -44,18 +45,7 @@ function setCalendarProps(comp, newProps: CalendarProps, oldProps: CalendarProps
       }
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class CalendarComp extends NativeCalendar {
@@ -73,8 +63,8 @@ export class CalendarComp extends NativeCalendar {
       },
     });
   }
-  setProps(newProps: CalendarProps, oldProps: CalendarProps) {
-    setCalendarProps(this, newProps, oldProps);
+  setProps(newProps: CalendarProps, oldProps: CalendarProps, updatePayload?: string[]) {
+    setCalendarProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   static tagName = "Calendar";
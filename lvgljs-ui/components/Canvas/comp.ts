@@ -16,7 +16,7 @@ export type CanvasProps = CommonProps & {
   alignTo?: { type: number; pos: [number, number]; parent: any };
 };
 
-function setCanvasProps(comp, newProps: CanvasProps, oldProps: CanvasProps) {
+function setCanvasProps(comp, newProps: CanvasProps, oldProps: CanvasProps, updatePayload?: string[]) {
   const setter = {
     set style(styleSheet) {
       setStyle({
@@ -52,7 +52,15 @@ function setCanvasProps(comp, newProps: CanvasProps, oldProps: CanvasProps) {
       comp.alignTo(type, pos, parent);
     },
   };
-  Object.assign(setter, newProps);
+  if (updatePayload) {
+    updatePayload.forEach((key) => {
+      if (newProps.hasOwnProperty(key)) {
+        setter[key] = newProps[key];
+      }
+    });
+  } else {
+    Object.assign(setter, newProps);
+  }
   comp.dataset = {};
   Object.keys(newProps).forEach((prop) => {
     const index = prop.indexOf("data-");
@@ -77,8 +85,8 @@ export class CanvasComp extends NativeButton {
       },
     });
   }
-  setProps(newProps: CanvasProps, oldProps: CanvasProps) {
-    setCanvasProps(this, newProps, oldProps);
+  setProps(newProps: CanvasProps, oldProps: CanvasProps, updatePayload?: string[]) {
+    setCanvasProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   static tagName = "Canvas";
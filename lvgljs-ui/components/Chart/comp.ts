@@ -4,6 +4,7 @@ import { CommonComponentApi, CommonProps } from "../common/index";
 import {
   EVENTTYPE_MAP,
   STYLE_TYPE,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -46,7 +47,7 @@ export type ChartProps = CommonProps & {
   bottomAxisRange?: [number, number];
 };
 
-function setChartProps(comp, newProps: ChartProps, oldProps: ChartProps) {
+function setChartProps(comp, newProps: ChartProps, oldProps: ChartProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Chart", comp, newProps, oldProps }),
     onPressedStyle(styleSheet) {
@@ -259,18 +260,7 @@ function setChartProps(comp, newProps: ChartProps, oldProps: ChartProps) {
       }
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
   // This gives issues: invalid call to setPointNum?
   // comp.refresh();
 }
@@ -290,8 +280,8 @@ export class ChartComp extends NativeChart {
       },
     });
   }
-  setProps(newProps: ChartProps, oldProps: ChartProps) {
-    setChartProps(this, newProps, oldProps);
+  setProps(newProps: ChartProps, oldProps: ChartProps, updatePayload?: string[]) {
+    setChartProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   static tagName = "Chart";
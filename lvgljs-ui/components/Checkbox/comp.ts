@@ -3,6 +3,7 @@ import { CommonComponentApi, CommonProps, OnChangeEvent } from "../common/index"
 import {
   EVENTTYPE_MAP,
   STYLE_TYPE,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -21,7 +22,7 @@ export type CheckboxProps = CommonProps & {
   onChange?: (event: OnChangeEvent) => void;
 };
 
-function setCheckboxProps(comp, newProps: CheckboxProps, oldProps: CheckboxProps) {
+function setCheckboxProps(comp, newProps: CheckboxProps, oldProps: CheckboxProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Checkbox", comp, newProps, oldProps }),
     checked(val) {
@@ -70,18 +71,7 @@ function setCheckboxProps(comp, newProps: CheckboxProps, oldProps: CheckboxProps
       handleEvent(comp, fn, EVENTTYPE_MAP.EVENT_VALUE_CHANGED);
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class CheckboxComp extends NativeView {
@@ -99,8 +89,8 @@ export class CheckboxComp extends NativeView {
       },
     });
   }
-  setProps(newProps: CheckboxProps, oldProps: CheckboxProps) {
-    setCheckboxProps(this, newProps, oldProps);
+  setProps(newProps: CheckboxProps, oldProps: CheckboxProps, updatePayload?: string[]) {
+    setCheckboxProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {
     this.insertChildBefore(child, beforeChild);
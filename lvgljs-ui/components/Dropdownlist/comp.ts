@@ -1,9 +1,10 @@
 import { CommonComponentApi, CommonProps, OnChangeEvent } from "../common/index";
 import {
-  EDropdownListArrowDirection,
-  EDropdownlistDirection,
   EVENTTYPE_MAP,
   STYLE_TYPE,
+  applyProps,
+  EDropdownListArrowDirection,
+  EDropdownlistDirection,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -23,7 +24,7 @@ export type DropdownListProps = CommonProps & {
   onChange?: (event: OnChangeEvent) => void;
 };
 
-function setListProps(comp, newProps: DropdownListProps, oldProps: DropdownListProps) {
+function setListProps(comp, newProps: DropdownListProps, oldProps: DropdownListProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({
       compName: "Dropdownlist",
@@ -65,18 +66,7 @@ function setListProps(comp, newProps: DropdownListProps, oldProps: DropdownListP
       handleEvent(comp, fn, EVENTTYPE_MAP.EVENT_VALUE_CHANGED);
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class DropdownlistComp extends NativeDropdownlist {
@@ -94,8 +84,8 @@ export class DropdownlistComp extends NativeDropdownlist {
       },
     });
   }
-  setProps(newProps: DropdownListProps, oldProps: DropdownListProps) {
-    setListProps(this, newProps, oldProps);
+  setProps(newProps: DropdownListProps, oldProps: DropdownListProps, updatePayload?: string[]) {
+    setListProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   static tagName = "Dropdownlist";
@@ -3,6 +3,7 @@ import { isValidUrl } from "../../utils/helpers";
 import { CommonComponentApi, CommonProps } from "../common/index";
 import {
   EVENTTYPE_MAP,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -25,7 +26,7 @@ export type GIFProps = CommonProps & {
   src: string;
 }
 
-function setGIFProps(comp, newProps: GIFProps, oldProps: GIFProps) {
+function setGIFProps(comp, newProps: GIFProps, oldProps: GIFProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "GIF", comp, newProps, oldProps }),
     onClick(fn) {
@@ -56,18 +57,7 @@ function setGIFProps(comp, newProps: GIFProps, oldProps: GIFProps) {
       }
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class GIFComp extends NativeGIF {
@@ -85,8 +75,8 @@ export class GIFComp extends NativeGIF {
       },
     });
   }
-  setProps(newProps: GIFProps, oldProps: GIFProps) {
-    setGIFProps(this, newProps, oldProps);
+  setProps(newProps: GIFProps, oldProps: GIFProps, updatePayload?: string[]) {
+    setGIFProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   static tagName = "GIF";
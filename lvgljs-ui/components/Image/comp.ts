@@ -3,6 +3,7 @@ import { isValidUrl } from "../../utils/helpers";
 import { CommonComponentApi, CommonProps } from "../common/index";
 import {
   EVENTTYPE_MAP,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -27,7 +28,7 @@ export type ImageProps = CommonProps & {
   src: string;
 };
 
-function setImageProps(comp, newProps: ImageProps, oldProps: ImageProps) {
+function setImageProps(comp, newProps: ImageProps, oldProps: ImageProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Image", comp, newProps, oldProps }),
     onClick(fn) {
@@ -58,18 +59,7 @@ function setImageProps(comp, newProps: ImageProps, oldProps: ImageProps) {
       }
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class ImageComp extends NativeImage {
@@ -87,8 +77,8 @@ export class ImageComp extends NativeImage {
       },
     });
   }
-  setProps(newProps: ImageProps, oldProps: ImageProps) {
-    setImageProps(this, newProps, oldProps);
+  setProps(newProps: ImageProps, oldProps: ImageProps, updatePayload?: string[]) {
+    setImageProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   static tagName = "Image";
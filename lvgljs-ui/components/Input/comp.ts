@@ -2,6 +2,7 @@ import { StyleProps } from "../../core/style";
 import { CommonComponentApi, CommonProps, OnChangeEvent } from "../common/index";
 import {
   EVENTTYPE_MAP,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -33,7 +34,7 @@ export type InputProps = CommonProps & {
   autoKeyBoard: boolean;
 };
 
-function setInputProps(comp, newProps: InputProps, oldProps: InputProps) {
+function setInputProps(comp, newProps: InputProps, oldProps: InputProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Input", comp, newProps, oldProps }),
     placeholder(str) {
@@ -85,18 +86,7 @@ function setInputProps(comp, newProps: InputProps, oldProps: InputProps) {
       }
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 /** A one line mode of Textarea */
@@ -117,8 +107,8 @@ export class InputComp extends NativeView {
       },
     });
   }
-  setProps(newProps: InputProps, oldProps: InputProps) {
-    setInputProps(this, newProps, oldProps);
+  setProps(newProps: InputProps, oldProps: InputProps, updatePayload?: string[]) {
+    setInputProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   appendInitialChild(child) {}
@@ -1,6 +1,7 @@
 import { CommonComponentApi, CommonProps } from "../common/index";
 import {
   EVENTTYPE_MAP,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -30,7 +31,7 @@ export type KeyboardProps = CommonProps & {
   onOk?: () => void;
 };
 
-function setKeyboardProps(comp, newProps: KeyboardProps, oldProps: KeyboardProps) {
+function setKeyboardProps(comp, newProps: KeyboardProps, oldProps: KeyboardProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Keyboard", comp, newProps, oldProps }),
     mode(mode) {
@@ -50,18 +51,7 @@ function setKeyboardProps(comp, newProps: KeyboardProps, oldProps: KeyboardProps
       handleEvent(comp, fn, EVENTTYPE_MAP.EVENT_READY);
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class KeyboardComp extends NativeView {
@@ -79,8 +69,8 @@ export class KeyboardComp extends NativeView {
       },
     });
   }
-  setProps(newProps: KeyboardProps, oldProps: KeyboardProps) {
-    setKeyboardProps(this, newProps, oldProps);
+  setProps(newProps: KeyboardProps, oldProps: KeyboardProps, updatePayload?: string[]) {
+    setKeyboardProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   appendInitialChild(child) {}
@@ -1,6 +1,7 @@
 import { CommonComponentApi, CommonProps } from "../common/index";
 import {
   EVENTTYPE_MAP,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -13,7 +14,7 @@ export type LineProps = CommonProps & {
   points: [number, number][];
 };
 
-function setLineProps(comp, newProps, oldProps) {
+function setLineProps(comp, newProps, oldProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Keyboard", comp, newProps, oldProps }),
     points(points) {
@@ -25,18 +26,7 @@ function setLineProps(comp, newProps, oldProps) {
       }
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class LineComp extends NativeLine {
@@ -54,8 +44,8 @@ export class LineComp extends NativeLine {
       },
     });
   }
-  setProps(newProps: LineProps, oldProps: LineProps) {
-    setLineProps(this, newProps, oldProps);
+  setProps(newProps: LineProps, oldProps: LineProps, updatePayload?: string[]) {
+    setLineProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   static tagName = "Line";
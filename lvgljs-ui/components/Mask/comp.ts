@@ -3,6 +3,7 @@ import { CommonComponentApi, CommonProps, OnClickEvent } from "../common/index";
 import {
   EVENTTYPE_MAP,
   STYLE_TYPE,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -31,7 +32,7 @@ export type MaskProps = CommonProps & {
   }) => void;
 };
 
-function setMaskProps(comp, newProps: MaskProps, oldProps: MaskProps) {
+function setMaskProps(comp, newProps: MaskProps, oldProps: MaskProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Mask", comp, newProps, oldProps }),
     onPressedStyle(styleSheet) {
@@ -56,18 +57,7 @@ function setMaskProps(comp, newProps: MaskProps, oldProps: MaskProps) {
       handleEvent(comp, fn, EVENTTYPE_MAP.EVENT_LONG_PRESSED_REPEAT);
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class MaskComp extends NativeMask {
@@ -85,8 +75,8 @@ export class MaskComp extends NativeMask {
       },
     });
   }
-  setProps(newProps: MaskProps, oldProps: MaskProps) {
-    setMaskProps(this, newProps, oldProps);
+  setProps(newProps: MaskProps, oldProps: MaskProps, updatePayload?: string[]) {
+    setMaskProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   static tagName = "Mask";
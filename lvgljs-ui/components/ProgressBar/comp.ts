@@ -1,6 +1,6 @@
 import { StyleProps } from "../../core/style";
 import { CommonComponentApi, CommonProps } from "../common/index";
-import { STYLE_TYPE, handleEvent, setStyle, styleGetterProp } from "../config";
+import { STYLE_TYPE, applyProps, handleEvent, setStyle, styleGetterProp } from "../config";
 
 const bridge = globalThis[Symbol.for('lvgljs')];
 const NativeProgressBar = bridge.NativeRender.NativeComponents.ProgressBar;
@@ -13,7 +13,7 @@ export type ProgressBarProps = CommonProps & {
   indicatorStyle?: StyleProps;
 };
 
-function setProgressBarProps(comp, newProps: ProgressBarProps, oldProps: ProgressBarProps) {
+function setProgressBarProps(comp, newProps: ProgressBarProps, oldProps: ProgressBarProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({
       compName: "ProgressBar",
@@ -53,18 +53,7 @@ function setProgressBarProps(comp, newProps: ProgressBarProps, oldProps: Progres
       }
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class ProgressBarComp extends NativeProgressBar {
@@ -82,8 +71,8 @@ export class ProgressBarComp extends NativeProgressBar {
       },
     });
   }
-  setProps(newProps: ProgressBarProps, oldProps: ProgressBarProps) {
-    setProgressBarProps(this, newProps, oldProps);
+  setProps(newProps: ProgressBarProps, oldProps: ProgressBarProps, updatePayload?: string[]) {
+    setProgressBarProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   static tagName = "ProgressBar";
@@ -3,6 +3,7 @@ import { CommonComponentApi, CommonProps } from "../common/index";
 import {
   EVENTTYPE_MAP,
   STYLE_TYPE,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -21,7 +22,7 @@ export type RollerProps = CommonProps & {
   onChange?: (event: OnChangeEvent) => void;
 };
 
-function setRollerProps(comp, newProps: RollerProps, oldProps: RollerProps) {
+function setRollerProps(comp, newProps: RollerProps, oldProps: RollerProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Roller", comp, newProps, oldProps }),
     selectedStyle(styleSheet) {
@@ -52,18 +53,7 @@ function setRollerProps(comp, newProps: RollerProps, oldProps: RollerProps) {
       handleEvent(comp, fn, EVENTTYPE_MAP.EVENT_VALUE_CHANGED);
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class RollerComp extends NativeRoller {
@@ -81,8 +71,8 @@ export class RollerComp extends NativeRoller {
       },
     });
   }
-  setProps(newProps: RollerProps, oldProps: RollerProps) {
-    setRollerProps(this, newProps, oldProps);
+  setProps(newProps: RollerProps, oldProps: RollerProps, updatePayload?: string[]) {
+    setRollerProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   static tagName = "Roller";
@@ -14,7 +14,7 @@ export default class RollerConfig implements LvgljsComponentConfig<RollerProps,
   }
   commitMount(instance, newProps: RollerProps, internalInstanceHandle) {}
   commitUpdate(instance, updatePayload, oldProps: RollerProps, newProps: RollerProps, finishedWork) {
-    instance.setProps(newProps, oldProps);
+    instance.setProps(newProps, oldProps, updatePayload);
   }
   setProps(newProps: RollerProps, oldProps: RollerProps) {}
   insertBefore(child, beforeChild) {}
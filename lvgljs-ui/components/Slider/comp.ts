@@ -3,6 +3,7 @@ import { CommonComponentApi, CommonProps, OnChangeEvent } from "../common/index"
 import {
   EVENTTYPE_MAP,
   STYLE_TYPE,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -22,7 +23,7 @@ export type SliderProps = CommonProps & {
   value: number;
 };
 
-function setSliderProps(comp, newProps: SliderProps, oldProps: SliderProps) {
+function setSliderProps(comp, newProps: SliderProps, oldProps: SliderProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Slider", comp, newProps, oldProps }),
     indicatorStyle(styleSheet) {
@@ -86,18 +87,7 @@ function setSliderProps(comp, newProps: SliderProps, oldProps: SliderProps) {
       comp.setValue(val);
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class SliderComp extends NativeSlider {
@@ -115,8 +105,8 @@ export class SliderComp extends NativeSlider {
       },
     });
   }
-  setProps(newProps: SliderProps, oldProps: SliderProps) {
-    setSliderProps(this, newProps, oldProps);
+  setProps(newProps: SliderProps, oldProps: SliderProps, updatePayload?: string[]) {
+    setSliderProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   static tagName = "Slider";
@@ -3,6 +3,7 @@ import { CommonComponentApi, CommonProps, OnChangeEvent } from "../common/index"
 import {
   EVENTTYPE_MAP,
   STYLE_TYPE,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -18,7 +19,7 @@ export type SwitchProps = CommonProps & {
   disabled?: boolean;
 };
 
-function setSwitchProps(comp, newProps: SwitchProps, oldProps: SwitchProps) {
+function setSwitchProps(comp, newProps: SwitchProps, oldProps: SwitchProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Switch", comp, newProps, oldProps }),
     checkedStyle(styleSheet) {
@@ -44,18 +45,7 @@ function setSwitchProps(comp, newProps: SwitchProps, oldProps: SwitchProps) {
       }
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class SwitchComp extends NativeComp {
@@ -73,8 +63,8 @@ export class SwitchComp extends NativeComp {
       },
     });
   }
-  setProps(newProps, oldProps) {
-    setSwitchProps(this, newProps, oldProps);
+  setProps(newProps, oldProps, updatePayload?: string[]) {
+    setSwitchProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {
     this.insertChildBefore(child, beforeChild);
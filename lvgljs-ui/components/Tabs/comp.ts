@@ -2,6 +2,7 @@ import { CommonComponentApi, CommonProps } from "../common/index";
 import {
   EVENTTYPE_MAP,
   STYLE_TYPE,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -16,7 +17,7 @@ export type TabsProps = CommonProps & {
   tabSize?: number;
 };
 
-function setTabsProps(comp, newProps: TabsProps, oldProps: TabsProps) {
+function setTabsProps(comp, newProps: TabsProps, oldProps: TabsProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Tabs", comp, newProps, oldProps }),
     onClick(fn) {
@@ -32,18 +33,7 @@ function setTabsProps(comp, newProps: TabsProps, oldProps: TabsProps) {
       handleEvent(comp, fn, EVENTTYPE_MAP.EVENT_LONG_PRESSED_REPEAT);
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 const tabPositionObj = {
@@ -70,9 +60,9 @@ export class TabsComp extends NativeTabs {
     });
     this.currentAppendIndex = 0;
   }
-  setProps(newProps: TabsProps, oldProps: TabsProps) {
+  setProps(newProps: TabsProps, oldProps: TabsProps, updatePayload?: string[]) {
     this.tabs = newProps.tabs;
-    setTabsProps(this, newProps, oldProps);
+    setTabsProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   static tagName = "Tabs";
@@ -2,6 +2,7 @@ import { CommonComponentApi, CommonProps } from "../common/index";
 import {
   EVENTTYPE_MAP,
   STYLE_TYPE,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -14,7 +15,7 @@ export type TextProps = CommonProps & {
   children: string | number | (string | number)[];
 };
 
-function setTextProps(comp, newProps: TextProps, oldProps: TextProps) {
+function setTextProps(comp, newProps: TextProps, oldProps: TextProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Text", comp, newProps, oldProps }),
     children(str) {
@@ -31,18 +32,7 @@ function setTextProps(comp, newProps: TextProps, oldProps: TextProps) {
       }
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class TextComp extends NativeText {
@@ -60,8 +50,8 @@ export class TextComp extends NativeText {
       },
     });
   }
-  setProps(newProps: TextProps, oldProps: TextProps) {
-    setTextProps(this, newProps, oldProps);
+  setProps(newProps: TextProps, oldProps: TextProps, updatePayload?: string[]) {
+    setTextProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   appendInitialChild(child) {}
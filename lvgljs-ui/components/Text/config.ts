@@ -13,7 +13,7 @@ export default class TextConfig implements LvgljsComponentConfig<TextProps, Text
   }
   commitMount(instance, newProps: TextProps, internalInstanceHandle) {}
   commitUpdate(instance, updatePayload, oldProps: TextProps, newProps: TextProps, finishedWork) {
-    instance.setProps(newProps, oldProps);
+    instance.setProps(newProps, oldProps, updatePayload);
   }
   commitUnmount(instance) {}
   setProps(newProps: TextProps, oldProps: TextProps) {}
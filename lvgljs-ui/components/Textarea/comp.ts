@@ -2,6 +2,7 @@ import { StyleProps } from "../../core/style";
 import { CommonComponentApi, CommonProps, OnChangeEvent } from "../common/index";
 import {
   EVENTTYPE_MAP,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -26,7 +27,7 @@ export type TextAreaProps = CommonProps & {
   autoKeyBoard: boolean;
 };
 
-function setTextareaProps(comp, newProps: TextAreaProps, oldProps: TextAreaProps) {
+function setTextareaProps(comp, newProps: TextAreaProps, oldProps: TextAreaProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Textarea", comp, newProps, oldProps }),
     placeholder(str) {
@@ -70,18 +71,7 @@ function setTextareaProps(comp, newProps: TextAreaProps, oldProps: TextAreaProps
       }
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class TextareaComp extends NativeView {
@@ -101,8 +91,8 @@ export class TextareaComp extends NativeView {
       },
     });
   }
-  setProps(newProps: TextAreaProps, oldProps: TextAreaProps) {
-    setTextareaProps(this, newProps, oldProps);
+  setProps(newProps: TextAreaProps, oldProps: TextAreaProps, updatePayload?: string[]) {
+    setTextareaProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   appendInitialChild(child) {}
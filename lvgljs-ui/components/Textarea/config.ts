@@ -13,7 +13,7 @@ export default class TextareaConfig implements LvgljsComponentConfig<TextAreaPro
   }
   commitMount(instance, newProps: TextAreaProps, internalInstanceHandle) {}
   commitUpdate(instance, updatePayload, oldProps: TextAreaProps, newProps: TextAreaProps, finishedWork) {
-    instance.setProps(newProps, oldProps);
+    instance.setProps(newProps, oldProps, updatePayload);
   }
   commitUnmount(instance) {}
   setProps(newProps: TextAreaProps, oldProps: TextAreaProps) {}
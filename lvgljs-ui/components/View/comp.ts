@@ -2,6 +2,7 @@ import { CommonComponentApi, CommonProps } from "../common/index";
 import {
   EVENTTYPE_MAP,
   STYLE_TYPE,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -12,22 +13,11 @@ const NativeView = bridge.NativeRender.NativeComponents.View;
 
 export type ViewProps = CommonProps
 
-function setViewProps(comp, newProps: ViewProps, oldProps: ViewProps) {
+function setViewProps(comp, newProps: ViewProps, oldProps: ViewProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "View", comp, newProps, oldProps }),
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class ViewComp extends NativeView {
@@ -45,8 +35,8 @@ export class ViewComp extends NativeView {
       },
     });
   }
-  setProps(newProps: ViewProps, oldProps: ViewProps) {
-    setViewProps(this, newProps, oldProps);
+  setProps(newProps: ViewProps, oldProps: ViewProps, updatePayload?: string[]) {
+    setViewProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {
     super.insertChildBefore(child, beforeChild);
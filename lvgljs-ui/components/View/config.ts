@@ -13,7 +13,7 @@ export default class ViewConfig implements LvgljsComponentConfig<ViewProps, View
   }
   commitMount(instance, newProps: ViewProps, internalInstanceHandle) {}
   commitUpdate(instance, updatePayload, oldProps: ViewProps, newProps: ViewProps, finishedWork) {
-    instance.setProps(newProps, oldProps);
+    instance.setProps(newProps, oldProps, updatePayload);
   }
   commitUnmount(instance) {}
   setProps(newProps: ViewProps, oldProps: ViewProps) {}
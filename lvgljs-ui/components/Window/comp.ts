@@ -1,6 +1,7 @@
 import { CommonComponentApi, CommonProps } from "../common/index";
 import {
   EVENTTYPE_MAP,
+  applyProps,
   handleEvent,
   setStyle,
   styleGetterProp,
@@ -13,7 +14,7 @@ export type WindowProps = CommonProps & {
   title: string;
 };
 
-function setWindowProps(comp, newProps: WindowProps, oldProps: WindowProps) {
+function setWindowProps(comp, newProps: WindowProps, oldProps: WindowProps, updatePayload?: string[]) {
   const setter = {
     ...CommonComponentApi({ compName: "Window", comp, newProps, oldProps }),
     title(title) {
@@ -22,18 +23,7 @@ function setWindowProps(comp, newProps: WindowProps, oldProps: WindowProps) {
       }
     },
   };
-  Object.keys(setter).forEach((key) => {
-    if (newProps.hasOwnProperty(key)) {
-      setter[key](newProps[key]);
-    }
-  });
-  comp.dataset = {};
-  Object.keys(newProps).forEach((prop) => {
-    const index = prop.indexOf("data-");
-    if (index === 0) {
-      comp.dataset[prop.substring(5)] = newProps[prop];
-    }
-  });
+  applyProps(comp, setter, newProps, updatePayload);
 }
 
 export class Window extends NativeComp {
@@ -51,8 +41,8 @@ export class Window extends NativeComp {
       },
     });
   }
-  setProps(newProps: WindowProps, oldProps: WindowProps) {
-    setWindowProps(this, newProps, oldProps);
+  setProps(newProps: WindowProps, oldProps: WindowProps, updatePayload?: string[]) {
+    setWindowProps(this, newProps, oldProps, updatePayload);
   }
   insertBefore(child, beforeChild) {}
   appendInitialChild(child) {
@@ -56,6 +56,22 @@ export type CommonProps = {
     currentTarget: any,
     stopPropogation: () => void,
   }) => void;
+  // 按住期间持续触发，只在设置了处理函数时由原生侧回调
+  onPressing?: (event: {
+    target: any,
+    currentTarget: any,
+    stopPropogation: () => void,
+  }) => void;
+  onScroll?: (event: {
+    target: any,
+    currentTarget: any,
+    stopPropogation: () => void,
+  }) => void;
+  onScrollEnd?: (event: {
+    target: any,
+    currentTarget: any,
+    stopPropogation: () => void,
+  }) => void;
 };
 
 export type OnChangeEvent = {
@@ -162,5 +178,14 @@ export const CommonComponentApi = function ({
     onReleased(fn) {
       handleEvent(comp, fn, EVENTTYPE_MAP.EVENT_RELEASED);
     },
+    onPressing(fn) {
+      handleEvent(comp, fn, EVENTTYPE_MAP.EVENT_PRESSING);
+    },
+    onScroll(fn) {
+      handleEvent(comp, fn, EVENTTYPE_MAP.EVENT_SCROLL);
+    },
+    onScrollEnd(fn) {
+      handleEvent(comp, fn, EVENTTYPE_MAP.EVENT_SCROLL_END);
+    },
   };
 };
@@ -112,3 +112,25 @@ export type LvgljsComponentConfig<ComponentProps, ComponentInstance> = Pick<
   | "appendChild"
   | "removeChild"
 > & { tagName: string };
+
+/**
+ * 按 setter 声明顺序应用属性，updatePayload 为 prepareUpdate 算出的变化属性名，
+ * 未传（首次创建）时应用全部属性；data- 属性只在有变化时重建 dataset
+ */
+export function applyProps(comp, setter, newProps, updatePayload?: string[]) {
+  Object.keys(setter).forEach((key) => {
+    if (newProps.hasOwnProperty(key) && (!updatePayload || updatePayload.includes(key))) {
+      setter[key](newProps[key]);
+    }
+  });
+  if (updatePayload && !updatePayload.some((prop) => prop.indexOf("data-") === 0)) {
+    return;
+  }
+  comp.dataset = {};
+  Object.keys(newProps).forEach((prop) => {
+    const index = prop.indexOf("data-");
+    if (index === 0) {
+      comp.dataset[prop.substring(5)] = newProps[prop];
+    }
+  });
+}
@@ -1,7 +1,5 @@
 import { getInstance } from "../reconciler";
 
-const eventMap = {};
-
 export const EVENTTYPE_MAP = {
   EVENT_ALL: 0,
 
@@ -63,41 +61,71 @@ export const EVENTTYPE_MAP = {
                                       before the class default event processing */,
 };
 
+// 事件处理函数表：按事件类型（整数）下标，每个类型一个 uid -> 处理函数的 Map。
+// 原生侧只对 addEventListener 过的类型回调 JS，这里保证每个 (组件, 类型) 只注册一次，
+// 处理函数变化（如每次渲染传入新的箭头函数）只替换表项，不再跨越 JS->native
+const handlerTables = [];
+
+// 分发计数：delivered 调用了处理函数，dropped 没有对应处理函数（原生侧过滤正常时应为0）
+const eventStats = {
+  delivered: 0,
+  dropped: 0,
+};
+
+export const getEventStats = () => {
+  return { ...eventStats };
+};
+
+function getTable(eventType) {
+  let table = handlerTables[eventType];
+  if (!table) {
+    table = handlerTables[eventType] = new Map();
+  }
+  return table;
+}
+
+// 返回是否为该组件新增的事件类型
 export function registEvent(uid, eventType, fn) {
-  eventMap[uid] = eventMap[uid] || {};
-  eventMap[uid][eventType] = fn;
+  const table = getTable(eventType);
+  const isNew = !table.has(uid);
+  table.set(uid, fn);
+  return isNew;
 }
 
+// 返回是否确实移除了处理函数
 export function unRegistEvent(uid, eventType) {
-  if (!eventType) {
-    delete eventMap[uid];
-  } else {
-    const obj = eventMap[uid];
-    obj && delete obj[eventType];
+  if (eventType === undefined) {
+    handlerTables.forEach((table) => table && table.delete(uid));
+    return true;
   }
+  const table = handlerTables[eventType];
+  return !!table && table.delete(uid);
 }
 
 export function fireEvent(targetUid, currentTargetUid, eventType, e) {
-  const obj = eventMap[currentTargetUid];
-  const target = getInstance(targetUid);
-  const currentTarget = getInstance(currentTargetUid);
-  if (obj) {
-    e.target = target;
-    e.currentTarget = currentTarget;
-    try {
-      obj[eventType].call(null, e);
-    } catch (err) {
-      console.log(err);
-    }
+  const table = handlerTables[eventType];
+  const fn = table && table.get(currentTargetUid);
+  if (!fn) {
+    eventStats.dropped++;
+    return;
+  }
+  eventStats.delivered++;
+  e.target = getInstance(targetUid);
+  e.currentTarget =
+    targetUid === currentTargetUid ? e.target : getInstance(currentTargetUid);
+  try {
+    fn.call(null, e);
+  } catch (err) {
+    console.log(err);
   }
 }
 
 export function handleEvent(comp, fn, type) {
   if (fn) {
-    registEvent(comp.uid, type, fn);
-    comp.addEventListener(type);
-  } else {
-    unRegistEvent(comp.uid, type);
+    if (registEvent(comp.uid, type, fn)) {
+      comp.addEventListener(type);
+    }
+  } else if (unRegistEvent(comp.uid, type)) {
     comp.removeEventListener(type);
   }
 }
@@ -11,7 +11,107 @@ export const getUid = () => {
 const instanceMap = new Map();
 
 export const getInstance = (uid) => {
-  return instanceMap[uid];
+  return instanceMap.get(uid);
+};
+
+// 渲染阶段计数：prepareUpdate 比较的组件数、其中无变化跳过提交的数量、提交的变化属性数
+const renderStats = {
+  prepared: 0,
+  skipped: 0,
+  committed: 0,
+  changedProps: 0,
+};
+
+export const getRenderStats = () => {
+  return { ...renderStats };
+};
+
+export const resetRenderStats = () => {
+  renderStats.prepared = 0;
+  renderStats.skipped = 0;
+  renderStats.committed = 0;
+  renderStats.changedProps = 0;
+};
+
+const isPlainObject = (value) => {
+  if (value === null || typeof value !== "object") {
+    return false;
+  }
+  const proto = Object.getPrototypeOf(value);
+  return proto === Object.prototype || proto === null;
+};
+
+// 浅比较：数组、普通对象逐项比较 depth 层（样式数组 -> 样式对象 -> 数组型样式值需要3层），
+// 组件实例、函数等按引用比较
+const propEqual = (a, b, depth) => {
+  if (a === b) {
+    return true;
+  }
+  if (depth <= 0) {
+    return false;
+  }
+  if (Array.isArray(a)) {
+    if (!Array.isArray(b) || a.length !== b.length) {
+      return false;
+    }
+    for (let i = 0; i < a.length; i++) {
+      if (!propEqual(a[i], b[i], depth - 1)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  if (!isPlainObject(a) || !isPlainObject(b)) {
+    return false;
+  }
+  const keys = Object.keys(a);
+  if (keys.length !== Object.keys(b).length) {
+    return false;
+  }
+  for (let i = 0; i < keys.length; i++) {
+    const key = keys[i];
+    if (!b.hasOwnProperty(key) || !propEqual(a[key], b[key], depth - 1)) {
+      return false;
+    }
+  }
+  return true;
+};
+
+// 文本内容（字符串、数字或它们的数组）不会生成 react 子节点（createTextInstance 返回 null），
+// 只能作为属性比较，如 <Text>{value}</Text>；元素子节点由 react 自己处理
+const isTextContent = (value) => {
+  const type = typeof value;
+  if (type === "string" || type === "number") {
+    return true;
+  }
+  return (
+    Array.isArray(value) &&
+    value.every((item) => typeof item === "string" || typeof item === "number")
+  );
+};
+
+const skipChildren = (oldProps, newProps) => {
+  return !isTextContent(oldProps.children) && !isTextContent(newProps.children);
+};
+
+// 变化的属性名列表，无变化时返回 null，react 不再调用 commitUpdate
+export const diffProps = (oldProps, newProps) => {
+  let changed = null;
+  const skipChildrenKey = skipChildren(oldProps, newProps);
+  for (const key in newProps) {
+    if ((key === "children" && skipChildrenKey) || !newProps.hasOwnProperty(key)) {
+      continue;
+    }
+    if (!oldProps.hasOwnProperty(key) || !propEqual(oldProps[key], newProps[key], 3)) {
+      (changed || (changed = [])).push(key);
+    }
+  }
+  for (const key in oldProps) {
+    if ((key !== "children" || !skipChildrenKey) && oldProps.hasOwnProperty(key) && !newProps.hasOwnProperty(key)) {
+      (changed || (changed = [])).push(key);
+    }
+  }
+  return changed;
 };
 
 const HostConfig = {
@@ -53,7 +153,7 @@ const HostConfig = {
       workInProgress,
       uid,
     );
-    instanceMap[uid] = instance;
+    instanceMap.set(uid, instance);
     return instance;
   },
   createTextInstance: (
@@ -101,8 +201,16 @@ const HostConfig = {
       child.close();
     }
   },
-  prepareUpdate(instance, oldProps, newProps) {
-    return true;
+  prepareUpdate(instance, type, oldProps, newProps) {
+    const updatePayload = diffProps(oldProps, newProps);
+    renderStats.prepared++;
+    if (updatePayload) {
+      renderStats.committed++;
+      renderStats.changedProps += updatePayload.length;
+    } else {
+      renderStats.skipped++;
+    }
+    return updatePayload;
   },
   commitUpdate: function (
     instance,
@@ -127,7 +235,7 @@ const HostConfig = {
   removeChild(parent, child) {
     parent?.removeChild(child);
     unRegistEvent(child.uid);
-    delete instanceMap[child.uid];
+    instanceMap.delete(child.uid);
   },
   commitMount: function (instance, type, newProps, internalInstanceHandle) {
     const { commitMount } = getComponentByTagName(type);
@@ -69,6 +69,67 @@ StyleSheet.pipeline([
   ArcStyle,
 ]);
 
+// 转换结果缓存：按 (compName, 合并后样式内容) 查找，内联样式每次渲染都是新对象，内容相同则复用；
+// 结果对象在多个控件间共享，只读
+const TRANSFORM_CACHE_MAX = 256;
+const transformCache = new Map();
+
+// 每个控件各 styleType 最近一次下发到底层的转换结果，只下发有变化的键；
+// 直接调用 nativeSetStyle 绕过了这里，之后需要 invalidateStyle 让下一次完整下发
+const appliedStyles = new WeakMap();
+
+// 这两个键由 PostProcessStyle 读取图片，值不变时不重复加载
+const POST_PROCESS_KEYS = ["background-image", "arc-image"];
+
+const styleStats = {
+  hits: 0,
+  misses: 0,
+  skipped: 0,
+  pushedKeys: 0,
+};
+
+export function getStyleStats() {
+  return { ...styleStats, cacheSize: transformCache.size };
+}
+
+export function invalidateStyle(comp) {
+  appliedStyles.delete(comp);
+}
+
+function transformCached(styleSheet, compName) {
+  const key = compName + "|" + JSON.stringify(styleSheet);
+  let entry = transformCache.get(key);
+  if (entry) {
+    // 移到末尾，淘汰时从最久未用的开始
+    transformCache.delete(key);
+    transformCache.set(key, entry);
+    styleStats.hits++;
+    return entry;
+  }
+  styleStats.misses++;
+  const result = StyleSheet.transform(styleSheet, compName);
+  entry = { result, keys: Object.keys(result) };
+  transformCache.set(key, entry);
+  if (transformCache.size > TRANSFORM_CACHE_MAX) {
+    transformCache.delete(transformCache.keys().next().value);
+  }
+  return entry;
+}
+
+function getApplied(comp, styleType) {
+  let byType = appliedStyles.get(comp);
+  if (!byType) {
+    byType = new Map();
+    appliedStyles.set(comp, byType);
+  }
+  let applied = byType.get(styleType);
+  if (!applied) {
+    applied = {};
+    byType.set(styleType, applied);
+  }
+  return applied;
+}
+
 export function setStyle({
   comp,
   styleSheet,
@@ -95,11 +156,46 @@ export function setStyle({
 
   if (!maybeChange) return;
   styleSheet = Object.assign({}, defaultStyle, ...styleSheet);
-  const result = StyleSheet.transform(styleSheet, compName);
+  const { result, keys } = transformCached(styleSheet, compName);
 
-  const keys = Object.keys(result);
-  comp.nativeSetStyle(result, keys, keys.length, styleType, isInit);
-  PostProcessStyle({ comp, styleSheet, styleType });
+  // 与上次下发的结果比较，只下发变化的键；缓存命中时值是同一对象，数组类的值也能按引用比较。
+  // 组件 setStyle() 方法（isInit 为 false）按整体样式下发，不做比较，并以此为新的基准
+  const applied = getApplied(comp, styleType);
+  if (!isInit) {
+    for (const key in applied) {
+      if (key[0] !== "@") {
+        delete applied[key];
+      }
+    }
+  }
+  let changed = null;
+  for (let i = 0; i < keys.length; i++) {
+    const key = keys[i];
+    if (applied[key] !== result[key]) {
+      (changed || (changed = {}))[key] = result[key];
+      applied[key] = result[key];
+    }
+  }
+  if (changed) {
+    const changedKeys = Object.keys(changed);
+    styleStats.pushedKeys += changedKeys.length;
+    comp.nativeSetStyle(changed, changedKeys, changedKeys.length, styleType, isInit);
+  } else {
+    styleStats.skipped++;
+  }
+
+  let post = null;
+  for (let i = 0; i < POST_PROCESS_KEYS.length; i++) {
+    const key = POST_PROCESS_KEYS[i];
+    const appliedKey = "@" + key;
+    if (styleSheet[key] !== void 0 && applied[appliedKey] !== styleSheet[key]) {
+      (post || (post = {}))[key] = styleSheet[key];
+      applied[appliedKey] = styleSheet[key];
+    }
+  }
+  if (post) {
+    PostProcessStyle({ comp, styleSheet: post, styleType });
+  }
 }
 
 type StyleType = 
@@ -74,5 +74,8 @@ export { EAnimateEasingFunc, Animate } from "./core/animate";
 export { Dimensions } from "./core/dimensions";
 export { BUILT_IN_SYMBOL } from "./core/style/symbol";
 export { Theme } from "./core/theme";
+export { getStyleStats, invalidateStyle } from "./core/style";
+export { getRenderStats, resetRenderStats } from "./core/reconciler";
+export { getEventStats } from "./core/event";
 
 export const Render = Renderer;